@@ -0,0 +1,424 @@
+// ClothNetworkBase.cpp - Contains implementations common to all cloth network representations (the
+//                        generic node network, and compile-time grid cloths).
+
+#include "ClothNetworkBase.h"
+
+
+/////
+// CClothSimulationObserver class
+/////
+CClothSimulationObserver::~CClothSimulationObserver()
+{
+
+}
+
+
+/////
+// CClothSimulationCounters class
+/////
+CClothSimulationCounters::CClothSimulationCounters() : mAdvanceCount(0), mStepCount(0),
+	mElapsedTime(0.0), mTimeQuantum(0.0), mStableTimeQuantum(0.0)
+{
+
+}
+
+void CClothSimulationCounters::NotifyNetworkAdvanced(const ScalarType simulatedTime,
+													 const QuantityType stepCount,
+													 const ScalarType timeQuantum,
+													 const ScalarType stableTimeQuantum)
+{
+	this->mAdvanceCount++;
+	this->mStepCount += stepCount;
+	this->mElapsedTime += simulatedTime;
+
+	this->mTimeQuantum = timeQuantum;
+	this->mStableTimeQuantum = stableTimeQuantum;
+}
+
+
+/////
+// CClothNetworkBase class
+/////
+CClothNetworkBase::CClothNetworkBase() : mRenderInterpolationFactor(1.0),
+	mClothBaseColor(kMaxColorComponentValue, kMaxColorComponentValue,
+	kMaxColorComponentValue), mClothSpecularity(kMaxColorComponentValue),
+	mMaximumTimeQuantum(0.0), mStableTimeQuantum(0.0), mpSimulationObserver(NULL)
+{
+
+}
+
+CClothNetworkBase::~CClothNetworkBase()
+{
+
+}
+
+
+bool CClothNetworkBase::EvaluateClothNodeNetworkForces(const CExternalNodeForceCollection&
+													   externalNodeForceCollection)
+{
+	// Retain the current network state for interpolation, and evaluate a single step.
+	this->StorePreviousNodeLocations();
+
+	return(this->EvaluateClothNodeNetworkStep(externalNodeForceCollection));
+}
+
+
+bool CClothNetworkBase::AdvanceClothNodeNetwork(const CExternalNodeForceCollection&
+												externalNodeForceCollection,
+												const ScalarType elapsedTime)
+{
+	bool							bAdvancedSuccessfully = false;
+
+	if ((elapsedTime > 0.0) && this->IsValid()) {
+		// Unconditionally stable solvers do not need to observe the stable time
+		// quantum.
+		const bool					bIsUnconditionallyStable = this->IsUnconditionallyStable();
+
+		ScalarType					timeQuantumLimit = 0.0;
+
+		if (!bIsUnconditionallyStable) {
+			if (this->mStableTimeQuantum <= 0.0) {
+				this->mStableTimeQuantum = this->EstimateStableTimeQuantum() *
+					mkStableTimeQuantumSafetyFactor;
+			}
+
+			timeQuantumLimit = this->mStableTimeQuantum;
+		}
+
+		if ((this->mMaximumTimeQuantum > 0.0) && ((timeQuantumLimit <= 0.0) ||
+			(this->mMaximumTimeQuantum < timeQuantumLimit)))
+		{
+			timeQuantumLimit = this->mMaximumTimeQuantum;
+		}
+
+		// Divide the period into equal steps (short periods are evaluated with a single
+		// step)...
+		QuantityType				stepCount = (timeQuantumLimit > 0.0) ?
+			(QuantityType)::ceil(elapsedTime / timeQuantumLimit) : 1;
+		ScalarType					stepTimeQuantum = elapsedTime / (ScalarType)stepCount;
+
+		if (stepCount > mkMaximumStepsPerAdvance) {
+			stepCount = mkMaximumStepsPerAdvance;
+			stepTimeQuantum = timeQuantumLimit;
+		}
+
+		// ...And evaluate each step (the configured time quantum is restored afterwards -
+		// the previous network state spans the entire period).
+		const ScalarType			configuredTimeQuantum = this->GetForceTimeQuantum();
+
+		this->SetForceTimeQuantum(stepTimeQuantum);
+		this->StorePreviousNodeLocations();
+
+		bAdvancedSuccessfully = true;
+
+		for (IndexType stepLoop = 0; stepLoop < stepCount; stepLoop++) {
+			bAdvancedSuccessfully = this->EvaluateClothNodeNetworkStep(
+				externalNodeForceCollection) && bAdvancedSuccessfully;
+		}
+
+		this->SetForceTimeQuantum(configuredTimeQuantum);
+
+		// (The simulated period is shorter than the elapsed time when the number of steps
+		// has been limited.)
+		if (this->mpSimulationObserver) {
+			this->mpSimulationObserver->NotifyNetworkAdvanced(
+				stepTimeQuantum * (ScalarType)stepCount, stepCount, stepTimeQuantum,
+				bIsUnconditionallyStable ? 0.0 : this->mStableTimeQuantum);
+		}
+	}
+
+	return(bAdvancedSuccessfully);
+}
+
+
+bool CClothNetworkBase::SetMaximumTimeQuantum(const ScalarType timeQuantum)
+{
+	bool							bQuantumSetSuccessfully = false;
+
+	if (timeQuantum >= 0.0) {
+		this->mMaximumTimeQuantum = timeQuantum;
+
+		bQuantumSetSuccessfully = true;
+	}
+
+	return(bQuantumSetSuccessfully);
+}
+
+
+void CClothNetworkBase::SetSimulationObserver(CClothSimulationObserver* pSimulationObserver)
+{
+	this->mpSimulationObserver = pSimulationObserver;
+}
+
+
+bool CClothNetworkBase::GenerateNodeNetworkMesh(CStaticMeshBase& nodeNetworkMesh) const
+{
+	bool							bGeneratedSuccessfully = false;
+
+
+	if (this->IsValid())
+	{
+		// Retrieve node network dimensions.
+		const QuantityType			elementsPerRow = this->GetNodesPerRow();
+		const QuantityType			elementsPerColumn = this->GetNodesPerColumn();
+
+		const CVector				kNormalVector(0.0, 0.0, 1.0);
+
+		if ((elementsPerRow > 0) && (elementsPerColumn > 0)) {
+
+			PolygonList				nodeMeshPolygons;
+
+			for (QuantityType xLoop = 0; xLoop < (elementsPerRow - 1); xLoop++) {
+				for (QuantityType yLoop = 0; yLoop < (elementsPerColumn - 1); yLoop++) {
+
+					CFloatPolygon	firstHalfPolygon;
+					CFloatPolygon	secondHalfPolygon;
+					
+					const CFloatPoint
+									upperLeftLocation =
+									this->GetRenderNodeLocation(xLoop, yLoop);
+					const CFloatPoint
+									upperRightLocation =
+									this->GetRenderNodeLocation(xLoop + 1, yLoop);
+					const CFloatPoint
+									lowerLeftLocation =
+									this->GetRenderNodeLocation(xLoop, yLoop + 1);
+					const CFloatPoint
+									lowerRightLocation =
+									this->GetRenderNodeLocation(xLoop + 1, yLoop + 1);
+
+					const ScalarType		uCoordLeft = ((ScalarType)xLoop /
+						(ScalarType)(elementsPerRow - 1));
+					const ScalarType		uCoordRight = ((ScalarType)(xLoop + 1) /
+						(ScalarType)(elementsPerRow - 1));
+					const ScalarType		vCoordTop = ((ScalarType)yLoop /
+						(ScalarType)(elementsPerColumn - 1));
+					const ScalarType		vCoordBottom = ((ScalarType)(yLoop + 1) /
+						(ScalarType)(elementsPerColumn - 1));
+					/*const ScalarType		vCoordTop =
+						(ScalarType)(elementsPerColumn - 2 - yLoop) /
+						(ScalarType)(elementsPerColumn - 1);
+					const ScalarType		vCoordBottom =
+						(ScalarType)(elementsPerColumn - 1 - yLoop) /
+						(ScalarType)(elementsPerColumn - 1);*/
+
+					firstHalfPolygon.AddVertex(
+						CPolygonVertex(upperLeftLocation, kNormalVector,
+						mClothBaseColor, uCoordLeft, vCoordTop));
+					firstHalfPolygon.AddVertex(
+						CPolygonVertex(lowerRightLocation, kNormalVector,
+						mClothBaseColor, uCoordRight, vCoordBottom));
+					firstHalfPolygon.AddVertex(
+						CPolygonVertex(lowerLeftLocation, kNormalVector,
+						mClothBaseColor, uCoordLeft, vCoordBottom));
+
+					secondHalfPolygon.AddVertex(
+						CPolygonVertex(upperLeftLocation, kNormalVector,
+						mClothBaseColor, uCoordLeft, vCoordTop));
+
+					secondHalfPolygon.AddVertex(
+						CPolygonVertex(upperRightLocation, kNormalVector,
+						mClothBaseColor, uCoordRight, vCoordTop));
+
+					secondHalfPolygon.AddVertex(
+						CPolygonVertex(lowerRightLocation, kNormalVector,
+						mClothBaseColor, uCoordRight, vCoordBottom));
+
+
+					// Set the flag color for the current polygon set.
+					firstHalfPolygon.SetLightShading(eShadeDiffuse, this->mClothBaseColor);
+					secondHalfPolygon.SetLightShading(eShadeDiffuse, this->mClothBaseColor);
+					firstHalfPolygon.SetLightShading(eShadeSpecular, this->mClothBaseColor);
+					secondHalfPolygon.SetLightShading(eShadeSpecular, this->mClothBaseColor);
+
+					// Set the flag specularity for the current polygon set.
+					firstHalfPolygon.SetSpecularity(this->mClothSpecularity);
+					secondHalfPolygon.SetSpecularity(this->mClothSpecularity);
+
+
+					nodeMeshPolygons.push_back(firstHalfPolygon);
+					nodeMeshPolygons.push_back(secondHalfPolygon);
+				}
+			}
+
+			if (nodeMeshPolygons.size() > 0)
+			{
+				bGeneratedSuccessfully = nodeNetworkMesh.AdoptModelGeometry(nodeMeshPolygons);
+			}
+		}
+	}
+
+
+	return(bGeneratedSuccessfully);
+}
+
+
+void CClothNetworkBase::GetNodeGridDimensions(QuantityType& nodesPerRow,
+											  QuantityType& nodesPerColumn) const
+{
+	nodesPerRow = this->GetNodesPerRow();
+	nodesPerColumn = this->GetNodesPerColumn();
+}
+
+
+bool CClothNetworkBase::GenerateNodeNetworkVertices(float* pVertexLocation,
+													float* pVertexNormal) const
+{
+	bool							bGeneratedSuccessfully = false;
+
+	const QuantityType				elementsPerRow = this->GetNodesPerRow();
+	const QuantityType				elementsPerColumn = this->GetNodesPerColumn();
+
+	if (this->IsValid() && pVertexLocation && pVertexNormal && (elementsPerRow > 1) &&
+		(elementsPerColumn > 1))
+	{
+		// Store the node locations...
+		for (IndexType yLoop = 0; yLoop < elementsPerColumn; yLoop++) {
+			for (IndexType xLoop = 0; xLoop < elementsPerRow; xLoop++) {
+				const CFloatPoint	nodeLocation = this->GetRenderNodeLocation(xLoop, yLoop);
+				float*				pLocation = pVertexLocation +
+					(((yLoop * elementsPerRow) + xLoop) * 3);
+
+				pLocation[0] = (float)nodeLocation.GetXCoord();
+				pLocation[1] = (float)nodeLocation.GetYCoord();
+				pLocation[2] = (float)nodeLocation.GetZCoord();
+			}
+		}
+
+		// ...And determine each normal from the cross product of the grid tangents (the
+		// differences between the neighbouring nodes along the x and y axes - a flat,
+		// undeformed network faces the positive z-axis).
+		for (IndexType normalYLoop = 0; normalYLoop < elementsPerColumn; normalYLoop++) {
+			const IndexType			previousYIndex = (normalYLoop > 0) ? (normalYLoop - 1) : 0;
+			const IndexType			nextYIndex = (normalYLoop < (elementsPerColumn - 1)) ?
+				(normalYLoop + 1) : normalYLoop;
+
+			for (IndexType normalXLoop = 0; normalXLoop < elementsPerRow; normalXLoop++) {
+				const IndexType		previousXIndex = (normalXLoop > 0) ?
+					(normalXLoop - 1) : 0;
+				const IndexType		nextXIndex = (normalXLoop < (elementsPerRow - 1)) ?
+					(normalXLoop + 1) : normalXLoop;
+
+				const float*		pPreviousX = pVertexLocation +
+					(((normalYLoop * elementsPerRow) + previousXIndex) * 3);
+				const float*		pNextX = pVertexLocation +
+					(((normalYLoop * elementsPerRow) + nextXIndex) * 3);
+				const float*		pPreviousY = pVertexLocation +
+					(((previousYIndex * elementsPerRow) + normalXLoop) * 3);
+				const float*		pNextY = pVertexLocation +
+					(((nextYIndex * elementsPerRow) + normalXLoop) * 3);
+
+				const float			tangentX[3] = { pNextX[0] - pPreviousX[0],
+					pNextX[1] - pPreviousX[1], pNextX[2] - pPreviousX[2] };
+				const float			tangentY[3] = { pNextY[0] - pPreviousY[0],
+					pNextY[1] - pPreviousY[1], pNextY[2] - pPreviousY[2] };
+
+				float				normal[3] = {
+					(tangentX[1] * tangentY[2]) - (tangentX[2] * tangentY[1]),
+					(tangentX[2] * tangentY[0]) - (tangentX[0] * tangentY[2]),
+					(tangentX[0] * tangentY[1]) - (tangentX[1] * tangentY[0]) };
+
+				const float			normalLength = (float)::sqrt((normal[0] * normal[0]) +
+					(normal[1] * normal[1]) + (normal[2] * normal[2]));
+				float*				pNormal = pVertexNormal +
+					(((normalYLoop * elementsPerRow) + normalXLoop) * 3);
+
+				if (normalLength > 0.0f) {
+					pNormal[0] = normal[0] / normalLength;
+					pNormal[1] = normal[1] / normalLength;
+					pNormal[2] = normal[2] / normalLength;
+				}
+				else {
+					pNormal[0] = 0.0f;
+					pNormal[1] = 0.0f;
+					pNormal[2] = 1.0f;
+				}
+			}
+		}
+
+		bGeneratedSuccessfully = true;
+	}
+
+	return(bGeneratedSuccessfully);
+}
+
+
+bool CClothNetworkBase::SetRenderInterpolation(const ScalarType interpolationFactor)
+{
+	bool							bFactorSetSuccessfully = false;
+
+	if ((interpolationFactor >= 0.0) && (interpolationFactor <= 1.0)) {
+		this->mRenderInterpolationFactor = interpolationFactor;
+
+		bFactorSetSuccessfully = true;
+	}
+
+	return(bFactorSetSuccessfully);
+}
+
+// Sets the base color of the cloth (for rendering).
+void CClothNetworkBase::SetClothBaseColor(const CFloatColor& clothColor)
+{
+	// Store the cloth color.
+	this->mClothBaseColor = clothColor;
+}
+
+// Sets the specularity exponent ("shininess") of the cloth (for rendering).
+bool CClothNetworkBase::SetClothSpecularity(const ScalarType specularity)
+{
+	bool							bSpecularitySetSuccessfully = false;
+
+	if((specularity >= kMinSpecularityValue) && (specularity <= kMaxSpecularityValue)) {
+		// Specularity value is within bounds - set the flag specularity.
+		this->mClothSpecularity = specularity;
+		bSpecularitySetSuccessfully = true;
+	}
+
+	return(bSpecularitySetSuccessfully);
+}
+
+
+const CFloatColor& CClothNetworkBase::GetClothBaseColor() const
+{
+	return(this->mClothBaseColor);
+}
+
+
+ScalarType CClothNetworkBase::GetClothSpecularity() const
+{
+	return(this->mClothSpecularity);
+}
+
+
+bool CClothNetworkBase::SetSleepThreshold(const ScalarType /*energyThreshold*/,
+										  const QuantityType /*stepCount*/)
+{
+	// All nodes are evaluated during every step by default.
+	return(false);
+}
+
+
+QuantityType CClothNetworkBase::GetSleepingNodeCount() const
+{
+	return(0);
+}
+
+
+bool CClothNetworkBase::IsUnconditionallyStable() const
+{
+	return(false);
+}
+
+
+void CClothNetworkBase::InvalidateStableTimeQuantum()
+{
+	// The estimate is determined again when the network is next advanced.
+	this->mStableTimeQuantum = 0.0;
+}
+
+
+// Fraction of the estimated stable time quantum used for explicit integration.
+const ScalarType					CClothNetworkBase::mkStableTimeQuantumSafetyFactor = 0.5;
+
+// Maximum number of steps performed when advancing the network over a period of time.
+const QuantityType					CClothNetworkBase::mkMaximumStepsPerAdvance = 64;
@@ -0,0 +1,210 @@
+// ClothNetworkBase.h - Contains declarations common to all cloth network representations (the
+//                      generic node network, and compile-time grid cloths).
+
+#ifndef _CLOTHNETWORKBASE_H
+#define _CLOTHNETWORKBASE_H		1
+
+
+#include "PrimaryHeaders.h"
+#include "PrimitiveSupport.h"
+#include "ModelGeometry.h"
+#include "PhysicalNode.h"
+
+
+// Receives notifications of cloth network simulation progress (instrumentation).
+class CClothSimulationObserver
+{
+public:
+	virtual ~CClothSimulationObserver();
+
+	// Invoked after the cloth network has been advanced over a period of time, with
+	// the period that was simulated (shorter than the requested period when the number
+	// of steps is limited), the number of simulation steps performed, the time quantum
+	// of each step, and the estimated stable time quantum (zero if the solver is
+	// unconditionally stable).
+	virtual void					NotifyNetworkAdvanced(const ScalarType simulatedTime,
+		const QuantityType stepCount, const ScalarType timeQuantum,
+		const ScalarType stableTimeQuantum) = 0;
+};
+
+
+// Simulation statistics (accumulated until the counters are reset).
+class CClothSimulationCounters : public CClothSimulationObserver
+{
+public:
+	CClothSimulationCounters();
+
+	// Accumulates the statistics of a single advancement.
+	void							NotifyNetworkAdvanced(const ScalarType simulatedTime,
+		const QuantityType stepCount, const ScalarType timeQuantum,
+		const ScalarType stableTimeQuantum);
+
+	// Number of times that the network has been advanced, the total number of steps
+	// performed, and the total period that has been simulated (s).
+	QuantityType					mAdvanceCount;
+	QuantityType					mStepCount;
+	ScalarType						mElapsedTime;
+
+	// Time quantum of the most recent step, and the most recent stable time quantum
+	// estimate (zero if the solver is unconditionally stable).
+	ScalarType						mTimeQuantum;
+	ScalarType						mStableTimeQuantum;
+};
+
+
+// Cloth networks consist of a rectangular grid of nodes (nodes are addressed by their
+// x/y grid indices), which are evaluated in discrete steps and rendered as a polygonal
+// mesh. Scenes operate upon cloth networks exclusively through this class.
+class CClothNetworkBase
+{
+public:
+	CClothNetworkBase();
+	virtual ~CClothNetworkBase();
+
+	// Determines if the cloth network is valid.
+	virtual bool					IsValid() const = 0;
+
+	// Sets the anchor node designation flag as specified (when set, forces
+	// applied to the node will not result in node motion).
+	virtual bool					SetAnchorNode(const IndexType xIndex,
+		const IndexType yIndex, const bool bIsAnchorNode) = 0;
+
+	// Sets the unit of time (seconds) used when performing stepwise evaluation of applied
+	// forces in the cloth simulation.
+	virtual bool					SetForceTimeQuantum(const ScalarType timeQuantum) = 0;
+
+	// Retrieves the unit of time (seconds) used for each evaluation step.
+	virtual ScalarType				GetForceTimeQuantum() const = 0;
+
+	// Evaluates all forces being applied to the cloth network (internal and external)
+	// over a single step.
+	bool							EvaluateClothNodeNetworkForces(
+		const CExternalNodeForceCollection&	externalNodeForceCollection);
+
+	// Advances the cloth network over the specified period of time (seconds), dividing
+	// the period into equal steps that do not exceed the stable time quantum (a single
+	// step is used for short periods - periods that require more than the maximum number
+	// of steps are only partially simulated).
+	bool							AdvanceClothNodeNetwork(
+		const CExternalNodeForceCollection&	externalNodeForceCollection,
+		const ScalarType elapsedTime);
+
+	// Estimates the largest time quantum for which explicit integration of the cloth
+	// network remains stable (determined from the spring constants and node masses).
+	virtual ScalarType				EstimateStableTimeQuantum() const = 0;
+
+	// Sets the largest time quantum used when advancing the cloth network over a
+	// period of time (zero removes the limit - the stable time quantum is always
+	// observed by explicit integration).
+	bool							SetMaximumTimeQuantum(const ScalarType timeQuantum);
+
+	// Sets the observer that is notified as the cloth network is advanced (NULL
+	// removes the observer - the observer is not owned by the network).
+	void							SetSimulationObserver(CClothSimulationObserver*
+		pSimulationObserver);
+
+	// Generates a polygonal mesh from the cloth node network.
+	bool							GenerateNodeNetworkMesh(CStaticMeshBase&
+		nodeNetworkMesh) const;
+
+	// Retrieves the number of nodes within each grid row (x-axis) and column (y-axis).
+	void							GetNodeGridDimensions(QuantityType& nodesPerRow,
+		QuantityType& nodesPerColumn) const;
+
+	// Stores the render location of each node, and a unit vertex normal for each node
+	// (determined from the neighbouring nodes), within arrays of three components per
+	// node - nodes are stored in row order, and the arrays must accommodate every node.
+	bool							GenerateNodeNetworkVertices(float* pVertexLocation,
+		float* pVertexNormal) const;
+
+	// Sets the fraction (0.0 - 1.0) of the most recent evaluation period that is
+	// represented by generated meshes - node locations are interpolated between the
+	// previous and current network states (1.0 represents the current state).
+	bool							SetRenderInterpolation(const ScalarType
+		interpolationFactor);
+
+	// Sets the base color of the cloth (for rendering).
+	void							SetClothBaseColor(const CFloatColor& clothColor);
+
+	// Sets the specularity exponent ("shininess") of the cloth (for rendering).
+	bool							SetClothSpecularity(const ScalarType specularity);
+
+	// Retrieves the base color of the cloth.
+	const CFloatColor&				GetClothBaseColor() const;
+
+	// Retrieves the specularity exponent of the cloth.
+	ScalarType						GetClothSpecularity() const;
+
+	// Sets the mean kinetic energy per node (J) below which a region of the cloth is
+	// considered to be at rest, and the number of successive steps for which a region
+	// must remain at rest before it is excluded from evaluation ("sleeps") - a
+	// threshold of zero disables sleeping. Returns false if the network does not
+	// support sleeping regions with its current configuration.
+	virtual bool					SetSleepThreshold(const ScalarType energyThreshold,
+		const QuantityType stepCount);
+
+	// Retrieves the number of nodes within sleeping regions of the cloth.
+	virtual QuantityType			GetSleepingNodeCount() const;
+
+protected:
+
+	// Evaluates all forces being applied to the cloth network over a single step
+	// (the previous network state is not stored).
+	virtual bool					EvaluateClothNodeNetworkStep(
+		const CExternalNodeForceCollection&	externalNodeForceCollection) = 0;
+
+	// Stores the current location of each grid node as the previous network state
+	// (used to interpolate node locations when generating meshes).
+	virtual void					StorePreviousNodeLocations() = 0;
+
+	// Determines if the network is evaluated using a method that remains stable for
+	// any time quantum (explicit integration is assumed by default).
+	virtual bool					IsUnconditionallyStable() const;
+
+	// Discards the stable time quantum estimate (invoked when the springs, node
+	// masses or anchor nodes change).
+	void							InvalidateStableTimeQuantum();
+
+	// Returns the number of nodes within each grid row (x-axis).
+	virtual QuantityType			GetNodesPerRow() const = 0;
+
+	// Returns the number of nodes within each grid column (y-axis).
+	virtual QuantityType			GetNodesPerColumn() const = 0;
+
+	// Retrieves the location of a grid node for rendering, interpolated between the
+	// previous and current network states.
+	virtual CFloatPoint				GetRenderNodeLocation(const IndexType xIndex,
+		const IndexType yIndex) const = 0;
+
+
+	// Fraction of the most recent evaluation period represented by generated meshes.
+	ScalarType						mRenderInterpolationFactor;
+
+	// Base color for the cloth.
+	CFloatColor						mClothBaseColor;
+
+	// Specular highlight exponent.
+	ScalarType						mClothSpecularity;
+
+	// Largest time quantum used when advancing the network over a period of time (zero
+	// if unlimited).
+	ScalarType						mMaximumTimeQuantum;
+
+	// Stable time quantum for explicit integration, including the safety factor (zero
+	// if not yet determined).
+	ScalarType						mStableTimeQuantum;
+
+	// Simulation observer (instrumentation).
+	CClothSimulationObserver*		mpSimulationObserver;
+
+	// Fraction of the estimated stable time quantum used for explicit integration
+	// (external forces are not included in the estimate).
+	static const ScalarType			mkStableTimeQuantumSafetyFactor;
+
+	// Maximum number of steps performed when advancing the network over a period of
+	// time (longer periods are truncated).
+	static const QuantityType		mkMaximumStepsPerAdvance;
+};
+
+
+#endif	// #ifndef _CLOTHNETWORKBASE_H
@@ -33,9 +33,9 @@ CSpringNodeLink::CSpringNodeLink(const ScalarType springConstant,
 
 CSpringNodeLink::~CSpringNodeLink()
 {
-	// Remove all association between cloth nodes (no further
-	// action is required for any previously-linked cloth
-	// nodes after this routine has been exectued).
+	// Remove all association between cloth nodes (spring references
+	// are owned by the cloth network, which releases all springs
+	// at once).
 	this->UnlinkClothNodes();
 }
 
@@ -55,17 +55,24 @@ bool CSpringNodeLink::LinkClothNodes(CClothNode& firstClothNode,
 {
 	bool							bNodesLinkedSuccessfully = false;
 
-	// Store pointers to the cloth nodes.
-	this->mpHeadLink = &firstClothNode;
-	this->mpTailLink = &secondClothNode;
-
-	// Ensure that the cloth nodes are aware of the spring link.
-	bNodesLinkedSuccessfully = firstClothNode.AddAttachedSpring(*this) &&
-		secondClothNode.AddAttachedSpring(*this);
+	// Store pointers to the cloth nodes (the cloth network informs the
+	// nodes of their attached springs once all springs have been created).
+	bNodesLinkedSuccessfully = this->SetHeadLink(&firstClothNode) &&
+		this->SetTailLink(&secondClothNode) && (&firstClothNode != &secondClothNode);
 
 	return(bNodesLinkedSuccessfully);
 }
 
+CClothNode* CSpringNodeLink::GetHeadLink() const
+{
+	return(this->mpHeadLink);
+}
+
+CClothNode* CSpringNodeLink::GetTailLink() const
+{
+	return(this->mpTailLink);
+}
+
 bool CSpringNodeLink::GetForceOnNode(const CClothNode& targetClothNode,
 									 CVector& forceVector) const
 {
@@ -75,23 +82,40 @@ bool CSpringNodeLink::GetForceOnNode(const CClothNode& targetClothNode,
 		this->mpHeadLink &&	this->mpTailLink)
 	{
 
-		const ScalarType			springDisplacement = 
-			this->DistanceBetweenNodes(*(this->mpHeadLink), *(this->mpTailLink)) -
-			this->mRestingLength;
+		// Determine the spring displacement vector (tail to head)...
+		const CFloatPoint			headNodeLocation = (this->mpHeadLink)->GetNodeLocation();
+		const CFloatPoint			tailNodeLocation = (this->mpTailLink)->GetNodeLocation();
 
-		// Spring force = - (Spring Constant x Spring displacement)
-		const ScalarType			springForce = this->mSpringConstant *
-			springDisplacement;
+		const ScalarType			deltaX = headNodeLocation.GetXCoord() -
+			tailNodeLocation.GetXCoord();
+		const ScalarType			deltaY = headNodeLocation.GetYCoord() -
+			tailNodeLocation.GetYCoord();
+		const ScalarType			deltaZ = headNodeLocation.GetZCoord() -
+			tailNodeLocation.GetZCoord();
 
-		// Determine the direction of the force...
-		forceVector.SetAsDisplacementVector((this->mpHeadLink)->GetNodeLocation(),
-			(this->mpTailLink)->GetNodeLocation());
-		forceVector.Normalize();
+		const ScalarType			springLengthSquared = (deltaX * deltaX) +
+			(deltaY * deltaY) + (deltaZ * deltaZ);
+
+		// ...And the force per unit of displacement - Spring force = - (Spring Constant x
+		// Spring displacement), directed along the spring, where the direction and length
+		// are both obtained from the reciprocal of the spring length: k x (L - L0) / L =
+		// k x (1 - (L0 x (1 / L))). Zero-length springs do not produce a force.
+		ScalarType					forceScale = 0.0;
+
+		if (springLengthSquared > 0.0) {
+			const ScalarType		inverseSpringLength = 1.0 / ::sqrt(springLengthSquared);
+
+			forceScale = this->mSpringConstant * (1.0 - (this->mRestingLength *
+				inverseSpringLength));
+		}
 
 		// Compute the final force vector (reverse the force direction, depending upon
 		// which end of the spring the node resides upon).
-		forceVector = (this->mpHeadLink == &targetClothNode) ?
-			(forceVector * -springForce) : (forceVector * springForce);
+		const ScalarType			nodeForceScale = (this->mpHeadLink == &targetClothNode) ?
+			-forceScale : forceScale;
+
+		forceVector = CVector(deltaX * nodeForceScale, deltaY * nodeForceScale,
+			deltaZ * nodeForceScale);
 
 		bForceObtainedSuccessfully = true;
 	}
@@ -110,18 +134,15 @@ bool CSpringNodeLink::UnlinkClothNodes()
 {
 	bool							bRemovedSuccessfully = false;
 
-	// Notify attached springs to remove the spring reference
-	// from their internal list, effectively breaking the
-	// link between the spring and the cloth node.
+	// Break the link between the spring and the cloth nodes (the
+	// node/spring adjacency list is maintained by the cloth network).
 	if (this->mpHeadLink) {
-		(*(this->mpHeadLink)).RemoveAttachedSpring(*this);
 		mpHeadLink = NULL;
 
 		bRemovedSuccessfully = true;
 	}
 
 	if (this->mpTailLink) {
-		mpTailLink->RemoveAttachedSpring(*this);
 		mpTailLink = NULL;
 	}
 	else {
@@ -183,7 +204,7 @@ ScalarType	CSpringNodeLink::DistanceBetweenNodes(const CClothNode& firstClothNod
 // CClothNode class
 /////
 CClothNode::CClothNode() :
-	CPhysicalNodeBase()
+	CPhysicalNodeBase(), mpAttachedSprings(NULL), mAttachedSpringCount(0)
 {
 	// Copy constructor
 }
@@ -191,9 +212,10 @@ CClothNode::CClothNode() :
 
 CClothNode::CClothNode(const CFloatPoint& initialLocation, 
 					   const ScalarType nodeMass, const bool bIsAnchorNode) :
-	CPhysicalNodeBase(initialLocation, nodeMass, bIsAnchorNode)
+	CPhysicalNodeBase(initialLocation, nodeMass, bIsAnchorNode),
+	mpAttachedSprings(NULL), mAttachedSpringCount(0)
 {
-	this->mAttachedSprings.clear();
+
 }
 
 CClothNode::~CClothNode()
@@ -207,7 +229,7 @@ bool CClothNode::IsValid() const
 	// The node must have springs attached, and have
 	// a non-zero mass in order to be valid.
 	const bool						bSpringsAttached =
-		(this->mAttachedSprings.size() > 0);
+		(this->mpAttachedSprings && (this->mAttachedSpringCount > 0));
 
 	const bool						bMassValid = 
 		CPhysicalNodeBase::IsValid();
@@ -216,64 +238,37 @@ bool CClothNode::IsValid() const
 	return(bSpringsAttached && bMassValid);
 }
 
-// Attaches a spring to the current node.
-bool CClothNode::AddAttachedSpring(CSpringNodeLink& targetSpring)
+void CClothNode::SetAttachedSprings(CSpringNodeLink* const* pAttachedSprings,
+									const QuantityType attachedSpringCount)
 {
-	bool							bAddedSuccessfully = false;
-
-	// Determine if the spring exists in the list already...
-	SpringNodeLinkList::iterator	springListIterator;
-		
-	springListIterator = std::find(this->mAttachedSprings.begin(), this->mAttachedSprings.end(),
-		&targetSpring);
-
-	// ...If the spring does not exist in the list, add it to the list.
-	if (springListIterator == mAttachedSprings.end())
-	{
-		this->mAttachedSprings.push_back(&targetSpring);
-		bAddedSuccessfully = true;
-	}
-
-	return(bAddedSuccessfully);
+	// Store the spring references.
+	this->mpAttachedSprings = pAttachedSprings;
+	this->mAttachedSpringCount = pAttachedSprings ? attachedSpringCount : 0;
 }
 
-// Removes a spring from the current node.
-bool CClothNode::RemoveAttachedSpring(CSpringNodeLink& attachedSpring)
+QuantityType CClothNode::GetAttachedSpringCount() const
 {
-	bool							bRemovedSuccessfully = false;
-
-	// Attempt to find the spring in the spring list...
-	SpringNodeLinkList::iterator	springListIterator;
-		
-	springListIterator = std::find(this->mAttachedSprings.begin(), this->mAttachedSprings.end(),
-		&attachedSpring);
-
-	// ...Remove the spring from the list of springs.
-	if (springListIterator != mAttachedSprings.end())
-	{
-		this->mAttachedSprings.erase(springListIterator);
-	}
-
-	return(bRemovedSuccessfully);
+	return(this->mAttachedSpringCount);
 }
 
 
 bool CClothNode::SumAttachedSpringForces()
 {
 	bool							bForcesSummedSuccessfully =
-		!this->mAttachedSprings.empty();
+		(this->mAttachedSpringCount > 0);
 
 	CVector							springForceSum(0.0, 0.0, 0.0);
 	CVector							currentSpringForce(0.0, 0.0, 0.0);
 
 	// Iterate through the list of attached springs...
-	for (SpringNodeLinkList::iterator springListIterator = (this->mAttachedSprings).begin();
-		springListIterator != (this->mAttachedSprings).end(); springListIterator++)
+	for (IndexType springLoop = 0; springLoop < this->mAttachedSpringCount; springLoop++)
 	{
 		// Sum the forces imposed by all attached springs.
-		bForcesSummedSuccessfully = (*springListIterator)->GetForceOnNode(*this,
-			currentSpringForce);
-		if (*springListIterator && bForcesSummedSuccessfully)
+		const CSpringNodeLink*		pAttachedSpring = this->mpAttachedSprings[springLoop];
+
+		bForcesSummedSuccessfully = pAttachedSpring &&
+			pAttachedSpring->GetForceOnNode(*this, currentSpringForce);
+		if (bForcesSummedSuccessfully)
 		{
 			springForceSum = springForceSum + currentSpringForce;
 		}
@@ -285,23 +280,43 @@ bool CClothNode::SumAttachedSpringForces()
 	return(bForcesSummedSuccessfully);
 }
 
-CClothNode CClothNode::operator=(const CClothNode& clothNode)
+void CClothNode::RestoreNodeState(const CFloatPoint& nodeLocation,
+								  const CVector& velocityVector)
+{
+	// Set the node location and velocity (anchor nodes will retain their
+	// current state).
+	this->SetNodeLocation(nodeLocation);
+	this->SetNodeVelocityVector(velocityVector);
+}
+
+CClothNode& CClothNode::operator=(const CClothNode& clothNode)
+{
+	// Copy the physical node data resident in the source cloth node class (the
+	// node mass is constant, so the physical node data is copied directly)...
+	if (this != &clothNode) {
+		::memcpy((CPhysicalNodeBase*)this, (const CPhysicalNodeBase*)&clothNode,
+			sizeof(CPhysicalNodeBase));
+	}
+
+	// ...The attached springs are not copied (the springs reference the source
+	// node).
+
+	return(*this);
+}
+
+
+/////
+// CClothSleepRegion class
+/////
+CClothSleepRegion::CClothSleepRegion() : mbIsSleeping(false), mRestStepCount(0),
+	mKineticEnergy(0.0), mFreeNodeCount(0), mSampleNodeIndex(0), mSampleForce(0.0, 0.0, 0.0)
 {
-	// Copy the data resident in the source cloth node class.
-	::memcpy(this, &clothNode, sizeof(*this) - sizeof(this->mAttachedSprings));
 
-	//this->mNodeLocation = clothNode.mNodeLocation;
-	//this->mNodeMass = clothNode.mNodeMass;
-	//this->mPendingForceVector = clothNode.mPendingForceVector;
-	//this->mVelocityVector = clothNode.mVelocityVector;
-	//this->mbIsAnchorNode = clothNode.mbIsAnchorNode;
+}
 
-	// ...Explicitly copy the node list data - (this structure
-	// will be invalid if the source class is destroyed).
-	//this->mAttachedSprings.clear();
-	//this->mAttachedSprings = clothNode.mAttachedSprings;
+CClothSleepRegion::~CClothSleepRegion()
+{
 
-	return(clothNode);
 }
 
 
@@ -319,8 +334,11 @@ CClothNodeNetwork::CClothNodeNetwork(const QuantityType elementsPerRow,
 	mNodeNetworkHeight(mNodeNetworkHeight), mNetworkCoordOffset(networkCoordOffset), 
 	mNodeMass(nodeMass), mStructSpringConstant(structSpringConstant),
 	mShearSpringConstant(shearSpringConstant), mFlexionSpringConstant(flexionSpringConstant),
-	mForceTimeQuantum(0.0), mClothBaseColor(kMaxColorComponentValue, kMaxColorComponentValue,
-	kMaxColorComponentValue), mClothSpecularity(kMaxColorComponentValue)
+	mForceTimeQuantum(0.0), mNodeIntegrator(eNodeIntegratorEuler),
+	mIntegratorDampingFactor(0.0), mSolverMode(eClothSolverNodeLinked),
+	mpSpringArraySolver(CClothSpringArraySolver::CreateSpringArraySolver(
+	eSolverPrecisionDouble)), mpWorkerThreadPool(NULL), mpCurrentExternalForceCollection(NULL),
+	mSleepEnergyThreshold(0.0), mSleepStepCount(0), mSleepingNodeCount(0)
 {
 	// Construct the cloth network.
 	AssertExpression(BuildClothNodeNetwork());
@@ -330,6 +348,15 @@ CClothNodeNetwork::~CClothNodeNetwork()
 {
 	// Destroy the created cloth network.s
 	DestroyClothNodeNetwork();
+
+	// Release the worker threads.
+	this->SetWorkerThreadCount(1);
+
+	// Release the spring array solver.
+	if (this->mpSpringArraySolver) {
+		delete(this->mpSpringArraySolver);
+		this->mpSpringArraySolver = NULL;
+	}
 }
 
 	
@@ -362,6 +389,17 @@ bool CClothNodeNetwork::SetAnchorNode (const IndexType xIndex,
 			pTargetClothNode->SetAnchorNodeStatus(bIsAnchorNode);
 		}
 
+		// The spring array solver maintains a separate copy of the node state.
+		this->mpSpringArraySolver->SetAnchorNodeStatus(this->GetNodeArrayIndex(xIndex,
+			yIndex), bIsAnchorNode);
+
+		// Anchor node changes disturb the surrounding region.
+		this->SetSleepRegionStatus(this->GetNodeSleepRegionIndex(xIndex, yIndex), false);
+		this->UpdateSleepRegionFreeNodes();
+
+		// The stable time quantum depends upon the set of free nodes.
+		this->InvalidateStableTimeQuantum();
+
 		bAnchorNodeSet = true;
 
 	}
@@ -370,13 +408,16 @@ bool CClothNodeNetwork::SetAnchorNode (const IndexType xIndex,
 }
 
 
-bool CClothNodeNetwork::GenerateNodeNetworkMesh(CStaticMeshBase& nodeNetworkMesh) const
+bool CClothNodeNetwork::EvaluateClothNodeNetworkStep(const CExternalNodeForceCollection&
+													 externalNodeForceCollection)
 {
-	bool							bGeneratedSuccessfully = false;
-
+	bool							bEvaluatedSuccessfully = false;
 
-	if (this->IsValid())
-	{
+	if (this->IsValid() && (this->mSolverMode != eClothSolverNodeLinked)) {
+		// Evaluate the network using the contiguous node/spring arrays.
+		bEvaluatedSuccessfully = this->EvaluateSpringArrayForces(externalNodeForceCollection);
+	}
+	else if (this->IsValid()) {
 		// Retrieve node network dimensions (stored in grid during object
 		// construction).
 		const QuantityType			elementsPerRow =
@@ -384,133 +425,40 @@ bool CClothNodeNetwork::GenerateNodeNetworkMesh(CStaticMeshBase& nodeNetworkMesh
 		const QuantityType			elementsPerColumn = 
 			this->mClothNodeGrid.GetColumnSize();
 
-		const CVector				kNormalVector(0.0, 0.0, 1.0);
+		// Surface forces depend upon the entire grid, and are evaluated before the
+		// forces of the individual nodes.
+		const bool					bApplySurfaceForces =
+			this->EvaluateSurfaceForces(externalNodeForceCollection);
 
-		if ((elementsPerRow > 0) && (elementsPerColumn > 0)) {
+		// Iterate through the nodes in the cloth node network (the nodes within
+		// each row are contiguous)...
+		for (QuantityType yLoop = 0; yLoop < (elementsPerColumn); yLoop++) {
+			CClothNode*				pClothNodeRow = this->mClothNodeGrid.GetRowSpan(yLoop);
 
-			PolygonList				nodeMeshPolygons;
-
-			for (QuantityType xLoop = 0; xLoop < (elementsPerRow - 1); xLoop++) {
-				for (QuantityType yLoop = 0; yLoop < (elementsPerColumn - 1); yLoop++) {
-
-					CFloatPolygon	firstHalfPolygon;
-					CFloatPolygon	secondHalfPolygon;
-					
-					const CClothNode*
-									pUpperLeftNode = 
-									this->mClothNodeGrid.GetElementAt(xLoop, yLoop);
-					const CClothNode*
-									pUpperRightNode = 
-									this->mClothNodeGrid.GetElementAt(xLoop + 1, yLoop);
-					const CClothNode*
-									pLowerLeftNode =
-									this->mClothNodeGrid.GetElementAt(xLoop, yLoop + 1);
-					const CClothNode*
-									pLowerRightNode = 
-									this->mClothNodeGrid.GetElementAt(xLoop + 1, yLoop + 1);
-
-					const ScalarType		uCoordLeft = ((ScalarType)xLoop /
-						(ScalarType)(elementsPerRow - 1));
-					const ScalarType		uCoordRight = ((ScalarType)(xLoop + 1) /
-						(ScalarType)(elementsPerRow - 1));
-					const ScalarType		vCoordTop = ((ScalarType)yLoop /
-						(ScalarType)(elementsPerColumn - 1));
-					const ScalarType		vCoordBottom = ((ScalarType)(yLoop + 1) /
-						(ScalarType)(elementsPerColumn - 1));
-					/*const ScalarType		vCoordTop =
-						(ScalarType)(elementsPerColumn - 2 - yLoop) /
-						(ScalarType)(elementsPerColumn - 1);
-					const ScalarType		vCoordBottom =
-						(ScalarType)(elementsPerColumn - 1 - yLoop) /
-						(ScalarType)(elementsPerColumn - 1);*/
-
-					if (pUpperLeftNode && pUpperRightNode && pLowerLeftNode && pLowerRightNode) {
-						firstHalfPolygon.AddVertex(
-							CPolygonVertex(pUpperLeftNode->GetNodeLocation(), kNormalVector,
-							mClothBaseColor, uCoordLeft, vCoordTop));
-						firstHalfPolygon.AddVertex(
-							CPolygonVertex(pLowerRightNode->GetNodeLocation(), kNormalVector,
-							mClothBaseColor, uCoordRight, vCoordBottom));
-						firstHalfPolygon.AddVertex(
-							CPolygonVertex(pLowerLeftNode->GetNodeLocation(), kNormalVector,
-							mClothBaseColor, uCoordLeft, vCoordBottom));
-
-						secondHalfPolygon.AddVertex(
-							CPolygonVertex(pUpperLeftNode->GetNodeLocation(), kNormalVector,
-							mClothBaseColor, uCoordLeft, vCoordTop));
-
-						secondHalfPolygon.AddVertex(
-							CPolygonVertex(pUpperRightNode->GetNodeLocation(), kNormalVector,
-							mClothBaseColor, uCoordRight, vCoordTop));
-
-						secondHalfPolygon.AddVertex(
-							CPolygonVertex(pLowerRightNode->GetNodeLocation(), kNormalVector,
-							mClothBaseColor, uCoordRight, vCoordBottom));
-
-
-						// Set the flag color for the current polygon set.
-						firstHalfPolygon.SetLightShading(eShadeDiffuse, this->mClothBaseColor);
-						secondHalfPolygon.SetLightShading(eShadeDiffuse, this->mClothBaseColor);
-						firstHalfPolygon.SetLightShading(eShadeSpecular, this->mClothBaseColor);
-						secondHalfPolygon.SetLightShading(eShadeSpecular, this->mClothBaseColor);
-
-						// Set the flag specularity for the current polygon set.
-						firstHalfPolygon.SetSpecularity(this->mClothSpecularity);
-						secondHalfPolygon.SetSpecularity(this->mClothSpecularity);
-
-
-						nodeMeshPolygons.push_back(firstHalfPolygon);
-						nodeMeshPolygons.push_back(secondHalfPolygon);
-					}
-				}
-			}
-
-			if (nodeMeshPolygons.size() > 0)
-			{
-				bGeneratedSuccessfully = nodeNetworkMesh.SetModelGeometry(nodeMeshPolygons);
-			}
-		}
-	}
+			for (QuantityType xLoop = 0; pClothNodeRow && (xLoop < elementsPerRow); xLoop++) {
+				CClothNode&			currentClothNode = pClothNodeRow[xLoop];
+				CVector				resultantForceVector;
 
+				// First, evaluate external forces for each node.
+				externalNodeForceCollection.EvaluateExternalForces(currentClothNode,
+					resultantForceVector, this->mForceTimeQuantum);
 
-	return(bGeneratedSuccessfully);
-}
+				if (bApplySurfaceForces) {
+					const IndexType	gridNodeIndex = (yLoop * elementsPerRow) + xLoop;
 
+					resultantForceVector = resultantForceVector + CVector(
+						this->mSurfaceForceGrid.mNodeForceX[gridNodeIndex],
+						this->mSurfaceForceGrid.mNodeForceY[gridNodeIndex],
+						this->mSurfaceForceGrid.mNodeForceZ[gridNodeIndex]);
+				}
 
-bool CClothNodeNetwork::EvaluateClothNodeNetworkForces(const CExternalNodeForceCollection&
-													   externalNodeForceCollection)
-{
-	bool							bEvaluatedSuccessfully = false;
+				currentClothNode.SetForceVector(resultantForceVector);
 
-	if (this->IsValid()) {
-		// Retrieve node network dimensions (stored in grid during object
-		// construction).
-		const QuantityType			elementsPerRow =
-			this->mClothNodeGrid.GetRowSize();
-		const QuantityType			elementsPerColumn = 
-			this->mClothNodeGrid.GetColumnSize();
+				// Now, evaluate internal network (spring) forces for each node.
+				currentClothNode.SumAttachedSpringForces();
 
-		
 
-		// Iterate through the nodes in the cloth node network...
-		for (QuantityType yLoop = 0; yLoop < (elementsPerColumn); yLoop++) {
-			for (QuantityType xLoop = 0; xLoop < (elementsPerRow); xLoop++) {
-				CClothNode*			pCurrentClothNode =
-					this->mClothNodeGrid.GetElementAt(xLoop, yLoop);
-				
-				if (pCurrentClothNode) {
-					CVector			resultantForceVector;
-					// First, evaluate external forces for each node.
-					externalNodeForceCollection.EvaluateExternalForces(*pCurrentClothNode,
-						resultantForceVector, this->mForceTimeQuantum);
-					pCurrentClothNode->SetForceVector(resultantForceVector);
-
-					// Now, evaluate internal network (spring) forces for each node.
-					pCurrentClothNode->SumAttachedSpringForces();
-
-
-					bEvaluatedSuccessfully = true;
-				}
+				bEvaluatedSuccessfully = true;
 			}
 		}
 
@@ -518,15 +466,22 @@ bool CClothNodeNetwork::EvaluateClothNodeNetworkForces(const CExternalNodeForceC
 
 		// Apply the forces to each node in the network.
 		for (QuantityType yLoopApply = 0; yLoopApply < (elementsPerColumn); yLoopApply++) {
-			for (QuantityType xLoopApply = 0; xLoopApply < (elementsPerRow); xLoopApply++) {
-				CClothNode*			pCurrentClothNode =
-					this->mClothNodeGrid.GetElementAt(xLoopApply, yLoopApply);
-				
-				if (pCurrentClothNode) {
-					pCurrentClothNode->ApplyForceVector(this->mForceTimeQuantum);
-	
-					bEvaluatedSuccessfully = true;
+			CClothNode*				pClothNodeRow = this->mClothNodeGrid.GetRowSpan(yLoopApply);
+
+			for (QuantityType xLoopApply = 0; pClothNodeRow && (xLoopApply < elementsPerRow);
+				xLoopApply++)
+			{
+				// (Implicit integration is only performed by the spring array solver -
+				// nodes are otherwise integrated using explicit Euler integration).
+				if (this->mNodeIntegrator == eNodeIntegratorVerlet) {
+					pClothNodeRow[xLoopApply].ApplyForceVectorVerlet(this->mForceTimeQuantum,
+						this->mIntegratorDampingFactor);
 				}
+				else {
+					pClothNodeRow[xLoopApply].ApplyForceVector(this->mForceTimeQuantum);
+				}
+	
+				bEvaluatedSuccessfully = true;
 			}
 		}
 						
@@ -549,27 +504,214 @@ bool CClothNodeNetwork::SetForceTimeQuantum(const ScalarType timeQuantum)
 	return(bQuantumSetSuccessfully);
 }
 
-// Sets the base color of the cloth (for rendering).
-void CClothNodeNetwork::SetClothBaseColor(const CFloatColor& clothColor)
+ScalarType CClothNodeNetwork::GetForceTimeQuantum() const
 {
-	// Store the cloth color.
-	this->mClothBaseColor = clothColor;
+	return(this->mForceTimeQuantum);
 }
 
-// Sets the specularity exponent ("shininess") of the cloth (for rendering).
-bool CClothNodeNetwork::SetClothSpecularity(const ScalarType specularity)
+ScalarType CClothNodeNetwork::EstimateStableTimeQuantum() const
 {
-	bool							bSpecularitySetSuccessfully = false;
+	// The spring array solver contains all springs (regardless of the solver mode),
+	// along with the node masses and anchor node designations.
+	return(this->mpSpringArraySolver->EstimateStableTimeQuantum());
+}
 
-	if((specularity >= kMinSpecularityValue) && (specularity <= kMaxSpecularityValue)) {
-		// Specularity value is within bounds - set the flag specularity.
-		this->mClothSpecularity = specularity;
-		bSpecularitySetSuccessfully = true;
+bool CClothNodeNetwork::SetNodeIntegrator(const ENodeIntegrator nodeIntegrator,
+										  const ScalarType dampingFactor)
+{
+	// The spring array solver validates the damping factor.
+	const bool						bIntegratorSetSuccessfully =
+		this->mpSpringArraySolver->SetNodeIntegrator(nodeIntegrator, dampingFactor);
+
+	if (bIntegratorSetSuccessfully) {
+		this->mNodeIntegrator = nodeIntegrator;
+		this->mIntegratorDampingFactor = dampingFactor;
 	}
 
-	return(bSpecularitySetSuccessfully);
+	return(bIntegratorSetSuccessfully);
 }
 
+ENodeIntegrator CClothNodeNetwork::GetNodeIntegrator() const
+{
+	// Return the active node integration method.
+	return(this->mNodeIntegrator);
+}
+
+bool CClothNodeNetwork::SetConstraintSolver(const EConstraintSolverMethod
+											constraintSolverMethod,
+											const QuantityType iterationCount)
+{
+	return(this->mpSpringArraySolver->SetConstraintSolver(constraintSolverMethod,
+		iterationCount));
+}
+
+bool CClothNodeNetwork::SetStrainLimit(const ScalarType maximumElongation,
+									   const QuantityType iterationCount)
+{
+	// Strain limiting is performed using the flat spring list of the spring array
+	// solver.
+	return(this->mpSpringArraySolver->SetStrainLimit(maximumElongation, iterationCount));
+}
+
+bool CClothNodeNetwork::SetSolverMode(const EClothSolverMode solverMode)
+{
+	bool							bSolverModeSet = false;
+
+	if (solverMode == this->mSolverMode) {
+		bSolverModeSet = true;
+	}
+	else if (this->mSolverMode != eClothSolverNodeLinked) {
+		// The node state resides within the node arrays - transfer the node state back
+		// to the grid nodes if required.
+		bSolverModeSet = (solverMode != eClothSolverNodeLinked) ||
+			this->CopyNodeStateFromSpringArray();
+	}
+	else if ((solverMode == eClothSolverSpringArray) ||
+		(solverMode == eClothSolverPositionBased))
+	{
+		// Transfer the current node state to the node arrays.
+		bSolverModeSet = this->CopyNodeStateToSpringArray();
+	}
+
+	if (bSolverModeSet) {
+		// Regions re-enter sleep using the selected solver (the node-linked solver
+		// evaluates every node).
+		this->WakeAllSleepRegions();
+
+		if (solverMode == eClothSolverNodeLinked) {
+			this->mSleepEnergyThreshold = 0.0;
+		}
+
+		this->mSolverMode = solverMode;
+	}
+
+	return(bSolverModeSet);
+}
+
+EClothSolverMode CClothNodeNetwork::GetSolverMode() const
+{
+	// Return the active solver mode.
+	return(this->mSolverMode);
+}
+
+bool CClothNodeNetwork::SetSolverPrecision(const ESolverPrecision solverPrecision)
+{
+	bool							bPrecisionSetSuccessfully =
+		(solverPrecision == this->GetSolverPrecision());
+
+	if (!bPrecisionSetSuccessfully) {
+		// Create a solver with the specified precision, and transfer the nodes, springs
+		// and configuration of the current solver.
+		CClothSpringArraySolver*	pSpringArraySolver =
+			CClothSpringArraySolver::CreateSpringArraySolver(solverPrecision);
+
+		if (pSpringArraySolver &&
+			pSpringArraySolver->CopySpringArraySolver(*this->mpSpringArraySolver))
+		{
+			delete(this->mpSpringArraySolver);
+			this->mpSpringArraySolver = pSpringArraySolver;
+
+			// Nodes are not transferred in a sleeping state.
+			this->WakeAllSleepRegions();
+
+			bPrecisionSetSuccessfully = true;
+		}
+		else if (pSpringArraySolver) {
+			delete(pSpringArraySolver);
+		}
+	}
+
+	return(bPrecisionSetSuccessfully);
+}
+
+ESolverPrecision CClothNodeNetwork::GetSolverPrecision() const
+{
+	return(this->mpSpringArraySolver->GetSolverPrecision());
+}
+
+void CClothNodeNetwork::SetApproximateSpringLengths(const bool bApproximateSpringLengths)
+{
+	// The setting is retained when the solver precision changes.
+	this->mpSpringArraySolver->SetApproximateSpringLengths(bApproximateSpringLengths);
+}
+
+bool CClothNodeNetwork::UsesApproximateSpringLengths() const
+{
+	return(this->mpSpringArraySolver->UsesApproximateSpringLengths());
+}
+
+bool CClothNodeNetwork::SetWorkerThreadCount(const QuantityType threadCount)
+{
+	bool							bThreadCountSetSuccessfully = false;
+
+	// Release any existing worker threads.
+	this->mpSpringArraySolver->SetWorkerThreadPool(NULL, this->mClothNodeGrid.GetRowSize());
+
+	if (this->mpWorkerThreadPool) {
+		delete(this->mpWorkerThreadPool);
+		this->mpWorkerThreadPool = NULL;
+	}
+
+	if (threadCount > 1) {
+		this->mpWorkerThreadPool = new /*(std::nothrow)*/ CWorkerThreadPool(threadCount);
+
+		if (this->mpWorkerThreadPool && this->mpWorkerThreadPool->IsValid()) {
+			// Nodes are integrated in blocks of rows.
+			bThreadCountSetSuccessfully = this->mpSpringArraySolver->SetWorkerThreadPool(
+				this->mpWorkerThreadPool, this->mClothNodeGrid.GetRowSize());
+		}
+		else if (this->mpWorkerThreadPool) {
+			delete(this->mpWorkerThreadPool);
+			this->mpWorkerThreadPool = NULL;
+		}
+	}
+	else {
+		// Single-threaded evaluation.
+		bThreadCountSetSuccessfully = (threadCount > 0);
+	}
+
+	return(bThreadCountSetSuccessfully);
+}
+
+QuantityType CClothNodeNetwork::GetWorkerThreadCount() const
+{
+	return(this->mpWorkerThreadPool ? this->mpWorkerThreadPool->GetThreadCount() : 1);
+}
+
+bool CClothNodeNetwork::SetSleepThreshold(const ScalarType energyThreshold,
+										  const QuantityType stepCount)
+{
+	bool							bThresholdSetSuccessfully = false;
+
+	// Nodes are placed into sleep by the spring array solvers.
+	if ((this->mSolverMode != eClothSolverNodeLinked) && (energyThreshold >= 0.0) &&
+		((energyThreshold == 0.0) || (stepCount > 0)))
+	{
+		this->mSleepEnergyThreshold = energyThreshold;
+		this->mSleepStepCount = stepCount;
+
+		// Regions re-enter sleep using the new threshold.
+		this->WakeAllSleepRegions();
+
+		bThresholdSetSuccessfully = true;
+	}
+
+	return(bThresholdSetSuccessfully);
+}
+
+QuantityType CClothNodeNetwork::GetSleepingNodeCount() const
+{
+	return(this->mSleepingNodeCount);
+}
+
+void CClothNodeNetwork::ExecuteRange(const IndexType firstIndex, const IndexType endIndex)
+{
+	// Evaluate external forces for a block of free nodes.
+	if (this->mpCurrentExternalForceCollection) {
+		this->EvaluateExternalForceRange(*this->mpCurrentExternalForceCollection,
+			firstIndex, endIndex);
+	}
+}
 
 bool CClothNodeNetwork::BuildClothNodeNetwork()
 {
@@ -614,10 +756,26 @@ bool CClothNodeNetwork::BuildClothNodeNetwork()
 				}
 			}
 
+			// Allocate the array representation of the network (springs are added
+			// to the arrays as they are linked), and the spring storage.
+			bNetworkBuiltSuccessfully = this->mpSpringArraySolver->AllocateNodes(elementsPerRow *
+				elementsPerColumn) && this->mSpringPool.Reserve(
+				this->GetNetworkSpringCapacity()) && bNetworkBuiltSuccessfully;
+
 			// Link the nodes with springs that are essential to performing the
-			// cloth motion simulation.
+			// cloth motion simulation, and inform the nodes of their attached
+			// springs.
 			bNetworkBuiltSuccessfully = this->LinkClothNodeNetworkSprings(true,
-				true, true) && bNetworkBuiltSuccessfully;
+				true, true) && this->BuildNodeSpringAdjacency() &&
+				bNetworkBuiltSuccessfully;
+
+			bNetworkBuiltSuccessfully = this->CopyNodeStateToSpringArray() &&
+				bNetworkBuiltSuccessfully;
+
+			// Divide the grid into sleeping regions (regions are initially awake).
+			this->mSleepRegion.assign(this->GetSleepRegionsPerRow() * ((elementsPerColumn +
+				mkSleepRegionSize - 1) / mkSleepRegionSize), CClothSleepRegion());
+			this->UpdateSleepRegionFreeNodes();
 		}
 	}
 
@@ -633,7 +791,7 @@ bool CClothNodeNetwork::LinkClothNodeNetworkSprings(const bool bUseStruturalSpri
 
 	// Interval between nodes for flexion spring connections (horizontal and vertical,
 	// respectively).
-	const QuantityType				kFlexionSpringXStride = 3;
+	const QuantityType				kFlexionSpringXStride = 2;
 	const QuantityType				kFlexionSpringYStride = kFlexionSpringXStride;
 	
 	if (this->mClothNodeGrid.IsValid())
@@ -645,9 +803,6 @@ bool CClothNodeNetwork::LinkClothNodeNetworkSprings(const bool bUseStruturalSpri
 		const QuantityType			elementsPerColumn = 
 			this->mClothNodeGrid.GetColumnSize();
 
-		CClothNode*					pFirstClothNode = NULL;
-		CClothNode*					pSecondClothNode = NULL;
-
 		if ((elementsPerRow > 0) && (elementsPerColumn > 0)) {
 
 			bLinkedSuccessfully = true;
@@ -655,112 +810,711 @@ bool CClothNodeNetwork::LinkClothNodeNetworkSprings(const bool bUseStruturalSpri
 			for (QuantityType xLoop = 0; xLoop < elementsPerRow; xLoop++) {
 				for (QuantityType yLoop = 0; yLoop < elementsPerColumn; yLoop++) {
 
-					pFirstClothNode = this->mClothNodeGrid.GetElementAt(xLoop, yLoop);
-
 					// Create structural springs.
-
-					if (pFirstClothNode) {
+					if (bUseStruturalSprings) {
 						// Create inter-column structural spring.
 						if ((xLoop + 1) < elementsPerRow) {
-							pSecondClothNode = this->mClothNodeGrid.GetElementAt(xLoop + 1, yLoop);
-							
-							if (pSecondClothNode) {
-								CSpringNodeLink*
-										pSpringNodeLink = new /*(std::nothrow)*/ CSpringNodeLink(*pFirstClothNode,
-											*pSecondClothNode, this->mStructSpringConstant);
-
-								bLinkedSuccessfully = pSpringNodeLink && bLinkedSuccessfully;
-							}
+							bLinkedSuccessfully = this->CreateSpringLink(xLoop, yLoop,
+								xLoop + 1, yLoop, this->mStructSpringConstant) &&
+								bLinkedSuccessfully;
 						}
 
 						// Create inter-row structural spring.
 						if ((yLoop + 1) < elementsPerColumn) {
-							pSecondClothNode = this->mClothNodeGrid.GetElementAt(xLoop,
-								yLoop + 1);
+							bLinkedSuccessfully = this->CreateSpringLink(xLoop, yLoop,
+								xLoop, yLoop + 1, this->mStructSpringConstant) &&
+								bLinkedSuccessfully;
+						}
+					}
 
-							CSpringNodeLink*
-								pSpringNodeLink = new /*(std::nothrow)*/ CSpringNodeLink(*pFirstClothNode,
-								*pSecondClothNode, this->mStructSpringConstant);
+					// Create shear springs.
+					if (bUseShearSprings && ((xLoop + 1) < elementsPerRow) &&
+						((yLoop + 1) < elementsPerColumn))
+					{
+						// Create inter-column shear spring.
+						bLinkedSuccessfully = this->CreateSpringLink(xLoop, yLoop,
+							xLoop + 1, yLoop + 1, this->mShearSpringConstant) &&
+							bLinkedSuccessfully;
+
+						// Create inter-row shear spring.
+						bLinkedSuccessfully = this->CreateSpringLink(xLoop, yLoop + 1,
+							xLoop + 1, yLoop, this->mShearSpringConstant) &&
+							bLinkedSuccessfully;
+					}
 
-							bLinkedSuccessfully = pSpringNodeLink && bLinkedSuccessfully;
+					// Create flexion springs.
+					if (bUseFlexionSprings) {
+						// Create inter-column flexion spring.
+						if ((xLoop + kFlexionSpringXStride) < elementsPerRow) {
+							bLinkedSuccessfully = this->CreateSpringLink(xLoop, yLoop,
+								xLoop + kFlexionSpringXStride, yLoop,
+								this->mFlexionSpringConstant) && bLinkedSuccessfully;
 						}
-					
-
-						// Create shear springs.
-						if (((xLoop + 1) < elementsPerRow) && ((yLoop + 1) < elementsPerColumn)) {
-							// Create inter-column shear spring.
-							pSecondClothNode = this->mClothNodeGrid.GetElementAt(xLoop + 1, yLoop + 1);
-
-							if (pSecondClothNode) {
-								CSpringNodeLink*
-										pFirstNodeLink = new /*(std::nothrow)*/ CSpringNodeLink(*pFirstClothNode,
-										*pSecondClothNode, this->mShearSpringConstant);
-							}
-						
-							// Create inter-row shear spring.
-							pFirstClothNode = this->mClothNodeGrid.GetElementAt(xLoop,
-								yLoop + 1);
-
-							pSecondClothNode =
-								this->mClothNodeGrid.GetElementAt(xLoop + 1, yLoop);
-
-							if (pFirstClothNode && pSecondClothNode) {
-								CSpringNodeLink*
-										pSecondNodeLink = new /*(std::nothrow)*/ CSpringNodeLink(*pFirstClothNode,
-										*pSecondClothNode, this->mShearSpringConstant);
-							}
+
+						// Create inter-row flexion spring.
+						if ((yLoop + kFlexionSpringYStride) < elementsPerColumn) {
+							bLinkedSuccessfully = this->CreateSpringLink(xLoop, yLoop,
+								xLoop, yLoop + kFlexionSpringYStride,
+								this->mFlexionSpringConstant) && bLinkedSuccessfully;
 						}
 					}
+				}
+			}
+		}
+	}
 
-					// Create flexion springs.
 
-					// Create inter-column flexion spring.
-					if ((xLoop + 2) < elementsPerRow) {
-						pFirstClothNode = this->mClothNodeGrid.GetElementAt(xLoop, yLoop);
+	return(bLinkedSuccessfully);
+}
 
-						pSecondClothNode = this->mClothNodeGrid.GetElementAt(xLoop + 2,
-							yLoop);
-						
-						if (pFirstClothNode && pSecondClothNode) {
-							CSpringNodeLink*
-								pSpringNodeLink = new /*(std::nothrow)*/ CSpringNodeLink(*pFirstClothNode,
-								*pSecondClothNode, this->mStructSpringConstant);
 
-							bLinkedSuccessfully = pSpringNodeLink && bLinkedSuccessfully;
-						}
-					}
+void CClothNodeNetwork::DestroyClothNodeNetwork()
+{
+	// Detach the springs from the nodes...
+	CClothNode*						pClothNodes = this->mClothNodeGrid.GetRawData();
 
-					// Create inter-row flexion spring.
-					if ((yLoop + 2) < elementsPerColumn) {
-						pSecondClothNode = this->mClothNodeGrid.GetElementAt(xLoop,
-							yLoop + 2);
+	for (IndexType nodeLoop = 0; pClothNodes && (nodeLoop <
+		this->mClothNodeGrid.GetRawElementCount()); nodeLoop++)
+	{
+		pClothNodes[nodeLoop].SetAttachedSprings(NULL, 0);
+	}
 
-						if (pFirstClothNode && pSecondClothNode) {
-							CSpringNodeLink*
-								pSpringNodeLink = new /*(std::nothrow)*/ CSpringNodeLink(*pFirstClothNode,
-								*pSecondClothNode, this->mStructSpringConstant);
+	this->mNodeSpringList.clear();
+	this->mNodeSpringOffset.clear();
+
+	// ...And free allocated spring memory.
+	this->mSpringPool.Release();
+}
 
-							bLinkedSuccessfully = pSpringNodeLink && bLinkedSuccessfully;
-						}
-					}
 
+QuantityType CClothNodeNetwork::GetNetworkSpringCapacity() const
+{
+	const QuantityType				elementsPerRow = this->mClothNodeGrid.GetRowSize();
+	const QuantityType				elementsPerColumn = this->mClothNodeGrid.GetColumnSize();
 
+	QuantityType					springCapacity = 0;
+
+	if ((elementsPerRow > 0) && (elementsPerColumn > 0)) {
+		// Structural springs (inter-column and inter-row)...
+		springCapacity = ((elementsPerRow - 1) * elementsPerColumn) +
+			(elementsPerRow * (elementsPerColumn - 1));
+
+		// ...Shear springs (two per grid cell)...
+		springCapacity += 2 * (elementsPerRow - 1) * (elementsPerColumn - 1);
+
+		// ...And flexion springs (inter-column and inter-row).
+		if (elementsPerRow > 2) {
+			springCapacity += (elementsPerRow - 2) * elementsPerColumn;
+		}
+
+		if (elementsPerColumn > 2) {
+			springCapacity += elementsPerRow * (elementsPerColumn - 2);
+		}
+	}
+
+	return(springCapacity);
+}
+
+
+bool CClothNodeNetwork::BuildNodeSpringAdjacency()
+{
+	bool							bAdjacencyBuiltSuccessfully = false;
 
+	CClothNode*						pClothNodes = this->mClothNodeGrid.GetRawData();
+	const QuantityType				nodeCount = this->mClothNodeGrid.GetRawElementCount();
+	const QuantityType				springCount = this->mSpringPool.GetElementCount();
+
+	if (pClothNodes && (nodeCount > 0)) {
+		// Count the springs attached to each node (grid storage is row-major, so the
+		// node index is determined by the node location within the grid)...
+		this->mNodeSpringOffset.assign(nodeCount + 1, 0);
+
+		for (IndexType springLoop = 0; springLoop < springCount; springLoop++) {
+			const CSpringNodeLink*	pSpringNodeLink = this->mSpringPool.GetElementAt(springLoop);
+
+			this->mNodeSpringOffset[(pSpringNodeLink->GetHeadLink() - pClothNodes) + 1]++;
+			this->mNodeSpringOffset[(pSpringNodeLink->GetTailLink() - pClothNodes) + 1]++;
+		}
+
+		// ...Determine the position of each node's springs within the list...
+		for (IndexType nodeLoop = 0; nodeLoop < nodeCount; nodeLoop++) {
+			this->mNodeSpringOffset[nodeLoop + 1] += this->mNodeSpringOffset[nodeLoop];
+		}
+
+		// ...And store the spring references (springs retain their order of creation
+		// for each node).
+		NodeSpringOffsetList		nodeSpringInsertIndex(this->mNodeSpringOffset.begin(),
+			this->mNodeSpringOffset.end() - 1);
+
+		this->mNodeSpringList.assign(this->mNodeSpringOffset[nodeCount], NULL);
+
+		for (IndexType springLoop = 0; springLoop < springCount; springLoop++) {
+			CSpringNodeLink*		pSpringNodeLink = this->mSpringPool.GetElementAt(springLoop);
+
+			this->mNodeSpringList[nodeSpringInsertIndex[pSpringNodeLink->GetHeadLink() -
+				pClothNodes]++] = pSpringNodeLink;
+			this->mNodeSpringList[nodeSpringInsertIndex[pSpringNodeLink->GetTailLink() -
+				pClothNodes]++] = pSpringNodeLink;
+		}
+
+		// Inform each node of its attached springs.
+		for (IndexType nodeLoop = 0; nodeLoop < nodeCount; nodeLoop++) {
+			const IndexType			firstSpringIndex = this->mNodeSpringOffset[nodeLoop];
+			const QuantityType		attachedSpringCount =
+				this->mNodeSpringOffset[nodeLoop + 1] - firstSpringIndex;
+
+			pClothNodes[nodeLoop].SetAttachedSprings((attachedSpringCount > 0) ?
+				&this->mNodeSpringList[firstSpringIndex] : NULL, attachedSpringCount);
+		}
+
+		bAdjacencyBuiltSuccessfully = true;
+	}
+
+	return(bAdjacencyBuiltSuccessfully);
+}
+
+
+bool CClothNodeNetwork::CreateSpringLink(const IndexType firstXIndex,
+										 const IndexType firstYIndex,
+										 const IndexType secondXIndex,
+										 const IndexType secondYIndex,
+										 const ScalarType springConstant)
+{
+	bool							bLinkCreatedSuccessfully = false;
+
+	CClothNode*						pFirstClothNode =
+		this->mClothNodeGrid.GetElementAt(firstXIndex, firstYIndex);
+	CClothNode*						pSecondClothNode =
+		this->mClothNodeGrid.GetElementAt(secondXIndex, secondYIndex);
+
+	if (pFirstClothNode && pSecondClothNode) {
+		// Link the nodes with a spring (stored within the network spring pool)...
+		CSpringNodeLink*			pSpringNodeLink = this->mSpringPool.Allocate(
+			CSpringNodeLink(*pFirstClothNode, *pSecondClothNode, springConstant));
+
+		// ...And add an equivalent spring to the array representation of the
+		// network.
+		if (pSpringNodeLink) {
+			bLinkCreatedSuccessfully = this->mpSpringArraySolver->AddSpring(
+				this->GetNodeArrayIndex(firstXIndex, firstYIndex),
+				this->GetNodeArrayIndex(secondXIndex, secondYIndex), springConstant,
+				pFirstClothNode->GetNodeLocation().DistanceFrom(
+				pSecondClothNode->GetNodeLocation()));
+		}
+	}
+
+	return(bLinkCreatedSuccessfully);
+}
+
+
+bool CClothNodeNetwork::EvaluateSpringArrayForces(const CExternalNodeForceCollection&
+												  externalNodeForceCollection)
+{
+	bool							bEvaluatedSuccessfully = false;
+
+	if (this->mpSpringArraySolver->IsValid()) {
+		// Wake sleeping regions that have been disturbed...
+		if (this->mSleepEnergyThreshold > 0.0) {
+			this->WakeDisturbedSleepRegions(externalNodeForceCollection);
+		}
+
+		// ...Evaluate external forces for each free node (spring forces are then
+		// accumulated on top of the external forces - anchor nodes and sleeping nodes
+		// do not move, and are not subjected to external forces)...
+		const QuantityType			freeNodeCount = this->mpSpringArraySolver->GetFreeNodeCount();
+
+		if (this->mpWorkerThreadPool && (freeNodeCount > 0)) {
+			// Evaluate blocks of free nodes concurrently.
+			this->mpCurrentExternalForceCollection = &externalNodeForceCollection;
+			this->mpWorkerThreadPool->ExecuteTask(*this, freeNodeCount,
+				mkMinimumNodesPerThread);
+			this->mpCurrentExternalForceCollection = NULL;
+		}
+		else {
+			this->EvaluateExternalForceRange(externalNodeForceCollection, 0, freeNodeCount);
+		}
+
+		// Surface forces depend upon the entire grid, and are evaluated by a single
+		// thread.
+		if (externalNodeForceCollection.HasSurfaceForces()) {
+			this->mpSpringArraySolver->AccumulateSurfaceForces(externalNodeForceCollection,
+				this->mClothNodeGrid.GetRowSize(), this->mClothNodeGrid.GetColumnSize());
+		}
+
+		if (this->mSolverMode == eClothSolverPositionBased) {
+			// Move the nodes using the external forces, and solve the spring
+			// constraints.
+			bEvaluatedSuccessfully = this->mpSpringArraySolver->SolvePositionConstraints(
+				this->mForceTimeQuantum);
+		}
+		else {
+			// Evaluate each spring once, and apply the forces to the nodes in the network.
+			bEvaluatedSuccessfully = this->mpSpringArraySolver->AccumulateSpringForces() &&
+				this->mpSpringArraySolver->ApplyNodeForces(this->mForceTimeQuantum);
+		}
+
+		// ...And place regions that have come to rest into sleep.
+		if (bEvaluatedSuccessfully && (this->mSleepEnergyThreshold > 0.0)) {
+			this->UpdateSleepRegionRestStates(externalNodeForceCollection);
+		}
+	}
+
+	return(bEvaluatedSuccessfully);
+}
+
+
+void CClothNodeNetwork::EvaluateExternalForceRange(const CExternalNodeForceCollection&
+												   externalNodeForceCollection,
+												   const IndexType firstFreeNodeIndex,
+												   const IndexType endFreeNodeIndex)
+{
+	// Forces are evaluated for batches of nodes within the solver arrays.
+	this->mpSpringArraySolver->EvaluateExternalForces(externalNodeForceCollection,
+		firstFreeNodeIndex, endFreeNodeIndex, this->mForceTimeQuantum);
+}
+
+
+bool CClothNodeNetwork::CopyNodeStateToSpringArray()
+{
+	bool							bCopiedSuccessfully = this->mpSpringArraySolver->IsValid();
+
+	const QuantityType				elementsPerRow = this->mClothNodeGrid.GetRowSize();
+	const QuantityType				elementsPerColumn = this->mClothNodeGrid.GetColumnSize();
+
+	for (QuantityType yLoop = 0; yLoop < elementsPerColumn; yLoop++) {
+		const CClothNode*			pClothNodeRow = this->mClothNodeGrid.GetRowSpan(yLoop);
+
+		for (QuantityType xLoop = 0; pClothNodeRow && (xLoop < elementsPerRow); xLoop++) {
+			const CClothNode&		currentClothNode = pClothNodeRow[xLoop];
+
+			bCopiedSuccessfully = this->mpSpringArraySolver->SetNodeState(
+				this->GetNodeArrayIndex(xLoop, yLoop),
+				currentClothNode.GetNodeLocation(),
+				currentClothNode.GetNodeVelocityVector(),
+				currentClothNode.GetNodeMass(),
+				currentClothNode.IsAnchorNode()) && bCopiedSuccessfully;
+		}
+	}
+
+	return(bCopiedSuccessfully);
+}
+
+
+bool CClothNodeNetwork::CopyNodeStateFromSpringArray()
+{
+	bool							bCopiedSuccessfully = this->mpSpringArraySolver->IsValid();
+
+	const QuantityType				elementsPerRow = this->mClothNodeGrid.GetRowSize();
+	const QuantityType				elementsPerColumn = this->mClothNodeGrid.GetColumnSize();
+
+	for (QuantityType yLoop = 0; bCopiedSuccessfully && (yLoop < elementsPerColumn); yLoop++) {
+		CClothNode*					pClothNodeRow = this->mClothNodeGrid.GetRowSpan(yLoop);
+
+		for (QuantityType xLoop = 0; pClothNodeRow && (xLoop < elementsPerRow); xLoop++) {
+			const IndexType			nodeIndex = this->GetNodeArrayIndex(xLoop, yLoop);
+
+			pClothNodeRow[xLoop].RestoreNodeState(
+				this->mpSpringArraySolver->GetNodeLocation(nodeIndex),
+				this->mpSpringArraySolver->GetNodeVelocityVector(nodeIndex));
+		}
+	}
+
+	return(bCopiedSuccessfully);
+}
+
+
+CFloatPoint CClothNodeNetwork::GetGridNodeLocation(const IndexType xIndex,
+												   const IndexType yIndex) const
+{
+	CFloatPoint						nodeLocation(0.0, 0.0, 0.0);
+
+	if (this->mSolverMode != eClothSolverNodeLinked) {
+		// Retrieve the location from the node arrays.
+		nodeLocation = this->mpSpringArraySolver->GetNodeLocation(
+			this->GetNodeArrayIndex(xIndex, yIndex));
+	}
+	else {
+		// Retrieve the location from the grid node.
+		const CClothNode*			pClothNode = this->mClothNodeGrid.GetElementAt(xIndex,
+			yIndex);
+
+		if (pClothNode) {
+			nodeLocation = pClothNode->GetNodeLocation();
+		}
+	}
+
+	return(nodeLocation);
+}
+
+
+void CClothNodeNetwork::StorePreviousNodeLocations()
+{
+	const QuantityType				elementsPerRow = this->mClothNodeGrid.GetRowSize();
+	const QuantityType				elementsPerColumn = this->mClothNodeGrid.GetColumnSize();
+
+	// The list is only allocated during the first evaluation.
+	this->mPreviousNodeLocation.resize(elementsPerRow * elementsPerColumn,
+		CFloatPoint(0.0, 0.0, 0.0));
+
+	for (IndexType yLoop = 0; yLoop < elementsPerColumn; yLoop++) {
+		for (IndexType xLoop = 0; xLoop < elementsPerRow; xLoop++) {
+			this->mPreviousNodeLocation[this->GetNodeArrayIndex(xLoop, yLoop)] =
+				this->GetGridNodeLocation(xLoop, yLoop);
+		}
+	}
+}
+
+
+bool CClothNodeNetwork::IsUnconditionallyStable() const
+{
+	// Implicit integration and position-based dynamics are unconditionally stable -
+	// explicit integration must observe the stable time quantum.
+	return((this->mSolverMode == eClothSolverPositionBased) ||
+		((this->mSolverMode == eClothSolverSpringArray) &&
+		(this->mNodeIntegrator == eNodeIntegratorImplicitEuler)));
+}
+
+
+bool CClothNodeNetwork::EvaluateSurfaceForces(const CExternalNodeForceCollection&
+											  externalNodeForceCollection)
+{
+	bool							bEvaluatedSuccessfully = false;
+
+	if (externalNodeForceCollection.HasSurfaceForces()) {
+		const QuantityType			elementsPerRow = this->mClothNodeGrid.GetRowSize();
+		const QuantityType			elementsPerColumn = this->mClothNodeGrid.GetColumnSize();
+
+		// Stage the state of every grid node...
+		this->mSurfaceForceGrid.AllocateGrid(elementsPerRow, elementsPerColumn);
+
+		for (IndexType yLoop = 0; yLoop < elementsPerColumn; yLoop++) {
+			const CClothNode*		pClothNodeRow = this->mClothNodeGrid.GetRowSpan(yLoop);
+
+			for (IndexType xLoop = 0; pClothNodeRow && (xLoop < elementsPerRow); xLoop++) {
+				const IndexType		gridNodeIndex = this->GetNodeArrayIndex(xLoop, yLoop);
+				const CFloatPoint	nodeLocation = pClothNodeRow[xLoop].GetNodeLocation();
+				const CVector		nodeVelocity =
+					pClothNodeRow[xLoop].GetNodeVelocityVector();
+
+				this->mSurfaceForceGrid.mNodeLocationX[gridNodeIndex] = nodeLocation.GetXCoord();
+				this->mSurfaceForceGrid.mNodeLocationY[gridNodeIndex] = nodeLocation.GetYCoord();
+				this->mSurfaceForceGrid.mNodeLocationZ[gridNodeIndex] = nodeLocation.GetZCoord();
+				this->mSurfaceForceGrid.mNodeVelocityX[gridNodeIndex] =
+					nodeVelocity.GetXComponent();
+				this->mSurfaceForceGrid.mNodeVelocityY[gridNodeIndex] =
+					nodeVelocity.GetYComponent();
+				this->mSurfaceForceGrid.mNodeVelocityZ[gridNodeIndex] =
+					nodeVelocity.GetZComponent();
+			}
+		}
+
+		// ...And evaluate the surface forces.
+		bEvaluatedSuccessfully = externalNodeForceCollection.EvaluateSurfaceForces(
+			this->mSurfaceForceGrid.GetNodeGrid());
+	}
+
+	return(bEvaluatedSuccessfully);
+}
+
+
+QuantityType CClothNodeNetwork::GetNodesPerRow() const
+{
+	return(this->mClothNodeGrid.GetRowSize());
+}
+
+
+QuantityType CClothNodeNetwork::GetNodesPerColumn() const
+{
+	return(this->mClothNodeGrid.GetColumnSize());
+}
+
+
+CFloatPoint CClothNodeNetwork::GetRenderNodeLocation(const IndexType xIndex,
+													 const IndexType yIndex) const
+{
+	CFloatPoint						nodeLocation = this->GetGridNodeLocation(xIndex, yIndex);
+	const IndexType					nodeIndex = this->GetNodeArrayIndex(xIndex, yIndex);
+
+	if ((this->mRenderInterpolationFactor < 1.0) &&
+		(nodeIndex < this->mPreviousNodeLocation.size()))
+	{
+		// Interpolate linearly from the previous location to the current location.
+		const CFloatPoint&			previousLocation = this->mPreviousNodeLocation[nodeIndex];
+		const ScalarType			interpolationFactor = this->mRenderInterpolationFactor;
+
+		nodeLocation = CFloatPoint(
+			previousLocation.GetXCoord() + ((nodeLocation.GetXCoord() -
+			previousLocation.GetXCoord()) * interpolationFactor),
+			previousLocation.GetYCoord() + ((nodeLocation.GetYCoord() -
+			previousLocation.GetYCoord()) * interpolationFactor),
+			previousLocation.GetZCoord() + ((nodeLocation.GetZCoord() -
+			previousLocation.GetZCoord()) * interpolationFactor));
+	}
+
+	return(nodeLocation);
+}
+
+
+IndexType CClothNodeNetwork::GetNodeArrayIndex(const IndexType xIndex,
+											   const IndexType yIndex) const
+{
+	// Nodes are stored in row-major order within the node arrays.
+	return((yIndex * this->mClothNodeGrid.GetRowSize()) + xIndex);
+}
+
+
+QuantityType CClothNodeNetwork::GetSleepRegionsPerRow() const
+{
+	// Regions at the edge of the grid may be partially occupied.
+	return((this->mClothNodeGrid.GetRowSize() + mkSleepRegionSize - 1) / mkSleepRegionSize);
+}
+
+
+IndexType CClothNodeNetwork::GetNodeSleepRegionIndex(const IndexType xIndex,
+													 const IndexType yIndex) const
+{
+	return(((yIndex / mkSleepRegionSize) * this->GetSleepRegionsPerRow()) +
+		(xIndex / mkSleepRegionSize));
+}
+
+
+void CClothNodeNetwork::EvaluateNodeExternalForce(const CExternalNodeForceCollection&
+												  externalNodeForceCollection,
+												  const IndexType nodeIndex,
+												  CVector& resultantForceVector) const
+{
+	const CPhysicalNodeState		nodeReference(
+		this->mpSpringArraySolver->GetNodeLocation(nodeIndex),
+		this->mpSpringArraySolver->GetNodeVelocityVector(nodeIndex),
+		this->mpSpringArraySolver->GetNodeMass(nodeIndex),
+		this->mpSpringArraySolver->IsAnchorNode(nodeIndex));
+
+	externalNodeForceCollection.EvaluateExternalForces(nodeReference,
+		resultantForceVector, this->mForceTimeQuantum);
+}
+
+
+void CClothNodeNetwork::UpdateSleepRegionFreeNodes()
+{
+	const QuantityType				elementsPerRow = this->mClothNodeGrid.GetRowSize();
+	const QuantityType				elementsPerColumn = this->mClothNodeGrid.GetColumnSize();
+	const QuantityType				nodeCount = elementsPerRow * elementsPerColumn;
+
+	for (IndexType regionLoop = 0; regionLoop < this->mSleepRegion.size(); regionLoop++) {
+		this->mSleepRegion[regionLoop].mFreeNodeCount = 0;
+		this->mSleepRegion[regionLoop].mSampleNodeIndex = nodeCount;
+	}
+
+	// Nodes are visited in row-major order - retain the first free node of each region.
+	for (IndexType yLoop = 0; yLoop < elementsPerColumn; yLoop++) {
+		for (IndexType xLoop = 0; xLoop < elementsPerRow; xLoop++) {
+			const IndexType			nodeIndex = this->GetNodeArrayIndex(xLoop, yLoop);
+			const IndexType			regionIndex = this->GetNodeSleepRegionIndex(xLoop, yLoop);
+
+			if ((regionIndex < this->mSleepRegion.size()) &&
+				!this->mpSpringArraySolver->IsAnchorNode(nodeIndex))
+			{
+				CClothSleepRegion&	sleepRegion = this->mSleepRegion[regionIndex];
+
+				if (sleepRegion.mSampleNodeIndex == nodeCount) {
+					sleepRegion.mSampleNodeIndex = nodeIndex;
 				}
+
+				sleepRegion.mFreeNodeCount++;
 			}
 		}
 	}
+}
 
 
-	return(bLinkedSuccessfully);
+void CClothNodeNetwork::WakeDisturbedSleepRegions(const CExternalNodeForceCollection&
+												  externalNodeForceCollection)
+{
+	const QuantityType				regionsPerRow = this->GetSleepRegionsPerRow();
+	const QuantityType				regionsPerColumn = (regionsPerRow > 0) ?
+		(this->mSleepRegion.size() / regionsPerRow) : 0;
+
+	// Period over which a region must remain at rest.
+	const ScalarType				restPeriod = this->mForceTimeQuantum *
+		(ScalarType)this->mSleepStepCount;
+
+	for (IndexType regionYLoop = 0; regionYLoop < regionsPerColumn; regionYLoop++) {
+		for (IndexType regionXLoop = 0; regionXLoop < regionsPerRow; regionXLoop++) {
+			const IndexType			regionIndex = (regionYLoop * regionsPerRow) + regionXLoop;
+			const CClothSleepRegion&
+									sleepRegion = this->mSleepRegion[regionIndex];
+
+			// Regions that do not contain free nodes are never disturbed.
+			if (!sleepRegion.mbIsSleeping || (sleepRegion.mFreeNodeCount == 0)) {
+				continue;
+			}
+
+			// Wake the region if an adjacent region is moving (regions that have just
+			// been woken have no kinetic energy, so waking does not cascade within a
+			// step)...
+			bool					bRegionDisturbed = false;
+
+			for (IndexType neighborYLoop = ((regionYLoop > 0) ? (regionYLoop - 1) : 0);
+				!bRegionDisturbed && (neighborYLoop <= (regionYLoop + 1)) &&
+				(neighborYLoop < regionsPerColumn); neighborYLoop++)
+			{
+				for (IndexType neighborXLoop = ((regionXLoop > 0) ? (regionXLoop - 1) : 0);
+					!bRegionDisturbed && (neighborXLoop <= (regionXLoop + 1)) &&
+					(neighborXLoop < regionsPerRow); neighborXLoop++)
+				{
+					bRegionDisturbed = (this->mSleepRegion[(neighborYLoop * regionsPerRow) +
+						neighborXLoop].mKineticEnergy > this->mSleepEnergyThreshold);
+				}
+			}
+
+			// ...Or if the change in external force would impart more than the rest
+			// energy to the sample node over the rest period (E = (F x t)^2 / 2m).
+			if (!bRegionDisturbed) {
+				CVector				sampleForceVector;
+
+				this->EvaluateNodeExternalForce(externalNodeForceCollection,
+					sleepRegion.mSampleNodeIndex, sampleForceVector);
+
+				const CVector		forceChangeVector = sampleForceVector -
+					sleepRegion.mSampleForce;
+				const ScalarType	impulseMagnitude = forceChangeVector.GetMagnitude() *
+					restPeriod;
+
+				bRegionDisturbed = ((impulseMagnitude * impulseMagnitude * 0.5 /
+					this->mpSpringArraySolver->GetNodeMass(sleepRegion.mSampleNodeIndex)) >
+					this->mSleepEnergyThreshold);
+			}
+
+			if (bRegionDisturbed) {
+				this->SetSleepRegionStatus(regionIndex, false);
+			}
+		}
+	}
 }
 
 
-void CClothNodeNetwork::DestroyClothNodeNetwork()
+void CClothNodeNetwork::UpdateSleepRegionRestStates(const CExternalNodeForceCollection&
+													externalNodeForceCollection)
 {
-	// (Free allocated spring memory).
+	const QuantityType				elementsPerRow = this->mClothNodeGrid.GetRowSize();
+
+	for (IndexType regionLoop = 0; regionLoop < this->mSleepRegion.size(); regionLoop++) {
+		this->mSleepRegion[regionLoop].mKineticEnergy = 0.0;
+	}
+
+	// Kinetic Energy = Mass x Velocity^2 / 2 (the free node list only contains the free
+	// nodes of regions that are not sleeping - the mean is determined over the free
+	// nodes of each region, as anchor nodes never move).
+	for (IndexType freeNodeLoop = 0; freeNodeLoop <
+		this->mpSpringArraySolver->GetFreeNodeCount(); freeNodeLoop++)
+	{
+		const IndexType				nodeIndex =
+			this->mpSpringArraySolver->GetFreeNodeIndex(freeNodeLoop);
+		const CVector				velocityVector =
+			this->mpSpringArraySolver->GetNodeVelocityVector(nodeIndex);
+
+		this->mSleepRegion[this->GetNodeSleepRegionIndex(nodeIndex % elementsPerRow,
+			nodeIndex / elementsPerRow)].mKineticEnergy += 0.5 *
+			this->mpSpringArraySolver->GetNodeMass(nodeIndex) *
+			((velocityVector.GetXComponent() * velocityVector.GetXComponent()) +
+			(velocityVector.GetYComponent() * velocityVector.GetYComponent()) +
+			(velocityVector.GetZComponent() * velocityVector.GetZComponent()));
+	}
+
+	for (IndexType regionLoop = 0; regionLoop < this->mSleepRegion.size(); regionLoop++) {
+		CClothSleepRegion&			sleepRegion = this->mSleepRegion[regionLoop];
 
+		if (sleepRegion.mbIsSleeping) {
+			continue;
+		}
+
+		// (Regions that only contain anchor nodes are always at rest.)
+		if (sleepRegion.mFreeNodeCount > 0) {
+			sleepRegion.mKineticEnergy /= (ScalarType)sleepRegion.mFreeNodeCount;
+		}
+
+		if (sleepRegion.mKineticEnergy < this->mSleepEnergyThreshold) {
+			sleepRegion.mRestStepCount++;
+		}
+		else {
+			sleepRegion.mRestStepCount = 0;
+		}
+
+		if (sleepRegion.mRestStepCount >= this->mSleepStepCount) {
+			// Stop the nodes of the region, and retain the external force applied to
+			// the sample node (used to detect external force changes).
+			this->SetSleepRegionStatus(regionLoop, true);
+
+			if (sleepRegion.mFreeNodeCount > 0) {
+				this->EvaluateNodeExternalForce(externalNodeForceCollection,
+					sleepRegion.mSampleNodeIndex, sleepRegion.mSampleForce);
+			}
+		}
+	}
 }
 
 
+void CClothNodeNetwork::SetSleepRegionStatus(const IndexType regionIndex,
+											 const bool bIsSleeping)
+{
+	if (regionIndex < this->mSleepRegion.size()) {
+		CClothSleepRegion&			sleepRegion = this->mSleepRegion[regionIndex];
+
+		if (sleepRegion.mbIsSleeping != bIsSleeping) {
+			// Determine the grid nodes within the region (regions at the edge of the
+			// grid may be partially occupied)...
+			const QuantityType		elementsPerRow = this->mClothNodeGrid.GetRowSize();
+			const QuantityType		elementsPerColumn = this->mClothNodeGrid.GetColumnSize();
+			const IndexType			firstXIndex = (regionIndex % this->GetSleepRegionsPerRow()) *
+				mkSleepRegionSize;
+			const IndexType			firstYIndex = (regionIndex / this->GetSleepRegionsPerRow()) *
+				mkSleepRegionSize;
+			const IndexType			endXIndex = ((firstXIndex + mkSleepRegionSize) <
+				elementsPerRow) ? (firstXIndex + mkSleepRegionSize) : elementsPerRow;
+			const IndexType			endYIndex = ((firstYIndex + mkSleepRegionSize) <
+				elementsPerColumn) ? (firstYIndex + mkSleepRegionSize) : elementsPerColumn;
+
+			// ...And update the sleeping status of the nodes (anchor nodes do not sleep).
+			for (IndexType yLoop = firstYIndex; yLoop < endYIndex; yLoop++) {
+				for (IndexType xLoop = firstXIndex; xLoop < endXIndex; xLoop++) {
+					const IndexType	nodeIndex = this->GetNodeArrayIndex(xLoop, yLoop);
+
+					if (!this->mpSpringArraySolver->IsAnchorNode(nodeIndex)) {
+						this->mpSpringArraySolver->SetSleepingNodeStatus(nodeIndex,
+							bIsSleeping);
+					}
+				}
+			}
+
+			const QuantityType		regionNodeCount = (endXIndex - firstXIndex) *
+				(endYIndex - firstYIndex);
+
+			if (bIsSleeping) {
+				this->mSleepingNodeCount += regionNodeCount;
+			}
+			else {
+				this->mSleepingNodeCount -= regionNodeCount;
+			}
+		}
+
+		sleepRegion.mbIsSleeping = bIsSleeping;
+		sleepRegion.mRestStepCount = 0;
+		sleepRegion.mKineticEnergy = 0.0;
+	}
+}
+
+
+void CClothNodeNetwork::WakeAllSleepRegions()
+{
+	for (IndexType regionLoop = 0; regionLoop < this->mSleepRegion.size(); regionLoop++) {
+		this->SetSleepRegionStatus(regionLoop, false);
+	}
+}
+
+
+// Minimum number of nodes for which external forces are evaluated by each thread.
+const QuantityType					CClothNodeNetwork::mkMinimumNodesPerThread = 1024;
+
+// Number of grid nodes along each side of a sleeping region.
+const QuantityType					CClothNodeNetwork::mkSleepRegionSize = 4;
 
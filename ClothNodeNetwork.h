@@ -8,8 +8,8 @@
 #include "PrimitiveSupport.h"
 #include "ModelGeometry.h"
 #include "PhysicalNode.h"
-#include <list>
-#include <algorithm>			// Required for std::find(...)
+#include "ClothNetworkBase.h"
+#include "ClothSpringArraySolver.h"
 
 
 // Cloth simulation implementation concept is based on the following
@@ -51,6 +51,12 @@ public:
 	bool							LinkClothNodes(CClothNode& firstClothNode,
 		CClothNode& secondClothNode);
 
+	// Retrieves the cloth node attached to the "head" of the spring.
+	CClothNode*						GetHeadLink() const;
+
+	// Retrieves the cloth node attached to the "tail" of the spring.
+	CClothNode*						GetTailLink() const;
+
 	// Returns the force that is applied on the target node by the connected spring.
 	bool							GetForceOnNode(const CClothNode& targetClothNode,
 		CVector& forceVector) const;
@@ -94,9 +100,10 @@ protected:
 	CClothNode*						mpTailLink;
 };
 
-// Type definition - list of springs attached to a single cloth
-// node.
-typedef	std::list<CSpringNodeLink*>	SpringNodeLinkList;
+// Type definition - contiguous list of spring references (the springs
+// attached to each cloth node occupy a contiguous range within the list).
+typedef	std::vector<CSpringNodeLink*>
+									SpringNodeLinkList;
 
 
 class CClothNode : public CPhysicalNodeBase
@@ -111,30 +118,83 @@ public:
 	// with its defining parameters.
 	bool							IsValid() const;
 
-	// Attaches a spring to the current node.
-	bool							AddAttachedSpring(CSpringNodeLink&
-		targetSpring);
+	// Sets the springs attached to the current node (the spring references are
+	// owned by the cloth network).
+	void							SetAttachedSprings(CSpringNodeLink* const*
+		pAttachedSprings, const QuantityType attachedSpringCount);
 
-	// Removes a spring from the current node.
-	bool							RemoveAttachedSpring(CSpringNodeLink&
-		attachedSpring);
+	// Returns the number of springs attached to the current node.
+	QuantityType					GetAttachedSpringCount() const;
 
 	// Sums the forces imposed by all attached springs, and adds the forces
 	// to the pending force vector;
 	bool							SumAttachedSpringForces();
 
-	CClothNode operator=(const CClothNode& clothNode);
+	// Restores the location and velocity of the node (used when node state is
+	// maintained outside of the node).
+	void							RestoreNodeState(const CFloatPoint& nodeLocation,
+		const CVector& velocityVector);
+
+	CClothNode&						operator=(const CClothNode& clothNode);
 
 protected:
 
-	// List of attached springs (references).
-	SpringNodeLinkList				mAttachedSprings;
+	// Attached springs (references - the spring references reside within the
+	// cloth network node/spring adjacency list).
+	CSpringNodeLink* const*			mpAttachedSprings;
+
+	// Number of attached springs.
+	QuantityType					mAttachedSpringCount;
+};
+
+
+
+// Rest state of a square region of cloth grid nodes (regions that remain at rest are
+// placed into sleep, and are excluded from evaluation until they are disturbed).
+class CClothSleepRegion
+{
+public:
+	CClothSleepRegion();
+	~CClothSleepRegion();
+
+	// Indicates whether or not the region is sleeping.
+	bool							mbIsSleeping;
+
+	// Number of successive steps for which the region has remained at rest.
+	QuantityType					mRestStepCount;
+
+	// Mean kinetic energy per free node after the most recent step (zero for sleeping
+	// regions, and for regions without free nodes).
+	ScalarType						mKineticEnergy;
+
+	// Number of free (non-anchor) nodes within the region.
+	QuantityType					mFreeNodeCount;
+
+	// Node used to detect external force changes (the node count if the region does not
+	// contain free nodes), and the external force applied to the node when the region
+	// was placed into sleep.
+	IndexType						mSampleNodeIndex;
+	CVector							mSampleForce;
 };
 
+// Type definition - list of sleeping regions (row-major order).
+typedef std::vector<CClothSleepRegion>
+									ClothSleepRegionList;
 
 
+// Cloth network solver modes.
+typedef enum
+{
+	eClothSolverNodeLinked = 0,		// Each node sums the forces of its attached springs.
+	eClothSolverSpringArray,		// Node state is stored in contiguous arrays, with each
+									// spring evaluated once per step.
+	eClothSolverPositionBased		// Node state is stored in contiguous arrays, with springs
+									// solved as distance constraints (extended position-based
+									// dynamics - compliance is the inverse spring constant).
+} EClothSolverMode;
+
 
-class CClothNodeNetwork
+class CClothNodeNetwork : public CClothNetworkBase, public CParallelTask
 {
 public:
 
@@ -154,23 +214,83 @@ public:
 	bool							SetAnchorNode (const IndexType xIndex,
 		const IndexType yIndex, const bool bIsAnchorNode);
 
-	// Generates a polygonal mesh from the cloth node network.
-	bool							GenerateNodeNetworkMesh(CStaticMeshBase&
-		nodeNetworkMesh) const;
-
-	// Evaluates all forces being applied to the cloth network (internal and external).
-	bool							EvaluateClothNodeNetworkForces(
-		const CExternalNodeForceCollection&	externalNodeForceCollection);
-
 	// Sets the unit of time (seconds) used when performing stepwise evaluation of applied
 	// forces in the cloth simulation.
 	bool							SetForceTimeQuantum(const ScalarType timeQuantum);
 
-	// Sets the base color of the cloth (for rendering).
-	void							SetClothBaseColor(const CFloatColor& clothColor);
+	// Retrieves the unit of time (seconds) used for each evaluation step.
+	ScalarType						GetForceTimeQuantum() const;
 
-	// Sets the specularity exponent ("shininess") of the cloth (for rendering).
-	bool							SetClothSpecularity(const ScalarType specularity);
+	// Estimates the largest time quantum for which explicit integration of the cloth
+	// network remains stable (determined from the spring constants and node masses).
+	ScalarType						EstimateStableTimeQuantum() const;
+
+	// Selects the method used to integrate node motion - Verlet integration permits
+	// larger time quanta, with the damping factor (0.0 - 1.0) removing a fraction of
+	// the node displacement during each step (used in place of viscous damping).
+	bool							SetNodeIntegrator(const ENodeIntegrator nodeIntegrator,
+		const ScalarType dampingFactor);
+
+	// Retrieves the method used to integrate node motion.
+	ENodeIntegrator					GetNodeIntegrator() const;
+
+	// Selects the method used to solve spring distance constraints (position-based
+	// solver), and the number of solver iterations performed during each step.
+	bool							SetConstraintSolver(const EConstraintSolverMethod
+		constraintSolverMethod, const QuantityType iterationCount);
+
+	// Sets the maximum elongation of each spring, relative to its resting length, and
+	// the maximum number of constraint iterations performed after each step (spring
+	// array solver only - an iteration count of zero disables the constraints).
+	bool							SetStrainLimit(const ScalarType maximumElongation,
+		const QuantityType iterationCount);
+
+	// Selects the solver used to evaluate the cloth network (the current node state is
+	// transferred to the newly-selected solver). Sleeping regions are woken, and
+	// sleeping is disabled when the node-linked solver is selected.
+	bool							SetSolverMode(const EClothSolverMode solverMode);
+
+	// Retrieves the solver currently used to evaluate the cloth network.
+	EClothSolverMode				GetSolverMode() const;
+
+	// Selects the precision of the node state stored by the spring array solver
+	// (double-precision by default) - the current node state, springs and solver
+	// settings are transferred to the new solver.
+	bool							SetSolverPrecision(const ESolverPrecision
+		solverPrecision);
+
+	// Retrieves the precision of the node state stored by the spring array solver.
+	ESolverPrecision				GetSolverPrecision() const;
+
+	// Specifies whether the SIMD spring force kernels of the spring array solver
+	// determine spring lengths using the approximate reciprocal square root (exact
+	// spring lengths are used by default).
+	void							SetApproximateSpringLengths(const bool
+		bApproximateSpringLengths);
+
+	// Determines if the spring array solver uses approximate spring lengths.
+	bool							UsesApproximateSpringLengths() const;
+
+	// Sets the number of threads used to evaluate the cloth network with the spring
+	// array solver (a single thread is used by default). Results do not depend upon
+	// the number of threads.
+	bool							SetWorkerThreadCount(const QuantityType threadCount);
+
+	// Retrieves the number of threads used to evaluate the cloth network.
+	QuantityType					GetWorkerThreadCount() const;
+
+	// Sets the sleeping threshold of the cloth network (see CClothNetworkBase) - regions
+	// of 4 x 4 nodes are placed into sleep by the spring array solvers (returns false
+	// when the node-linked solver is selected, which evaluates every node).
+	bool							SetSleepThreshold(const ScalarType energyThreshold,
+		const QuantityType stepCount);
+
+	// Retrieves the number of nodes within sleeping regions of the cloth.
+	QuantityType					GetSleepingNodeCount() const;
+
+	// Evaluates external forces for a range of free nodes (invoked by the thread pool).
+	void							ExecuteRange(const IndexType firstIndex,
+		const IndexType endIndex);
 
 protected:
 
@@ -187,22 +307,179 @@ protected:
 	// Deconstructs the cloth network, releasing any allocated memory.
 	void							DestroyClothNodeNetwork();
 
+	// Determines the number of springs required to link the cloth network nodes.
+	QuantityType					GetNetworkSpringCapacity() const;
+
+	// Builds the list of springs attached to each node (compressed row format -
+	// each node references a contiguous range of the spring list).
+	bool							BuildNodeSpringAdjacency();
+
+	// Creates a spring link between two grid nodes (the spring is also added to the
+	// spring array solver).
+	bool							CreateSpringLink(const IndexType firstXIndex,
+		const IndexType firstYIndex, const IndexType secondXIndex,
+		const IndexType secondYIndex, const ScalarType springConstant);
+
+	// Evaluates all forces being applied to the cloth network over a single step
+	// (the previous network state is not stored).
+	bool							EvaluateClothNodeNetworkStep(
+		const CExternalNodeForceCollection&	externalNodeForceCollection);
+
+	// Stores the current location of each grid node as the previous network state
+	// (used to interpolate node locations when generating meshes).
+	void							StorePreviousNodeLocations();
+
+	// Determines if the network is evaluated using a method that remains stable for
+	// any time quantum (implicit integration, or position-based dynamics).
+	bool							IsUnconditionallyStable() const;
+
+	// Evaluates the surface forces applied to the grid nodes (node-linked solver - the
+	// forces are stored within the surface force grid).
+	bool							EvaluateSurfaceForces(
+		const CExternalNodeForceCollection&	externalNodeForceCollection);
+
+	// Returns the number of nodes within each grid row (x-axis).
+	QuantityType					GetNodesPerRow() const;
+
+	// Returns the number of nodes within each grid column (y-axis).
+	QuantityType					GetNodesPerColumn() const;
+
+	// Retrieves the location of a grid node for rendering, interpolated between the
+	// previous and current network states.
+	CFloatPoint						GetRenderNodeLocation(const IndexType xIndex,
+		const IndexType yIndex) const;
+
+	// Evaluates all forces being applied to the cloth network, using the spring
+	// array solver.
+	bool							EvaluateSpringArrayForces(
+		const CExternalNodeForceCollection&	externalNodeForceCollection);
+
+	// Evaluates external forces for the spring array solver free nodes within the free
+	// node list range [firstFreeNodeIndex, endFreeNodeIndex).
+	void							EvaluateExternalForceRange(
+		const CExternalNodeForceCollection&	externalNodeForceCollection,
+		const IndexType firstFreeNodeIndex, const IndexType endFreeNodeIndex);
+
+	// Copies the state of all grid nodes into the spring array solver.
+	bool							CopyNodeStateToSpringArray();
+
+	// Copies the state of all spring array solver nodes into the grid nodes.
+	bool							CopyNodeStateFromSpringArray();
+
+	// Retrieves the current location of a grid node from the active solver.
+	CFloatPoint						GetGridNodeLocation(const IndexType xIndex,
+		const IndexType yIndex) const;
+
+	// Determines the spring array solver index of a grid node.
+	IndexType						GetNodeArrayIndex(const IndexType xIndex,
+		const IndexType yIndex) const;
+
+	// Returns the number of sleeping regions within each row of regions.
+	QuantityType					GetSleepRegionsPerRow() const;
+
+	// Retrieves the sleeping region that contains a grid node.
+	IndexType						GetNodeSleepRegionIndex(const IndexType xIndex,
+		const IndexType yIndex) const;
+
+	// Evaluates the external force applied to a single spring array solver node.
+	void							EvaluateNodeExternalForce(
+		const CExternalNodeForceCollection&	externalNodeForceCollection,
+		const IndexType nodeIndex, CVector& resultantForceVector) const;
+
+	// Determines the number of free nodes within each sleeping region, and selects the
+	// node of each region used to detect external force changes while the region
+	// sleeps (the first free node of the region).
+	void							UpdateSleepRegionFreeNodes();
+
+	// Wakes sleeping regions that are adjacent to moving regions, or for which the
+	// external force applied to the sample node has changed.
+	void							WakeDisturbedSleepRegions(
+		const CExternalNodeForceCollection&	externalNodeForceCollection);
+
+	// Determines the kinetic energy of each region that is not sleeping, and places
+	// regions that have remained at rest for the required number of steps into sleep.
+	void							UpdateSleepRegionRestStates(
+		const CExternalNodeForceCollection&	externalNodeForceCollection);
+
+	// Places the free nodes of a region into sleep, or wakes the nodes of the region.
+	void							SetSleepRegionStatus(const IndexType regionIndex,
+		const bool bIsSleeping);
+
+	// Wakes every sleeping region.
+	void							WakeAllSleepRegions();
+
 
 	typedef	CStatic2DArray<CClothNode>
 									ClothNodeGridType;
 			
-	// Grid that contains the cloth nodes.
+	// Grid that contains the cloth nodes (row-major - nodes are visited in row order).
 	ClothNodeGridType				mClothNodeGrid;
 
+	// Storage for all springs within the network (released at once when the network
+	// is destroyed).
+	CContiguousPool<CSpringNodeLink>
+									mSpringPool;
+
+	// Type definition - list of offsets into the node/spring adjacency list.
+	typedef std::vector<IndexType>	NodeSpringOffsetList;
+
+	// Node/spring adjacency list - the springs attached to each node are stored in
+	// the range [mNodeSpringOffset[node], mNodeSpringOffset[node + 1]).
+	SpringNodeLinkList				mNodeSpringList;
+	NodeSpringOffsetList			mNodeSpringOffset;
+
 	// Unit of time (seconds) used for each evaluation step in the cloth simulation.
 	ScalarType						mForceTimeQuantum;
 
+	// Type definition - list of node locations.
+	typedef std::vector<CFloatPoint>
+									NodeLocationList;
+
+	// Location of each grid node prior to the most recent evaluation (row-major order -
+	// empty until the network has been evaluated).
+	NodeLocationList				mPreviousNodeLocation;
+
+	// Grid node state staged for surface force evaluation (node-linked solver).
+	CExternalForceGridBuffer		mSurfaceForceGrid;
+
+	// Method used to integrate node motion.
+	ENodeIntegrator					mNodeIntegrator;
+
+	// Fraction of the per-step node displacement removed during Verlet integration.
+	ScalarType						mIntegratorDampingFactor;
+
+	// Solver currently used to evaluate the cloth network.
+	EClothSolverMode				mSolverMode;
+
+	// Array-based representation of the cloth network (nodes are indexed in row-major
+	// order - the node state precision is selected at run time).
+	CClothSpringArraySolver*		mpSpringArraySolver;
+
+	// Threads used to evaluate the spring array solver (NULL when a single thread is
+	// used).
+	CWorkerThreadPool*				mpWorkerThreadPool;
+
+	// External forces being evaluated by the worker threads.
+	const CExternalNodeForceCollection*
+									mpCurrentExternalForceCollection;
+
+	// Minimum number of nodes for which external forces are evaluated by each thread.
+	static const QuantityType		mkMinimumNodesPerThread;
+
+	// Rest state of each square region of grid nodes (spring array solvers).
+	ClothSleepRegionList			mSleepRegion;
+
+	// Mean kinetic energy per free node below which a region is at rest (zero if
+	// sleeping is disabled), and the number of successive steps for which a region must
+	// remain at rest before it sleeps.
+	ScalarType						mSleepEnergyThreshold;
+	QuantityType					mSleepStepCount;
 
-	// Base color for the cloth.
-	CFloatColor						mClothBaseColor;
+	// Number of grid nodes within sleeping regions.
+	QuantityType					mSleepingNodeCount;
 
-	// Specular highlight exponent.
-	ScalarType						mClothSpecularity;
+	// Number of grid nodes along each side of a sleeping region.
+	static const QuantityType		mkSleepRegionSize;
 
 	//Initialization constants
 
@@ -111,6 +111,10 @@ SOURCE=.\ClothScrollerScenesCommon.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\ClothSpringArraySolver.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\ScrollerManager.cpp
 # End Source File
 # End Group
@@ -143,6 +147,10 @@ SOURCE=.\ModelGeometryOpenGL.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\OpenGLExtensions.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\PrimitiveSupport.cpp
 # End Source File
 # Begin Source File
@@ -159,8 +167,16 @@ SOURCE=.\SceneRepOpenGL.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\SparseBlockMatrix.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\SystemSupport.cpp
 # End Source File
+# Begin Source File
+
+SOURCE=.\WorkerThreadPool.cpp
+# End Source File
 # End Group
 # Begin Group "ClothScroller Scenes (Source)"
 
@@ -191,12 +207,28 @@ SOURCE=.\SceneScrollerTrampoline.cpp
 # PROP Default_Filter ""
 # Begin Source File
 
+SOURCE=.\ClothNetworkBase.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\ExternalNodeForces.cpp
 # End Source File
 # Begin Source File
 
 SOURCE=.\PhysicalNode.cpp
 # End Source File
+# Begin Source File
+
+SOURCE=.\SpringForceKernels.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\WindFieldProducer.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\WindNoiseField.cpp
+# End Source File
 # End Group
 # End Group
 # Begin Group "Header Files"
@@ -227,6 +259,10 @@ SOURCE=.\ClothScrollerScenesCommon.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\ClothSpringArraySolver.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\ScrollerManager.h
 # End Source File
 # End Group
@@ -263,6 +299,10 @@ SOURCE=.\ModelGeometryOpenGL.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\OpenGLExtensions.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\PrimaryHeaders.h
 # End Source File
 # Begin Source File
@@ -287,8 +327,16 @@ SOURCE=.\SceneRepOpenGL.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\SparseBlockMatrix.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\SystemSupport.h
 # End Source File
+# Begin Source File
+
+SOURCE=.\WorkerThreadPool.h
+# End Source File
 # End Group
 # Begin Group "ClothScroller Scenes (Headers)"
 
@@ -323,12 +371,32 @@ SOURCE=.\SceneScrollerTrampoline.h
 # PROP Default_Filter ""
 # Begin Source File
 
+SOURCE=.\ClothNetworkBase.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\ExternalNodeForces.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\FixedGridCloth.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\PhysicalNode.h
 # End Source File
+# Begin Source File
+
+SOURCE=.\SpringForceKernels.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\WindFieldProducer.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\WindNoiseField.h
+# End Source File
 # End Group
 # End Group
 # Begin Group "Resource Files"
@@ -14,5 +14,44 @@
 //enabled. 
 #define	DOUBLE_PRECISION_RENDERCOORDS				0
 
+//SIMD (SSE2/AVX2) spring force kernels are compiled when this flag is enabled (the kernel that is
+//used is selected at run time, in accordance with processor capabilities).
+#define SIMD_SPRING_FORCE_KERNELS					1
+
+//SIMD spring force kernels determine spring lengths using the approximate reciprocal square root
+//(refined with Newton-Raphson iterations), in place of an exact square root and division, when this
+//flag is enabled.
+#define APPROXIMATE_SPRING_LENGTHS					0
+
+//Cloths with the grid dimensions used by the scenes (10 x 10 nodes) are represented by a compile-time
+//grid cloth (springs are evaluated as stencils, in place of a spring list) when this
+//flag is enabled - otherwise, all cloths are represented by the generic node network, and evaluated
+//by the spring array solver.
+#define FIXED_GRID_CLOTH								0
+
+//Wind noise is sampled from a precomputed lattice that is shared by all scenes when this flag is
+//enabled (otherwise, the wind noise function is evaluated for each node during every step).
+#define WIND_NOISE_FIELD							1
+
+//Wind forces are computed upon the wind noise field lattice by a background thread, and interpolated
+//by the simulation, when this flag is enabled (requires WIND_NOISE_FIELD; the thread is only
+//created on multi-processor systems).
+#define WIND_FIELD_PRODUCER_THREAD					1
+
+//Wind is applied to the cloth as an aerodynamic (lift/drag) force upon each surface triangle, in
+//place of the force applied to each node, when this flag is enabled (scene wind magnitudes and
+//damping are tuned for the per-node wind force).
+#define AERODYNAMIC_SURFACE_FORCE					0
+
+//Dynamic mesh vertices (the cloth) are streamed to OpenGL buffer objects when this flag is enabled
+//and buffer objects are supported by the rendering context (otherwise, meshes are rendered from
+//client-side vertex arrays).
+#define OPENGL_BUFFER_OBJECTS						1
+
+//Mesh texture images are uploaded through a ring of OpenGL pixel buffer objects (permitting the
+//transfer to the texture to proceed asynchronously) when this flag is enabled and pixel buffer
+//objects are supported (requires OPENGL_BUFFER_OBJECTS).
+#define OPENGL_PIXEL_BUFFER_UPLOAD					1
+
 
 #endif	// #ifndef _CLOTHSCROLLERDEFINES_H
\ No newline at end of file
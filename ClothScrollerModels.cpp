@@ -67,7 +67,7 @@ bool CGeneratedCylinder::GenerateModel()
 		this->ApplyCylinderSurfaceProperties(generatedPolygons);
 
 		//Set the created mesh to be the final balloon model.
-		this->mGeneratedMesh.SetModelGeometry(generatedPolygons);
+		this->mGeneratedMesh.AdoptModelGeometry(generatedPolygons);
 	}
 
 	return(bGeneratedSuccessfully);
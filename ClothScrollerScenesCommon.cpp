@@ -1,5 +1,6 @@
 
 #include "ClothScrollerScenesCommon.h"
+#include "WorkerThreadPool.h"
 
 
 CBaseClothScrollerSceneParamBlock::CBaseClothScrollerSceneParamBlock(
@@ -51,69 +52,201 @@ CBaseClothScrollerSceneParamBlock::~CBaseClothScrollerSceneParamBlock()
 
 CBaseClothScrollerScene::CBaseClothScrollerScene(const CBaseClothScrollerSceneParamBlock&
 												 initParameterBlock) :
-	mClothNodeNetwork(initParameterBlock.mNodesPerRow, initParameterBlock.mNodesPerColumn,
-		initParameterBlock.mNodeNetworkWidth, initParameterBlock.mNodeNetworkHeight,
-		initParameterBlock.mNetworkCoordOffset, initParameterBlock.mNodeMass,
-		initParameterBlock.mStructSpringConstant, initParameterBlock.mShearSpringConstant,
-		initParameterBlock.mFlexionSpringConstant),
+	mpClothNetwork(CBaseClothScrollerScene::CreateClothNetwork(initParameterBlock)),
+	mClothUpdatePeriod(initParameterBlock.mSimulationTimeQuantum),
 	mGravityForce(initParameterBlock.mGravitationalConstant, initParameterBlock.mGravityVector),
 	mWindForce(initParameterBlock.mWindDirection, initParameterBlock.mMaxWindMagnitude),
-	mViscousForce(initParameterBlock.mViscousCoefficient),
+	mpWindFieldProducer(NULL), mViscousForce(initParameterBlock.mViscousCoefficient),
+	mAerodynamicForce(CVector(0.0, 0.0, 0.0), CBaseClothScrollerScene::mkAerodynamicAirDensity,
+	CBaseClothScrollerScene::mkAerodynamicDragCoefficient,
+	CBaseClothScrollerScene::mkAerodynamicLiftCoefficient),
 	mScrollerTextColor(0.0, 0.0, 0.0), mScrollerBackgroundColor(1.0, 1.0, 1.0),
-	mpBackDropMesh(NULL), mBackdropCylinderColor(initParameterBlock.mBackdropCylinderColor)
+	mpBackDropMesh(NULL), mpClothMesh(NULL),
+	mBackdropCylinderColor(initParameterBlock.mBackdropCylinderColor)
 {
+#if WIND_NOISE_FIELD
+	// Sample the wind noise from the shared precomputed field.
+	if (!CBaseClothScrollerScene::mSharedWindNoiseField.IsValid()) {
+		CBaseClothScrollerScene::mSharedWindNoiseField.GenerateField(
+			CBaseClothScrollerScene::mkWindNoiseLatticeSize,
+			CBaseClothScrollerScene::mkWindNoiseLatticeSpacing,
+			CBaseClothScrollerScene::mkWindNoiseTimeSliceCount);
+	}
+
+	this->mWindForce.SetNoiseField(&CBaseClothScrollerScene::mSharedWindNoiseField);
+
+#if WIND_FIELD_PRODUCER_THREAD
+	// Compute the wind forces on a background thread when another processor is
+	// available to run the thread.
+	if (CWorkerThreadPool::GetProcessorCount() > 1) {
+		this->mpWindFieldProducer = new CWindFieldProducer(initParameterBlock.mWindDirection,
+			initParameterBlock.mMaxWindMagnitude, CBaseClothScrollerScene::mSharedWindNoiseField);
+
+		if (this->mpWindFieldProducer && this->mpWindFieldProducer->IsValid()) {
+			this->mWindForce.SetFieldProducer(this->mpWindFieldProducer);
+		}
+		else if (this->mpWindFieldProducer) {
+			delete(this->mpWindFieldProducer);
+			this->mpWindFieldProducer = NULL;
+		}
+	}
+#endif	// #if WIND_FIELD_PRODUCER_THREAD
+#endif	// #if WIND_NOISE_FIELD
+
+#if AERODYNAMIC_SURFACE_FORCE
+	// The aerodynamic wind blows along the scene wind direction.
+	CVector							windVelocity = initParameterBlock.mWindDirection;
+	windVelocity.Normalize();
+
+	this->mAerodynamicForce.SetWindVelocity(windVelocity *
+		CBaseClothScrollerScene::mkAerodynamicWindSpeed);
+#endif	// #if AERODYNAMIC_SURFACE_FORCE
+
 	//Add external forces to the external force collection.
 	this->BuildExternalForceCollection();
+
+	// Accumulate statistics as the cloth network is advanced.
+	if (this->mpClothNetwork) {
+		this->mpClothNetwork->SetSimulationObserver(&this->mClothSimulationCounters);
+	}
 }
 
 
 CBaseClothScrollerScene::~CBaseClothScrollerScene()
 {
+	if (this->mpClothNetwork) {
+		delete(this->mpClothNetwork);
+		this->mpClothNetwork = NULL;
+	}
 
+	if (this->mpWindFieldProducer) {
+		this->mWindForce.SetFieldProducer(NULL);
+		delete(this->mpWindFieldProducer);
+		this->mpWindFieldProducer = NULL;
+	}
 
+	if (this->mpClothMesh) {
+		delete(this->mpClothMesh);
+		this->mpClothMesh = NULL;
+	}
 }
 
 
 bool CBaseClothScrollerScene::BuildExternalForceCollection()
 {
+#if AERODYNAMIC_SURFACE_FORCE
+	// Add gravity and viscous damping forces to the collection of forces to be
+	// applied to the cloth nodes, and the aerodynamic wind force to be applied to the
+	// cloth surface.
+	bool							bForceCollectionBuiltSuccessfully =
+		(this->mExternalForceCollection).AddExternalNodeForce(this->mGravityForce) &&
+		(this->mExternalForceCollection).AddExternalNodeForce(this->mViscousForce) &&
+		(this->mExternalForceCollection).AddExternalSurfaceForce(this->mAerodynamicForce);
+#else
 	// Add gravity, wind and viscous damping forces to the collection of forces to be
 	// applied to the cloth nodes.
 	bool							bForceCollectionBuiltSuccessfully =
 		(this->mExternalForceCollection).AddExternalNodeForce(this->mGravityForce) &&
 		(this->mExternalForceCollection).AddExternalNodeForce(this->mWindForce) &&
 		(this->mExternalForceCollection).AddExternalNodeForce(this->mViscousForce);
+#endif	// #if AERODYNAMIC_SURFACE_FORCE
 
 	return(bForceCollectionBuiltSuccessfully);
 }
 
-bool CBaseClothScrollerScene::AddScrollerTextureLayer(CTextureCollection& textureCollection) const
+bool CBaseClothScrollerScene::SetStateInterpolation(const ScalarType interpolationFactor)
+{
+	return(this->mpClothNetwork->SetRenderInterpolation(interpolationFactor));
+}
+
+const CClothSimulationCounters& CBaseClothScrollerScene::GetClothSimulationCounters() const
+{
+	return(this->mClothSimulationCounters);
+}
+
+bool CBaseClothScrollerScene::AdvanceClothNetwork()
+{
+	// The scene manager performs one update per update period (the update period
+	// represents the scene simulation time quantum).
+	return(this->mpClothNetwork->AdvanceClothNodeNetwork(this->mExternalForceCollection,
+		this->mClothUpdatePeriod));
+}
+
+CClothNetworkBase* CBaseClothScrollerScene::CreateClothNetwork(const
+															   CBaseClothScrollerSceneParamBlock&
+															   parameterBlock)
+{
+	CClothNetworkBase*				pClothNetwork = NULL;
+
+#if FIXED_GRID_CLOTH
+	if ((parameterBlock.mNodesPerRow == kFixedGridNodesPerRow) &&
+		(parameterBlock.mNodesPerColumn == kFixedGridNodesPerColumn))
+	{
+		// Springs are evaluated as stencils with compile-time index strides.
+		pClothNetwork = new CFixedGridCloth<kFixedGridNodesPerRow, kFixedGridNodesPerColumn,
+			ScalarType>(parameterBlock.mNodeNetworkWidth, parameterBlock.mNodeNetworkHeight,
+			parameterBlock.mNetworkCoordOffset, parameterBlock.mNodeMass,
+			parameterBlock.mStructSpringConstant, parameterBlock.mShearSpringConstant,
+			parameterBlock.mFlexionSpringConstant);
+	}
+#endif	// #if FIXED_GRID_CLOTH
+
+	if (!pClothNetwork) {
+		CClothNodeNetwork*			pClothNodeNetwork = new CClothNodeNetwork(
+			parameterBlock.mNodesPerRow, parameterBlock.mNodesPerColumn,
+			parameterBlock.mNodeNetworkWidth, parameterBlock.mNodeNetworkHeight,
+			parameterBlock.mNetworkCoordOffset, parameterBlock.mNodeMass,
+			parameterBlock.mStructSpringConstant, parameterBlock.mShearSpringConstant,
+			parameterBlock.mFlexionSpringConstant);
+
+		// Evaluate the cloth using the spring array solver (each spring is evaluated
+		// once per step, with spring lengths optionally approximated by the SIMD
+		// spring force kernels).
+		pClothNodeNetwork->SetSolverMode(eClothSolverSpringArray);
+		pClothNodeNetwork->SetApproximateSpringLengths(APPROXIMATE_SPRING_LENGTHS != 0);
+
+		pClothNetwork = pClothNodeNetwork;
+	}
+
+	return(pClothNetwork);
+}
+
+bool CBaseClothScrollerScene::UpdateScrollerTexture(COpenGLGridMesh& clothMesh) const
 {
-	bool							bLayerAddedSuccessfully = false;
+	bool							bTextureUpdatedSuccessfully = false;
 
-	// Retrieve a scroller image pointer from the scroller manager.
-	void*							pScrollerImagePointer = NULL;
 	CScrollerManager::SetScrollerBackgroundColor(this->mScrollerBackgroundColor);
 	CScrollerManager::SetScrollerTextColor(this->mScrollerTextColor);
-	CScrollerManager::GetScrollerImageDataPointer(pScrollerImagePointer);
-
-	// Retrieve the image format from the scroller manager (dimensions, image size,
-	// bit depth)...
-	QuantityType					textureWidth = 0;
-	QuantityType					textureHeight = 0;
-	QuantityType					textureBitDepth = 0;
-	QuantityType					textureDataSize = 0;
-	if (CScrollerManager::GetScrollerImageFormat(textureWidth, textureHeight,
-		textureBitDepth, textureDataSize))
-	{
-		// Create a texture object using the retrieve texture, and add it to the
-		// cloth mesh.
-		CBaseTextureData				clothTexture(textureWidth, textureHeight,
-			textureBitDepth, textureDataSize, pScrollerImagePointer);
 
-		textureCollection.AddTextureLayer(clothTexture);
+	// The scroller image is only retrieved and uploaded if it has changed since it was
+	// last stored within the texture.
+	const QuantityType				scrollerImageRevision =
+		CScrollerManager::GetScrollerImageRevision();
+
+	if (clothMesh.IsTextureImageCurrent(scrollerImageRevision)) {
+		bTextureUpdatedSuccessfully = true;
+	}
+	else {
+		// Retrieve a scroller image pointer from the scroller manager.
+		void*						pScrollerImagePointer = NULL;
+		CScrollerManager::GetScrollerImageDataPointer(pScrollerImagePointer);
+
+		// Retrieve the image format from the scroller manager (dimensions, image size,
+		// bit depth)...
+		QuantityType				textureWidth = 0;
+		QuantityType				textureHeight = 0;
+		QuantityType				textureBitDepth = 0;
+		QuantityType				textureDataSize = 0;
+		if (CScrollerManager::GetScrollerImageFormat(textureWidth, textureHeight,
+			textureBitDepth, textureDataSize))
+		{
+			// ...And store the scroller image within the cloth mesh texture.
+			bTextureUpdatedSuccessfully = clothMesh.SetTextureImage(textureWidth,
+				textureHeight, pScrollerImagePointer, scrollerImageRevision);
+		}
 	}
 
-	return(bLayerAddedSuccessfully);
+	return(bTextureUpdatedSuccessfully);
 }
 
 
@@ -121,23 +254,64 @@ bool CBaseClothScrollerScene::RenderClothNetworkWithScrollerTexture() const
 {
 	bool							bClothRenderedSuccessfully = false;
 
-	// Create a mesh for the current cloth network...
-	CStaticMeshBase					clothMesh;
-	this->mClothNodeNetwork.GenerateNodeNetworkMesh(clothMesh);
+	if (this->mpClothMesh) {
+		// Overwrite the mesh vertices with the current cloth network state...
+		this->mpClothNetwork->GenerateNodeNetworkVertices(
+			this->mpClothMesh->GetVertexLocationArray(),
+			this->mpClothMesh->GetVertexNormalArray());
 
-	// Add the scroller texture to the cloth mesh.
-	CTextureCollection				clothTextureCollection;
-	this->AddScrollerTextureLayer(clothTextureCollection);
+		// ...Update the scroller texture (texture upload counters describe the most
+		// recently rendered frame), and render the cloth geometry.
+		this->mpClothMesh->ResetTextureUploadCounters();
+		this->UpdateScrollerTexture(*this->mpClothMesh);
 
-	clothMesh.SetModelTexture(clothTextureCollection);
-
-	// Create an OpenGL display list, and render the cloth geometry.
-	COpenGLStaticMesh				clothClothDisplayMesh(clothMesh);
-	bClothRenderedSuccessfully = clothClothDisplayMesh.RenderMesh();
+		bClothRenderedSuccessfully = this->mpClothMesh->RenderMesh();
+	}
 
 	return(bClothRenderedSuccessfully);
 }
 
+
+bool CBaseClothScrollerScene::GetClothTextureUploadCounters(CTextureUploadCounters&
+															 textureUploadCounters) const
+{
+	bool							bCountersRetrievedSuccessfully = false;
+
+	if (this->mpClothMesh) {
+		textureUploadCounters = this->mpClothMesh->GetTextureUploadCounters();
+
+		bCountersRetrievedSuccessfully = true;
+	}
+
+	return(bCountersRetrievedSuccessfully);
+}
+
+
+bool CBaseClothScrollerScene::SetupClothMesh()
+{
+	bool							bSetupSuccessfully = false;
+
+	// Create the cloth mesh if it does not already exist...
+	if (!this->mpClothMesh) {
+		QuantityType				nodesPerRow = 0;
+		QuantityType				nodesPerColumn = 0;
+
+		this->mpClothNetwork->GetNodeGridDimensions(nodesPerRow, nodesPerColumn);
+
+		this->mpClothMesh = new COpenGLGridMesh(nodesPerRow, nodesPerColumn);
+	}
+
+	if (this->mpClothMesh) {
+		// ...And apply the current cloth material.
+		this->mpClothMesh->SetMeshMaterial(this->mpClothNetwork->GetClothBaseColor(),
+			this->mpClothNetwork->GetClothSpecularity());
+
+		bSetupSuccessfully = this->mpClothMesh->IsValid();
+	}
+
+	return(bSetupSuccessfully);
+}
+
 bool CBaseClothScrollerScene::SetupBackDrop()
 {
 	bool							bSetupSuccessfully = false;
@@ -165,3 +339,19 @@ const QuantityType					CBaseClothScrollerScene::mDefaultBDxGridPoints = 10;
 const QuantityType					CBaseClothScrollerScene::mDefaultBDyGridPoints = 10;
 const ScalarType					CBaseClothScrollerScene::mDefaultCylinderRadius = 15.0;
 const ScalarType					CBaseClothScrollerScene::mDefaultCylinderHeight = 5000.0;
+
+// Wind noise field shared by all scenes.
+CWindNoiseField						CBaseClothScrollerScene::mSharedWindNoiseField;
+
+// Wind noise lattice dimensions (the lattice repeats every 12 m, and the gust factor
+// repeats every 32 clock ticks - the field occupies approximately 4 MB).
+const QuantityType					CBaseClothScrollerScene::mkWindNoiseLatticeSize = 32;
+const ScalarType					CBaseClothScrollerScene::mkWindNoiseLatticeSpacing = 0.375;
+const QuantityType					CBaseClothScrollerScene::mkWindNoiseTimeSliceCount = 32;
+
+// Aerodynamic wind parameters (sea-level air density, and coefficients approximating
+// those of a flat plate).
+const ScalarType					CBaseClothScrollerScene::mkAerodynamicWindSpeed = 6.0;
+const ScalarType					CBaseClothScrollerScene::mkAerodynamicAirDensity = 1.225;
+const ScalarType					CBaseClothScrollerScene::mkAerodynamicDragCoefficient = 1.2;
+const ScalarType					CBaseClothScrollerScene::mkAerodynamicLiftCoefficient = 0.6;
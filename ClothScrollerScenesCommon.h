@@ -7,7 +7,9 @@
 #include "SceneRepOpenGL.h"
 #include "ModelGeometryOpenGL.h"
 #include "ClothNodeNetwork.h"
+#include "FixedGridCloth.h"
 #include "ExternalNodeForces.h"
+#include "WindFieldProducer.h"
 #include "ClothScrollerModels.h"
 #include "ScrollerManager.h"
 
@@ -67,19 +69,53 @@ public:
 	// Adds all external forces to the external force collection.
 	bool							BuildExternalForceCollection();
 
+	// Sets the fraction of the next update period that has elapsed when the scene is
+	// rendered (the cloth is interpolated between its two most recent states).
+	virtual bool					SetStateInterpolation(const ScalarType
+		interpolationFactor);
+
+	// Retrieves the scroller texture uploads performed while the most recent frame was
+	// rendered.
+	bool							GetClothTextureUploadCounters(CTextureUploadCounters&
+		textureUploadCounters) const;
+
+	// Retrieves the cloth simulation statistics accumulated since the scene was
+	// constructed.
+	const CClothSimulationCounters&	GetClothSimulationCounters() const;
+
 protected:
-	// Adds a scroller texture layer to the texture collection object.
-	bool							AddScrollerTextureLayer(CTextureCollection&
-		textureCollection) const;
+	// Advances the cloth network by one scene update period (the network divides the
+	// period into steps that observe the stable time quantum).
+	bool							AdvanceClothNetwork();
+
+	// Stores the current scroller image within the texture of the cloth mesh.
+	bool							UpdateScrollerTexture(COpenGLGridMesh& clothMesh) const;
 
 	// Renders the cloth network, using the scroller texture.
 	bool							RenderClothNetworkWithScrollerTexture() const;
 
+	// Creates the persistent cloth mesh (once the cloth color and specularity have been
+	// set) - the mesh vertices are updated in place whenever the cloth is rendered.
+	bool							SetupClothMesh();
+
 	// Constructs the scene backdrop (default - cylinder alinged with the Z-axis).
 	virtual bool					SetupBackDrop();
 
-	// Cloth node network.
-	CClothNodeNetwork				mClothNodeNetwork;
+	// Creates the cloth network described by a scene parameter block (the generic node
+	// network, unless FIXED_GRID_CLOTH is enabled and the grid dimensions are those of
+	// the compile-time grid cloth).
+	static CClothNetworkBase*		CreateClothNetwork(const CBaseClothScrollerSceneParamBlock&
+		parameterBlock);
+
+	// Cloth node network (owned by the scene).
+	CClothNetworkBase*				mpClothNetwork;
+
+	// Simulated period (seconds) over which the cloth network is advanced during each
+	// scene update.
+	ScalarType						mClothUpdatePeriod;
+
+	// Cloth simulation statistics (observes the cloth network).
+	CClothSimulationCounters		mClothSimulationCounters;
 
 	// External force to be applied to the cloth - gravity.
 	CGravityNodeForce				mGravityForce;
@@ -87,9 +123,17 @@ protected:
 	// External force to be applied to the cloth - wind.
 	CWindNodeForce					mWindForce;
 
+	// Background producer of wind force frames (owned by the scene - NULL if wind
+	// forces are evaluated by the simulation thread).
+	CWindFieldProducer*				mpWindFieldProducer;
+
 	// External force to be applied to the cloth - viscous damping.
 	CViscousNodeForce				mViscousForce;
 
+	// External surface force to be applied to the cloth - aerodynamic wind (used in
+	// place of the wind node force when enabled).
+	CAerodynamicSurfaceForce		mAerodynamicForce;
+
 	// Collection of external forces (facilitates net external node
 	// force calculations).
 	CExternalNodeForceCollection	mExternalForceCollection;
@@ -103,12 +147,38 @@ protected:
 	// Backdrop mesh.
 	COpenGLStaticMesh*				mpBackDropMesh;
 
+	// Cloth mesh (owned by the scene).
+	COpenGLGridMesh*				mpClothMesh;
+
 	CFloatColor						mBackdropCylinderColor;
 
 	static const QuantityType		mDefaultBDxGridPoints;
 	static const QuantityType		mDefaultBDyGridPoints;
 	static const ScalarType			mDefaultCylinderRadius;
 	static const ScalarType			mDefaultCylinderHeight;
+
+	// Precomputed wind noise field (generated by the first scene that is constructed,
+	// and shared by all scenes).
+	static CWindNoiseField			mSharedWindNoiseField;
+
+	// Wind noise lattice dimensions - number of points along each axis, distance
+	// between points (m), and number of gust factor time slices.
+	static const QuantityType		mkWindNoiseLatticeSize;
+	static const ScalarType			mkWindNoiseLatticeSpacing;
+	static const QuantityType		mkWindNoiseTimeSliceCount;
+
+	// Aerodynamic wind parameters - wind speed (m/s), air density (kg/m^3), and the
+	// drag and lift coefficients of the cloth.
+	static const ScalarType			mkAerodynamicWindSpeed;
+	static const ScalarType			mkAerodynamicAirDensity;
+	static const ScalarType			mkAerodynamicDragCoefficient;
+	static const ScalarType			mkAerodynamicLiftCoefficient;
+
+	// Grid dimensions represented by the compile-time grid cloth.
+	enum {
+		kFixedGridNodesPerRow = 10,
+		kFixedGridNodesPerColumn = 10
+	};
 };
 
 
@@ -0,0 +1,1845 @@
+// ClothSpringArraySolver.cpp - Contains implementations for the spring-centric cloth solver,
+//                              which stores node state in contiguous arrays and evaluates
+//                              springs from a flat spring list.
+
+#include "ClothSpringArraySolver.h"
+#include <algorithm>
+
+
+/////
+// CClothSpringArraySolver class
+/////
+CClothSpringArraySolver::CClothSpringArraySolver() :
+	mNodeIntegrator(eNodeIntegratorEuler), mIntegratorDampingFactor(0.0),
+	mPreviousTimeQuantum(0.0), mConstraintSolverMethod(eConstraintSolverGaussSeidel),
+	mConstraintIterationCount(10), mMaximumSpringElongation(0.0), mStrainLimitIterationCount(0),
+	mbImplicitPatternBuilt(false),
+	mImplicitSolverIterationCount(0), mSpringForceKernel(NSpringForceKernels::GetPreferredKernel()),
+	mbApproximateSpringLengths(false),
+	mbSpringsColored(false), mpWorkerThreadPool(NULL),
+	mNodesPerBlock(1), mCurrentTask(eSolverTaskSpringForces), mCurrentTaskItemOffset(0),
+	mCurrentTimeQuantum(0.0)
+{
+
+}
+
+CClothSpringArraySolver::~CClothSpringArraySolver()
+{
+
+}
+
+
+CClothSpringArraySolver* CClothSpringArraySolver::CreateSpringArraySolver(const ESolverPrecision
+																		  solverPrecision)
+{
+	CClothSpringArraySolver*		pSpringArraySolver = NULL;
+
+	if (solverPrecision == eSolverPrecisionSingle) {
+		pSpringArraySolver = new CTypedClothSpringArraySolver<float>();
+	}
+	else {
+		pSpringArraySolver = new CTypedClothSpringArraySolver<double>();
+	}
+
+	return(pSpringArraySolver);
+}
+
+
+bool CClothSpringArraySolver::CopySpringArraySolver(const CClothSpringArraySolver& sourceSolver)
+{
+	bool							bCopiedSuccessfully = sourceSolver.IsValid() &&
+		this->AllocateNodes(sourceSolver.GetNodeCount());
+
+	// Copy the state of each node...
+	for (IndexType nodeLoop = 0; bCopiedSuccessfully &&
+		(nodeLoop < sourceSolver.GetNodeCount()); nodeLoop++)
+	{
+		bCopiedSuccessfully = this->SetNodeState(nodeLoop,
+			sourceSolver.GetNodeLocation(nodeLoop),
+			sourceSolver.GetNodeVelocityVector(nodeLoop),
+			sourceSolver.GetNodeMass(nodeLoop), sourceSolver.IsAnchorNode(nodeLoop));
+	}
+
+	// ...Each spring (springs are partitioned again before evaluation)...
+	for (IndexType springLoop = 0; bCopiedSuccessfully &&
+		(springLoop < sourceSolver.GetSpringCount()); springLoop++)
+	{
+		IndexType					headNodeIndex = 0;
+		IndexType					tailNodeIndex = 0;
+		ScalarType					springConstant = 0.0;
+		ScalarType					restingLength = 0.0;
+
+		bCopiedSuccessfully = sourceSolver.GetSpring(springLoop, headNodeIndex,
+			tailNodeIndex, springConstant, restingLength) && this->AddSpring(headNodeIndex,
+			tailNodeIndex, springConstant, restingLength);
+	}
+
+	// ...And the configuration settings (the previous node locations used by Verlet
+	// integration are determined from the node velocities).
+	if (bCopiedSuccessfully) {
+		this->mNodeIntegrator = sourceSolver.mNodeIntegrator;
+		this->mIntegratorDampingFactor = sourceSolver.mIntegratorDampingFactor;
+		this->mConstraintSolverMethod = sourceSolver.mConstraintSolverMethod;
+		this->mConstraintIterationCount = sourceSolver.mConstraintIterationCount;
+		this->mMaximumSpringElongation = sourceSolver.mMaximumSpringElongation;
+		this->mStrainLimitIterationCount = sourceSolver.mStrainLimitIterationCount;
+		this->mpWorkerThreadPool = sourceSolver.mpWorkerThreadPool;
+		this->mNodesPerBlock = sourceSolver.mNodesPerBlock;
+		this->mbApproximateSpringLengths = sourceSolver.mbApproximateSpringLengths;
+
+		bCopiedSuccessfully = this->SetSpringForceKernel(sourceSolver.mSpringForceKernel);
+	}
+
+	return(bCopiedSuccessfully);
+}
+
+
+bool CClothSpringArraySolver::IsValid() const
+{
+	// At least one node must exist, and all springs must reference existing
+	// nodes (springs are validated as they are added).
+	return(this->GetNodeCount() > 0);
+}
+
+
+bool CClothSpringArraySolver::SetNodeIntegrator(const ENodeIntegrator nodeIntegrator,
+												const ScalarType dampingFactor)
+{
+	bool							bIntegratorSetSuccessfully = false;
+
+	if ((dampingFactor >= 0.0) && (dampingFactor < 1.0)) {
+		if (nodeIntegrator != this->mNodeIntegrator) {
+			// The previous node locations will be determined from the node velocities.
+			this->mPreviousTimeQuantum = 0.0;
+		}
+
+		this->mNodeIntegrator = nodeIntegrator;
+		this->mIntegratorDampingFactor = dampingFactor;
+
+		bIntegratorSetSuccessfully = true;
+	}
+
+	return(bIntegratorSetSuccessfully);
+}
+
+
+ENodeIntegrator CClothSpringArraySolver::GetNodeIntegrator() const
+{
+	// Return the active node integration method.
+	return(this->mNodeIntegrator);
+}
+
+
+bool CClothSpringArraySolver::SetConstraintSolver(const EConstraintSolverMethod
+												  constraintSolverMethod,
+												  const QuantityType iterationCount)
+{
+	bool							bSolverSetSuccessfully = false;
+
+	if (iterationCount > 0) {
+		this->mConstraintSolverMethod = constraintSolverMethod;
+		this->mConstraintIterationCount = iterationCount;
+
+		bSolverSetSuccessfully = true;
+	}
+
+	return(bSolverSetSuccessfully);
+}
+
+
+bool CClothSpringArraySolver::SetStrainLimit(const ScalarType maximumElongation,
+											 const QuantityType iterationCount)
+{
+	bool							bStrainLimitSetSuccessfully = false;
+
+	if (maximumElongation >= 0.0) {
+		this->mMaximumSpringElongation = maximumElongation;
+		this->mStrainLimitIterationCount = iterationCount;
+
+		bStrainLimitSetSuccessfully = true;
+	}
+
+	return(bStrainLimitSetSuccessfully);
+}
+
+
+QuantityType CClothSpringArraySolver::GetImplicitSolverIterationCount() const
+{
+	return(this->mImplicitSolverIterationCount);
+}
+
+
+bool CClothSpringArraySolver::SetSpringForceKernel(const ESpringForceKernel
+												   springForceKernel)
+{
+	bool							bKernelSetSuccessfully = false;
+
+	if (NSpringForceKernels::IsKernelSupported(springForceKernel)) {
+		this->mSpringForceKernel = springForceKernel;
+
+		bKernelSetSuccessfully = true;
+	}
+
+	return(bKernelSetSuccessfully);
+}
+
+
+ESpringForceKernel CClothSpringArraySolver::GetSpringForceKernel() const
+{
+	// Return the active spring force kernel.
+	return(this->mSpringForceKernel);
+}
+
+
+void CClothSpringArraySolver::SetApproximateSpringLengths(const bool bApproximateSpringLengths)
+{
+	this->mbApproximateSpringLengths = bApproximateSpringLengths;
+}
+
+
+bool CClothSpringArraySolver::UsesApproximateSpringLengths() const
+{
+	return(this->mbApproximateSpringLengths);
+}
+
+
+bool CClothSpringArraySolver::SetWorkerThreadPool(CWorkerThreadPool* pWorkerThreadPool,
+												  const QuantityType nodesPerBlock)
+{
+	bool							bThreadPoolSetSuccessfully = false;
+
+	if (nodesPerBlock > 0) {
+		this->mpWorkerThreadPool = pWorkerThreadPool;
+		this->mNodesPerBlock = nodesPerBlock;
+
+		bThreadPoolSetSuccessfully = true;
+	}
+
+	return(bThreadPoolSetSuccessfully);
+}
+
+
+QuantityType CClothSpringArraySolver::SolveImplicitSystem()
+{
+	const QuantityType				vectorSize = this->GetNodeCount() * 3;
+
+	QuantityType					iterationCount = 0;
+
+	// Initial solution of zero - residual = right-hand side (anchor node components
+	// of the right-hand side are zero), search direction = preconditioned residual.
+	ScalarType						residualProduct = 0.0;
+
+	for (IndexType componentLoop = 0; componentLoop < vectorSize; componentLoop++) {
+		this->mImplicitVelocityChange[componentLoop] = 0.0;
+		this->mImplicitResidual[componentLoop] = this->mImplicitRightHandSide[componentLoop];
+		this->mImplicitPreconditionedResidual[componentLoop] =
+			this->mImplicitResidual[componentLoop] * this->mImplicitPreconditioner[componentLoop];
+		this->mImplicitSearchDirection[componentLoop] =
+			this->mImplicitPreconditionedResidual[componentLoop];
+
+		residualProduct += this->mImplicitResidual[componentLoop] *
+			this->mImplicitPreconditionedResidual[componentLoop];
+	}
+
+	const ScalarType				targetResidualProduct = residualProduct *
+		mkImplicitSolverTolerance * mkImplicitSolverTolerance;
+
+	while ((iterationCount < mkImplicitSolverMaxIterations) && (residualProduct > 0.0) &&
+		(residualProduct > targetResidualProduct))
+	{
+		// Matrix/search direction product (anchor node components are filtered).
+		this->mImplicitSystemMatrix.Multiply(&this->mImplicitSearchDirection[0],
+			&this->mImplicitMatrixProduct[0]);
+
+		ScalarType					directionProduct = 0.0;
+
+		for (IndexType componentLoop = 0; componentLoop < vectorSize; componentLoop++) {
+			if (this->mImplicitPreconditioner[componentLoop] == 0.0) {
+				this->mImplicitMatrixProduct[componentLoop] = 0.0;
+			}
+
+			directionProduct += this->mImplicitSearchDirection[componentLoop] *
+				this->mImplicitMatrixProduct[componentLoop];
+		}
+
+		if (directionProduct <= 0.0) {
+			break;
+		}
+
+		// Advance the solution along the search direction, and update the residual.
+		const ScalarType			stepScale = residualProduct / directionProduct;
+		ScalarType					newResidualProduct = 0.0;
+
+		for (IndexType componentLoop = 0; componentLoop < vectorSize; componentLoop++) {
+			this->mImplicitVelocityChange[componentLoop] += stepScale *
+				this->mImplicitSearchDirection[componentLoop];
+			this->mImplicitResidual[componentLoop] -= stepScale *
+				this->mImplicitMatrixProduct[componentLoop];
+			this->mImplicitPreconditionedResidual[componentLoop] =
+				this->mImplicitResidual[componentLoop] *
+				this->mImplicitPreconditioner[componentLoop];
+
+			newResidualProduct += this->mImplicitResidual[componentLoop] *
+				this->mImplicitPreconditionedResidual[componentLoop];
+		}
+
+		// Determine the next search direction.
+		const ScalarType			directionScale = newResidualProduct / residualProduct;
+
+		for (IndexType componentLoop = 0; componentLoop < vectorSize; componentLoop++) {
+			this->mImplicitSearchDirection[componentLoop] =
+				this->mImplicitPreconditionedResidual[componentLoop] +
+				(directionScale * this->mImplicitSearchDirection[componentLoop]);
+		}
+
+		residualProduct = newResidualProduct;
+		iterationCount++;
+	}
+
+	return(iterationCount);
+}
+
+
+bool CClothSpringArraySolver::ExecuteParallelTask(const ESolverTask solverTask,
+												  const IndexType itemOffset,
+												  const QuantityType itemCount,
+												  const QuantityType minimumItemsPerBlock)
+{
+	bool							bTaskExecutedSuccessfully = false;
+
+	if (this->mpWorkerThreadPool) {
+		this->mCurrentTask = solverTask;
+		this->mCurrentTaskItemOffset = itemOffset;
+
+		bTaskExecutedSuccessfully = this->mpWorkerThreadPool->ExecuteTask(*this, itemCount,
+			minimumItemsPerBlock);
+	}
+
+	return(bTaskExecutedSuccessfully);
+}
+
+
+/////
+// CTypedClothSpringArraySolver class
+/////
+template <class scalarType>
+CTypedClothSpringArraySolver<scalarType>::CTypedClothSpringArraySolver()
+{
+
+}
+
+template <class scalarType>
+CTypedClothSpringArraySolver<scalarType>::~CTypedClothSpringArraySolver()
+{
+
+}
+
+
+template <class scalarType>
+ESolverPrecision CTypedClothSpringArraySolver<scalarType>::GetSolverPrecision() const
+{
+	// Single-precision values are smaller than double-precision values.
+	return((sizeof(scalarType) < sizeof(double)) ? eSolverPrecisionSingle :
+		eSolverPrecisionDouble);
+}
+
+
+template <class scalarType>
+bool CTypedClothSpringArraySolver<scalarType>::AllocateNodes(const QuantityType nodeCount)
+{
+	bool							bAllocatedSuccessfully = false;
+
+	if (nodeCount > 0) {
+		// Discard any existing springs (spring indices may no longer be valid).
+		this->mSpringHeadIndex.clear();
+		this->mSpringTailIndex.clear();
+		this->mSpringConstant.clear();
+		this->mSpringRestingLength.clear();
+		this->mSpringForceX.clear();
+		this->mSpringForceY.clear();
+		this->mSpringForceZ.clear();
+		this->mSpringLagrangeMultiplier.clear();
+		this->mbImplicitPatternBuilt = false;
+
+		// Allocate the node state arrays - all nodes are initially stationary,
+		// located at the origin, and have no pending force.
+		this->mNodeLocationX.assign(nodeCount, 0.0);
+		this->mNodeLocationY.assign(nodeCount, 0.0);
+		this->mNodeLocationZ.assign(nodeCount, 0.0);
+
+		this->mNodeVelocityX.assign(nodeCount, 0.0);
+		this->mNodeVelocityY.assign(nodeCount, 0.0);
+		this->mNodeVelocityZ.assign(nodeCount, 0.0);
+
+		this->mNodeForceX.assign(nodeCount, 0.0);
+		this->mNodeForceY.assign(nodeCount, 0.0);
+		this->mNodeForceZ.assign(nodeCount, 0.0);
+
+		this->mNodePreviousLocationX.assign(nodeCount, 0.0);
+		this->mNodePreviousLocationY.assign(nodeCount, 0.0);
+		this->mNodePreviousLocationZ.assign(nodeCount, 0.0);
+		this->mPreviousTimeQuantum = 0.0;
+
+		this->mNodeMass.assign(nodeCount, 0.0);
+		this->mNodeInverseMass.assign(nodeCount, 0.0);
+		this->mbIsSleepingNode.assign(nodeCount, false);
+
+		// Nodes become free once their mass has been set.
+		this->mFreeNodeIndex.clear();
+		this->mFreeNodeIndex.reserve(nodeCount);
+
+		bAllocatedSuccessfully = true;
+	}
+
+	return(bAllocatedSuccessfully);
+}
+
+
+template <class scalarType>
+bool CTypedClothSpringArraySolver<scalarType>::AddSpring(const IndexType headNodeIndex,
+														 const IndexType tailNodeIndex,
+														 const ScalarType springConstant,
+														 const ScalarType restingLength)
+{
+	bool							bSpringAddedSuccessfully = false;
+
+	// Both spring terminals must reference existing (and distinct) nodes, and the
+	// spring must not have a negative length.
+	if ((headNodeIndex < this->GetNodeCount()) && (tailNodeIndex < this->GetNodeCount()) &&
+		(headNodeIndex != tailNodeIndex) && (restingLength >= 0.0))
+	{
+		this->mSpringHeadIndex.push_back(headNodeIndex);
+		this->mSpringTailIndex.push_back(tailNodeIndex);
+		this->mSpringConstant.push_back(springConstant);
+		this->mSpringRestingLength.push_back(restingLength);
+		this->mSpringForceX.push_back(0.0);
+		this->mSpringForceY.push_back(0.0);
+		this->mSpringForceZ.push_back(0.0);
+		this->mSpringLagrangeMultiplier.push_back(0.0);
+
+		// The springs must be partitioned again before evaluation (the implicit system
+		// matrix pattern is rebuilt after the springs are partitioned).
+		this->mbSpringsColored = false;
+		this->mbImplicitPatternBuilt = false;
+
+		bSpringAddedSuccessfully = true;
+	}
+
+	return(bSpringAddedSuccessfully);
+}
+
+
+template <class scalarType>
+bool CTypedClothSpringArraySolver<scalarType>::GetSpring(const IndexType springIndex,
+														 IndexType& headNodeIndex,
+														 IndexType& tailNodeIndex,
+														 ScalarType& springConstant,
+														 ScalarType& restingLength) const
+{
+	bool							bSpringRetrievedSuccessfully = false;
+
+	if (springIndex < this->GetSpringCount()) {
+		headNodeIndex = this->mSpringHeadIndex[springIndex];
+		tailNodeIndex = this->mSpringTailIndex[springIndex];
+		springConstant = this->mSpringConstant[springIndex];
+		restingLength = this->mSpringRestingLength[springIndex];
+
+		bSpringRetrievedSuccessfully = true;
+	}
+
+	return(bSpringRetrievedSuccessfully);
+}
+
+
+template <class scalarType>
+QuantityType CTypedClothSpringArraySolver<scalarType>::GetNodeCount() const
+{
+	// Return the number of nodes stored in the node arrays.
+	return(this->mNodeMass.size());
+}
+
+
+template <class scalarType>
+QuantityType CTypedClothSpringArraySolver<scalarType>::GetSpringCount() const
+{
+	// Return the number of springs stored in the spring arrays.
+	return(this->mSpringConstant.size());
+}
+
+
+template <class scalarType>
+bool CTypedClothSpringArraySolver<scalarType>::SetNodeState(const IndexType nodeIndex,
+															const CFloatPoint& nodeLocation,
+															const CVector& velocityVector,
+															const ScalarType nodeMass,
+															const bool bIsAnchorNode)
+{
+	bool							bStateSetSuccessfully = false;
+
+	if ((nodeIndex < this->GetNodeCount()) && (nodeMass > 0.0)) {
+		this->mNodeLocationX[nodeIndex] = nodeLocation.GetXCoord();
+		this->mNodeLocationY[nodeIndex] = nodeLocation.GetYCoord();
+		this->mNodeLocationZ[nodeIndex] = nodeLocation.GetZCoord();
+
+		this->mNodeVelocityX[nodeIndex] = velocityVector.GetXComponent();
+		this->mNodeVelocityY[nodeIndex] = velocityVector.GetYComponent();
+		this->mNodeVelocityZ[nodeIndex] = velocityVector.GetZComponent();
+
+		this->mNodeMass[nodeIndex] = nodeMass;
+
+		// The previous node locations (Verlet integration) will be determined from
+		// the node velocities.
+		this->mPreviousTimeQuantum = 0.0;
+
+		bStateSetSuccessfully = this->SetAnchorNodeStatus(nodeIndex, bIsAnchorNode);
+	}
+
+	return(bStateSetSuccessfully);
+}
+
+
+template <class scalarType>
+bool CTypedClothSpringArraySolver<scalarType>::SetAnchorNodeStatus(const IndexType nodeIndex,
+																   const bool bIsAnchorNode)
+{
+	bool							bStatusSetSuccessfully = false;
+
+	if ((nodeIndex < this->GetNodeCount()) && (this->mNodeMass[nodeIndex] > 0.0)) {
+		// Locate the node within the free node list.
+		const IndexArrayType::iterator
+									freeNodeIterator = std::lower_bound(
+									this->mFreeNodeIndex.begin(), this->mFreeNodeIndex.end(),
+									nodeIndex);
+		const bool					bNodeListed = (freeNodeIterator !=
+			this->mFreeNodeIndex.end()) && (*freeNodeIterator == nodeIndex);
+
+		// Anchor node designations wake sleeping nodes.
+		this->mbIsSleepingNode[nodeIndex] = false;
+
+		if (bIsAnchorNode) {
+			// Anchor nodes have an "infinite" mass - applied forces will not
+			// produce any motion.
+			this->mNodeInverseMass[nodeIndex] = 0.0;
+
+			this->mNodeVelocityX[nodeIndex] = 0.0;
+			this->mNodeVelocityY[nodeIndex] = 0.0;
+			this->mNodeVelocityZ[nodeIndex] = 0.0;
+
+			if (bNodeListed) {
+				this->mFreeNodeIndex.erase(freeNodeIterator);
+			}
+		}
+		else {
+			this->mNodeInverseMass[nodeIndex] = 1.0 / this->mNodeMass[nodeIndex];
+
+			if (!bNodeListed) {
+				this->mFreeNodeIndex.insert(freeNodeIterator, nodeIndex);
+			}
+		}
+
+		bStatusSetSuccessfully = true;
+	}
+
+	return(bStatusSetSuccessfully);
+}
+
+
+template <class scalarType>
+bool CTypedClothSpringArraySolver<scalarType>::SetSleepingNodeStatus(const IndexType nodeIndex,
+																	 const bool bIsSleepingNode)
+{
+	bool							bStatusSetSuccessfully = false;
+
+	if ((nodeIndex < this->GetNodeCount()) && !this->IsAnchorNode(nodeIndex) &&
+		(this->mNodeMass[nodeIndex] > 0.0))
+	{
+		// Locate the node within the free node list.
+		const IndexArrayType::iterator
+									freeNodeIterator = std::lower_bound(
+									this->mFreeNodeIndex.begin(), this->mFreeNodeIndex.end(),
+									nodeIndex);
+
+		if (bIsSleepingNode && !this->mbIsSleepingNode[nodeIndex]) {
+			// Sleeping nodes are stopped, and are held in place in the same manner as
+			// anchor nodes.
+			this->mNodeInverseMass[nodeIndex] = 0.0;
+
+			this->mNodeVelocityX[nodeIndex] = 0.0;
+			this->mNodeVelocityY[nodeIndex] = 0.0;
+			this->mNodeVelocityZ[nodeIndex] = 0.0;
+
+			this->mFreeNodeIndex.erase(freeNodeIterator);
+		}
+		else if (!bIsSleepingNode && this->mbIsSleepingNode[nodeIndex]) {
+			this->mNodeInverseMass[nodeIndex] = 1.0 / this->mNodeMass[nodeIndex];
+			this->mFreeNodeIndex.insert(freeNodeIterator, nodeIndex);
+
+			// The node resumes from rest (Verlet integration).
+			this->mNodePreviousLocationX[nodeIndex] = this->mNodeLocationX[nodeIndex];
+			this->mNodePreviousLocationY[nodeIndex] = this->mNodeLocationY[nodeIndex];
+			this->mNodePreviousLocationZ[nodeIndex] = this->mNodeLocationZ[nodeIndex];
+		}
+
+		this->mbIsSleepingNode[nodeIndex] = bIsSleepingNode;
+
+		bStatusSetSuccessfully = true;
+	}
+
+	return(bStatusSetSuccessfully);
+}
+
+
+template <class scalarType>
+CFloatPoint CTypedClothSpringArraySolver<scalarType>::GetNodeLocation(const IndexType nodeIndex) const
+{
+	CFloatPoint						nodeLocation(0.0, 0.0, 0.0);
+
+	if (nodeIndex < this->GetNodeCount()) {
+		nodeLocation = CFloatPoint(this->mNodeLocationX[nodeIndex],
+			this->mNodeLocationY[nodeIndex], this->mNodeLocationZ[nodeIndex]);
+	}
+
+	return(nodeLocation);
+}
+
+
+template <class scalarType>
+CVector CTypedClothSpringArraySolver<scalarType>::GetNodeVelocityVector(const IndexType nodeIndex) const
+{
+	CVector							velocityVector(0.0, 0.0, 0.0);
+
+	if (nodeIndex < this->GetNodeCount()) {
+		velocityVector = CVector(this->mNodeVelocityX[nodeIndex],
+			this->mNodeVelocityY[nodeIndex], this->mNodeVelocityZ[nodeIndex]);
+	}
+
+	return(velocityVector);
+}
+
+
+template <class scalarType>
+ScalarType CTypedClothSpringArraySolver<scalarType>::GetNodeMass(const IndexType nodeIndex) const
+{
+	ScalarType						nodeMass = 0.0;
+
+	if (nodeIndex < this->GetNodeCount()) {
+		nodeMass = this->mNodeMass[nodeIndex];
+	}
+
+	return(nodeMass);
+}
+
+
+template <class scalarType>
+bool CTypedClothSpringArraySolver<scalarType>::IsAnchorNode(const IndexType nodeIndex) const
+{
+	// Anchor nodes are designated by a zero inverse mass (sleeping nodes also have a
+	// zero inverse mass).
+	return((nodeIndex < this->GetNodeCount()) &&
+		(this->mNodeInverseMass[nodeIndex] == 0.0) && !this->mbIsSleepingNode[nodeIndex]);
+}
+
+
+template <class scalarType>
+bool CTypedClothSpringArraySolver<scalarType>::IsSleepingNode(const IndexType nodeIndex) const
+{
+	return((nodeIndex < this->GetNodeCount()) && this->mbIsSleepingNode[nodeIndex]);
+}
+
+
+template <class scalarType>
+QuantityType CTypedClothSpringArraySolver<scalarType>::GetFreeNodeCount() const
+{
+	return(this->mFreeNodeIndex.size());
+}
+
+
+template <class scalarType>
+IndexType CTypedClothSpringArraySolver<scalarType>::GetFreeNodeIndex(const IndexType
+																freeNodeListIndex) const
+{
+	// The node count is returned for invalid list indices.
+	return((freeNodeListIndex < this->GetFreeNodeCount()) ?
+		this->mFreeNodeIndex[freeNodeListIndex] : this->GetNodeCount());
+}
+
+
+template <class scalarType>
+bool CTypedClothSpringArraySolver<scalarType>::SetNodeForceVector(const IndexType nodeIndex,
+																  const CVector& forceVector)
+{
+	bool							bForceSetSuccessfully = false;
+
+	if (nodeIndex < this->GetNodeCount()) {
+		this->mNodeForceX[nodeIndex] = forceVector.GetXComponent();
+		this->mNodeForceY[nodeIndex] = forceVector.GetYComponent();
+		this->mNodeForceZ[nodeIndex] = forceVector.GetZComponent();
+
+		bForceSetSuccessfully = true;
+	}
+
+	return(bForceSetSuccessfully);
+}
+
+
+template <class scalarType>
+bool CTypedClothSpringArraySolver<scalarType>::EvaluateExternalForces(
+	const CExternalNodeForceCollection&	externalNodeForceCollection,
+	const IndexType firstFreeNodeIndex, const IndexType endFreeNodeIndex,
+	const ScalarType timeQuantum)
+{
+	bool							bEvaluatedSuccessfully =
+		(firstFreeNodeIndex <= endFreeNodeIndex) &&
+		(endFreeNodeIndex <= this->GetFreeNodeCount());
+
+	ScalarType						nodeLocationX[kExternalForceBatchSize];
+	ScalarType						nodeLocationY[kExternalForceBatchSize];
+	ScalarType						nodeLocationZ[kExternalForceBatchSize];
+	ScalarType						nodeVelocityX[kExternalForceBatchSize];
+	ScalarType						nodeVelocityY[kExternalForceBatchSize];
+	ScalarType						nodeVelocityZ[kExternalForceBatchSize];
+	ScalarType						nodeMass[kExternalForceBatchSize];
+	ScalarType						nodeForceX[kExternalForceBatchSize];
+	ScalarType						nodeForceY[kExternalForceBatchSize];
+	ScalarType						nodeForceZ[kExternalForceBatchSize];
+
+	for (IndexType batchStartIndex = firstFreeNodeIndex; bEvaluatedSuccessfully &&
+		(batchStartIndex < endFreeNodeIndex); batchStartIndex += kExternalForceBatchSize)
+	{
+		const QuantityType			batchNodeCount =
+			((endFreeNodeIndex - batchStartIndex) < kExternalForceBatchSize) ?
+			(endFreeNodeIndex - batchStartIndex) : (QuantityType)kExternalForceBatchSize;
+
+		// Gather the state of the free nodes within the batch...
+		for (IndexType gatherLoop = 0; gatherLoop < batchNodeCount; gatherLoop++) {
+			const IndexType			nodeIndex =
+				this->mFreeNodeIndex[batchStartIndex + gatherLoop];
+
+			nodeLocationX[gatherLoop] = this->mNodeLocationX[nodeIndex];
+			nodeLocationY[gatherLoop] = this->mNodeLocationY[nodeIndex];
+			nodeLocationZ[gatherLoop] = this->mNodeLocationZ[nodeIndex];
+			nodeVelocityX[gatherLoop] = this->mNodeVelocityX[nodeIndex];
+			nodeVelocityY[gatherLoop] = this->mNodeVelocityY[nodeIndex];
+			nodeVelocityZ[gatherLoop] = this->mNodeVelocityZ[nodeIndex];
+			nodeMass[gatherLoop] = this->mNodeMass[nodeIndex];
+		}
+
+		// ...Evaluate all external forces for the batch...
+		const CExternalForceNodeBatch
+									nodeBatch(batchNodeCount, nodeLocationX, nodeLocationY,
+			nodeLocationZ, nodeVelocityX, nodeVelocityY, nodeVelocityZ, nodeMass,
+			nodeForceX, nodeForceY, nodeForceZ);
+
+		externalNodeForceCollection.EvaluateExternalForces(nodeBatch, timeQuantum);
+
+		// ...And store the resulting pending forces.
+		for (IndexType scatterLoop = 0; scatterLoop < batchNodeCount; scatterLoop++) {
+			const IndexType			nodeIndex =
+				this->mFreeNodeIndex[batchStartIndex + scatterLoop];
+
+			this->mNodeForceX[nodeIndex] = (scalarType)nodeForceX[scatterLoop];
+			this->mNodeForceY[nodeIndex] = (scalarType)nodeForceY[scatterLoop];
+			this->mNodeForceZ[nodeIndex] = (scalarType)nodeForceZ[scatterLoop];
+		}
+	}
+
+	return(bEvaluatedSuccessfully);
+}
+
+
+template <class scalarType>
+bool CTypedClothSpringArraySolver<scalarType>::AccumulateSurfaceForces(
+	const CExternalNodeForceCollection&	externalNodeForceCollection,
+	const QuantityType nodesPerRow, const QuantityType nodesPerColumn)
+{
+	bool							bAccumulatedSuccessfully =
+		((nodesPerRow * nodesPerColumn) == this->GetNodeCount());
+
+	if (bAccumulatedSuccessfully && externalNodeForceCollection.HasSurfaceForces()) {
+		// Stage the state of every node (surface forces depend upon anchor nodes)...
+		this->mSurfaceForceGrid.AllocateGrid(nodesPerRow, nodesPerColumn);
+
+		std::copy(this->mNodeLocationX.begin(), this->mNodeLocationX.end(),
+			this->mSurfaceForceGrid.mNodeLocationX.begin());
+		std::copy(this->mNodeLocationY.begin(), this->mNodeLocationY.end(),
+			this->mSurfaceForceGrid.mNodeLocationY.begin());
+		std::copy(this->mNodeLocationZ.begin(), this->mNodeLocationZ.end(),
+			this->mSurfaceForceGrid.mNodeLocationZ.begin());
+		std::copy(this->mNodeVelocityX.begin(), this->mNodeVelocityX.end(),
+			this->mSurfaceForceGrid.mNodeVelocityX.begin());
+		std::copy(this->mNodeVelocityY.begin(), this->mNodeVelocityY.end(),
+			this->mSurfaceForceGrid.mNodeVelocityY.begin());
+		std::copy(this->mNodeVelocityZ.begin(), this->mNodeVelocityZ.end(),
+			this->mSurfaceForceGrid.mNodeVelocityZ.begin());
+
+		// ...Evaluate the surface forces...
+		externalNodeForceCollection.EvaluateSurfaceForces(
+			this->mSurfaceForceGrid.GetNodeGrid());
+
+		// ...And add the forces of the free nodes to the pending forces.
+		for (IndexType freeNodeLoop = 0; freeNodeLoop < this->GetFreeNodeCount();
+			freeNodeLoop++)
+		{
+			const IndexType			nodeIndex = this->mFreeNodeIndex[freeNodeLoop];
+
+			this->mNodeForceX[nodeIndex] +=
+				(scalarType)this->mSurfaceForceGrid.mNodeForceX[nodeIndex];
+			this->mNodeForceY[nodeIndex] +=
+				(scalarType)this->mSurfaceForceGrid.mNodeForceY[nodeIndex];
+			this->mNodeForceZ[nodeIndex] +=
+				(scalarType)this->mSurfaceForceGrid.mNodeForceZ[nodeIndex];
+		}
+	}
+
+	return(bAccumulatedSuccessfully);
+}
+
+
+template <class scalarType>
+bool CTypedClothSpringArraySolver<scalarType>::AccumulateSpringForces()
+{
+	bool							bAccumulatedSuccessfully = this->IsValid();
+
+	const QuantityType				springCount = this->GetSpringCount();
+
+	if (bAccumulatedSuccessfully && (springCount > 0)) {
+		// Partition the springs into color groups (spring order is altered - the
+		// springs must be partitioned before the first evaluation, so that results do
+		// not depend upon the use of threads).
+		if (!this->mbSpringsColored) {
+			bAccumulatedSuccessfully = this->ColorSprings();
+		}
+
+		const CSpringForceKernelBlock<scalarType>
+									kernelBlock = this->GetSpringForceKernelBlock(0,
+									springCount);
+
+		// Evaluate the force produced by each spring (agreement between the SIMD and
+		// scalar kernels is established by the spring force kernel tests, rather than
+		// during evaluation).
+		if (this->mpWorkerThreadPool) {
+			bAccumulatedSuccessfully = this->ExecuteParallelTask(eSolverTaskSpringForces,
+				0, springCount, mkMinimumSpringsPerThread) && bAccumulatedSuccessfully;
+		}
+		else {
+			bAccumulatedSuccessfully = NSpringForceKernels::EvaluateSpringForces(
+				this->mSpringForceKernel, kernelBlock) && bAccumulatedSuccessfully;
+		}
+
+		// Apply the spring forces to the nodes (springs within a color group do not
+		// share nodes, and can be applied concurrently).
+		if (this->mpWorkerThreadPool) {
+			const QuantityType		colorGroupCount = this->mSpringColorGroupStart.size() - 1;
+
+			for (IndexType groupLoop = 0; groupLoop < colorGroupCount; groupLoop++) {
+				const IndexType		firstSpringIndex = this->mSpringColorGroupStart[groupLoop];
+				const IndexType		endSpringIndex = this->mSpringColorGroupStart[groupLoop + 1];
+
+				if ((groupLoop + 1) < colorGroupCount) {
+					this->ExecuteParallelTask(eSolverTaskSpringApplication, firstSpringIndex,
+						endSpringIndex - firstSpringIndex, mkMinimumSpringsPerThread);
+				}
+				else {
+					// Springs within the last group (springs without a color) may
+					// share nodes.
+					this->ApplySpringForces(firstSpringIndex, endSpringIndex);
+				}
+			}
+		}
+		else {
+			this->ApplySpringForces(0, springCount);
+		}
+	}
+
+	return(bAccumulatedSuccessfully);
+}
+
+
+template <class scalarType>
+bool CTypedClothSpringArraySolver<scalarType>::ApplyNodeForces(const ScalarType timeQuantum)
+{
+	bool							bAppliedSuccessfully = false;
+
+	if (this->IsValid() && (timeQuantum > 0.0)) {
+		const QuantityType			freeNodeCount = this->GetFreeNodeCount();
+
+		// Verlet integration relies upon a constant time quantum - determine the
+		// previous node locations from the node velocities when the time quantum
+		// changes.
+		if ((this->mNodeIntegrator == eNodeIntegratorVerlet) &&
+			(this->mPreviousTimeQuantum != timeQuantum))
+		{
+			this->ResetPreviousNodeLocations((scalarType)timeQuantum);
+		}
+
+		if (this->mNodeIntegrator == eNodeIntegratorImplicitEuler) {
+			// The implicit system couples all nodes.
+			bAppliedSuccessfully = this->IntegrateNodesImplicit(timeQuantum);
+		}
+		else {
+			if (this->mpWorkerThreadPool && (freeNodeCount > 0)) {
+				// Integrate blocks of free nodes concurrently.
+				const QuantityType	nodeBlockCount = (freeNodeCount + this->mNodesPerBlock -
+					1) / this->mNodesPerBlock;
+
+				this->mCurrentTimeQuantum = timeQuantum;
+
+				bAppliedSuccessfully = this->ExecuteParallelTask(eSolverTaskNodeIntegration,
+					0, nodeBlockCount, (mkMinimumNodesPerThread + this->mNodesPerBlock - 1) /
+					this->mNodesPerBlock);
+			}
+			else {
+				if (this->mNodeIntegrator == eNodeIntegratorVerlet) {
+					this->IntegrateNodesVerlet(0, freeNodeCount, (scalarType)timeQuantum);
+				}
+				else {
+					this->IntegrateNodes(0, freeNodeCount, (scalarType)timeQuantum);
+				}
+
+				bAppliedSuccessfully = true;
+			}
+
+			// Clear the pending forces after they have been applied (spring forces are
+			// also accumulated for anchor nodes).
+			this->ClearNodeForces();
+		}
+
+		// Constrain the spring lengths after the nodes have been moved.
+		if (this->mStrainLimitIterationCount > 0) {
+			this->ApplyStrainLimits((scalarType)timeQuantum);
+		}
+
+		this->mPreviousTimeQuantum = timeQuantum;
+	}
+
+	return(bAppliedSuccessfully);
+}
+
+
+template <class scalarType>
+ScalarType CTypedClothSpringArraySolver<scalarType>::EstimateStableTimeQuantum() const
+{
+	ScalarType						stableTimeQuantum = 0.0;
+
+	const QuantityType				springCount = this->GetSpringCount();
+
+	if (this->IsValid()) {
+		// Sum the spring constants of the springs attached to each node - each row of the
+		// stiffness matrix contains the sum on the diagonal, along with off-diagonal
+		// values of equal total magnitude.
+		ScalarArrayType				nodeStiffnessSum(this->GetNodeCount(), 0.0);
+
+		for (IndexType springLoop = 0; springLoop < springCount; springLoop++) {
+			const ScalarType		springConstant = ::fabs(this->mSpringConstant[springLoop]);
+
+			nodeStiffnessSum[this->mSpringHeadIndex[springLoop]] += springConstant;
+			nodeStiffnessSum[this->mSpringTailIndex[springLoop]] += springConstant;
+		}
+
+		// Largest eigenvalue <= max(2 x Stiffness Sum / Mass) (anchor nodes do not move -
+		// sleeping nodes move once they are woken).
+		ScalarType					maximumEigenvalue = 0.0;
+
+		for (IndexType nodeLoop = 0; nodeLoop < this->GetNodeCount(); nodeLoop++) {
+			const ScalarType		nodeInverseMass = this->mbIsSleepingNode[nodeLoop] ?
+				(1.0 / this->mNodeMass[nodeLoop]) : this->mNodeInverseMass[nodeLoop];
+			const ScalarType		eigenvalueBound = 2.0 * nodeStiffnessSum[nodeLoop] *
+				nodeInverseMass;
+
+			if (eigenvalueBound > maximumEigenvalue) {
+				maximumEigenvalue = eigenvalueBound;
+			}
+		}
+
+		// Explicit integration of an oscillator with angular frequency w is stable when
+		// Time x w < 2.
+		if (maximumEigenvalue > 0.0) {
+			stableTimeQuantum = 2.0 / ::sqrt(maximumEigenvalue);
+		}
+	}
+
+	return(stableTimeQuantum);
+}
+
+
+template <class scalarType>
+bool CTypedClothSpringArraySolver<scalarType>::SolvePositionConstraints(const ScalarType timeQuantum)
+{
+	bool							bSolvedSuccessfully = false;
+
+	const QuantityType				springCount = this->GetSpringCount();
+
+	if (this->IsValid() && (timeQuantum > 0.0)) {
+		// Partition the springs into color groups (Jacobi corrections are applied one
+		// group at a time - results do not depend upon the use of threads).
+		bSolvedSuccessfully = this->mbSpringsColored || this->ColorSprings();
+
+		// Move the nodes without regard to the springs...
+		this->PredictNodeLocations((scalarType)timeQuantum);
+
+		// ...Correct the node locations to satisfy the spring constraints (compliance
+		// is scaled by the inverse of the squared time quantum)...
+		const scalarType			complianceScale = (scalarType)(1.0 /
+			(timeQuantum * timeQuantum));
+
+		std::fill(this->mSpringLagrangeMultiplier.begin(),
+			this->mSpringLagrangeMultiplier.end(), 0.0);
+
+		for (IndexType iterationLoop = 0; (springCount > 0) &&
+			(iterationLoop < this->mConstraintIterationCount); iterationLoop++)
+		{
+			if (this->mConstraintSolverMethod == eConstraintSolverJacobi) {
+				this->mCurrentTimeQuantum = timeQuantum;
+
+				if (!this->mpWorkerThreadPool || !this->ExecuteParallelTask(
+					eSolverTaskConstraintCorrection, 0, springCount,
+					mkMinimumSpringsPerThread))
+				{
+					this->EvaluateConstraintCorrections(0, springCount, complianceScale);
+				}
+
+				// Springs within a color group do not share nodes.
+				const QuantityType	colorGroupCount = this->mSpringColorGroupStart.size() - 1;
+
+				for (IndexType groupLoop = 0; groupLoop < colorGroupCount; groupLoop++) {
+					const IndexType	firstSpringIndex = this->mSpringColorGroupStart[groupLoop];
+					const IndexType	endSpringIndex = this->mSpringColorGroupStart[groupLoop + 1];
+
+					if (!this->mpWorkerThreadPool || ((groupLoop + 1) == colorGroupCount) ||
+						!this->ExecuteParallelTask(eSolverTaskConstraintApplication,
+						firstSpringIndex, endSpringIndex - firstSpringIndex,
+						mkMinimumSpringsPerThread))
+					{
+						this->ApplyConstraintCorrections(firstSpringIndex, endSpringIndex);
+					}
+				}
+			}
+			else {
+				this->SolveDistanceConstraints(0, springCount, complianceScale);
+			}
+		}
+
+		// ...And determine the node velocities from the corrected locations (anchor nodes
+		// remain stationary).
+		const ScalarType			inverseTimeQuantum = 1.0 / timeQuantum;
+
+		for (IndexType nodeLoop = 0; nodeLoop < this->GetNodeCount(); nodeLoop++) {
+			if (this->mNodeInverseMass[nodeLoop] > 0.0) {
+				this->mNodeVelocityX[nodeLoop] = (this->mNodeLocationX[nodeLoop] -
+					this->mNodePreviousLocationX[nodeLoop]) * inverseTimeQuantum;
+				this->mNodeVelocityY[nodeLoop] = (this->mNodeLocationY[nodeLoop] -
+					this->mNodePreviousLocationY[nodeLoop]) * inverseTimeQuantum;
+				this->mNodeVelocityZ[nodeLoop] = (this->mNodeLocationZ[nodeLoop] -
+					this->mNodePreviousLocationZ[nodeLoop]) * inverseTimeQuantum;
+			}
+		}
+
+		// The previous node locations are valid for Verlet integration.
+		this->mPreviousTimeQuantum = timeQuantum;
+	}
+
+	return(bSolvedSuccessfully);
+}
+
+
+template <class scalarType>
+void CTypedClothSpringArraySolver<scalarType>::ExecuteRange(const IndexType firstIndex,
+															const IndexType endIndex)
+{
+	const IndexType					firstItemIndex = firstIndex + this->mCurrentTaskItemOffset;
+	const IndexType					endItemIndex = endIndex + this->mCurrentTaskItemOffset;
+
+	if (this->mCurrentTask == eSolverTaskSpringForces) {
+		NSpringForceKernels::EvaluateSpringForces(this->mSpringForceKernel,
+			this->GetSpringForceKernelBlock(firstItemIndex, endItemIndex));
+	}
+	else if (this->mCurrentTask == eSolverTaskSpringApplication) {
+		this->ApplySpringForces(firstItemIndex, endItemIndex);
+	}
+	else if (this->mCurrentTask == eSolverTaskConstraintCorrection) {
+		this->EvaluateConstraintCorrections(firstItemIndex, endItemIndex,
+			(scalarType)(1.0 / (this->mCurrentTimeQuantum * this->mCurrentTimeQuantum)));
+	}
+	else if (this->mCurrentTask == eSolverTaskConstraintApplication) {
+		this->ApplyConstraintCorrections(firstItemIndex, endItemIndex);
+	}
+	else if (this->mCurrentTask == eSolverTaskNodeIntegration) {
+		// Convert the node block range into a free node list range.
+		const QuantityType			freeNodeCount = this->GetFreeNodeCount();
+		const IndexType				firstFreeNodeIndex = firstItemIndex * this->mNodesPerBlock;
+		const IndexType				endFreeNodeIndex = endItemIndex * this->mNodesPerBlock;
+
+		if (this->mNodeIntegrator == eNodeIntegratorVerlet) {
+			this->IntegrateNodesVerlet(firstFreeNodeIndex, (endFreeNodeIndex < freeNodeCount) ?
+				endFreeNodeIndex : freeNodeCount, (scalarType)this->mCurrentTimeQuantum);
+		}
+		else {
+			this->IntegrateNodes(firstFreeNodeIndex, (endFreeNodeIndex < freeNodeCount) ?
+				endFreeNodeIndex : freeNodeCount, (scalarType)this->mCurrentTimeQuantum);
+		}
+	}
+}
+
+
+template <class scalarType>
+CSpringForceKernelBlock<scalarType> CTypedClothSpringArraySolver<scalarType>::GetSpringForceKernelBlock(
+	const IndexType firstSpringIndex, const IndexType endSpringIndex)
+{
+	CSpringForceKernelBlock<scalarType>
+									kernelBlock;
+
+	if ((this->GetNodeCount() > 0) && (firstSpringIndex < endSpringIndex) &&
+		(endSpringIndex <= this->GetSpringCount()))
+	{
+		kernelBlock.mpNodeLocationX = &this->mNodeLocationX[0];
+		kernelBlock.mpNodeLocationY = &this->mNodeLocationY[0];
+		kernelBlock.mpNodeLocationZ = &this->mNodeLocationZ[0];
+
+		kernelBlock.mpSpringHeadIndex = &this->mSpringHeadIndex[firstSpringIndex];
+		kernelBlock.mpSpringTailIndex = &this->mSpringTailIndex[firstSpringIndex];
+		kernelBlock.mpSpringConstant = &this->mSpringConstant[firstSpringIndex];
+		kernelBlock.mpSpringRestingLength = &this->mSpringRestingLength[firstSpringIndex];
+
+		kernelBlock.mpSpringForceX = &this->mSpringForceX[firstSpringIndex];
+		kernelBlock.mpSpringForceY = &this->mSpringForceY[firstSpringIndex];
+		kernelBlock.mpSpringForceZ = &this->mSpringForceZ[firstSpringIndex];
+
+		kernelBlock.mSpringCount = endSpringIndex - firstSpringIndex;
+		kernelBlock.mbApproximateReciprocalSqrt = this->mbApproximateSpringLengths;
+	}
+
+	return(kernelBlock);
+}
+
+
+template <class scalarType>
+bool CTypedClothSpringArraySolver<scalarType>::ColorSprings()
+{
+	bool							bColoredSuccessfully = false;
+
+	const QuantityType				springCount = this->GetSpringCount();
+
+	if (this->IsValid()) {
+		// Colors used by the springs attached to each node (one bit per color).
+		std::vector<unsigned long>	nodeColorMask(this->GetNodeCount(), 0);
+
+		// Color assigned to each spring (springs that cannot be assigned a color are
+		// assigned to the final group).
+		IndexArrayType				springColor(springCount, mkMaxSpringColorCount);
+		IndexArrayType				colorGroupSpringCount(mkMaxSpringColorCount + 1, 0);
+
+		// Assign the lowest color that is not in use at either spring terminal.
+		for (IndexType springLoop = 0; springLoop < springCount; springLoop++) {
+			const IndexType			headIndex = this->mSpringHeadIndex[springLoop];
+			const IndexType			tailIndex = this->mSpringTailIndex[springLoop];
+			const unsigned long		usedColorMask = nodeColorMask[headIndex] |
+				nodeColorMask[tailIndex];
+
+			IndexType				springColorIndex = 0;
+
+			while ((springColorIndex < mkMaxSpringColorCount) &&
+				(usedColorMask & (1UL << springColorIndex)))
+			{
+				springColorIndex++;
+			}
+
+			if (springColorIndex < mkMaxSpringColorCount) {
+				nodeColorMask[headIndex] |= (1UL << springColorIndex);
+				nodeColorMask[tailIndex] |= (1UL << springColorIndex);
+			}
+
+			springColor[springLoop] = springColorIndex;
+			colorGroupSpringCount[springColorIndex]++;
+		}
+
+		// Determine the starting spring index of each group (empty color groups are
+		// omitted - the group of springs without a color is always present).
+		this->mSpringColorGroupStart.clear();
+		this->mSpringColorGroupStart.push_back(0);
+
+		IndexArrayType				colorGroupIndex(mkMaxSpringColorCount + 1, 0);
+
+		for (IndexType colorLoop = 0; colorLoop <= mkMaxSpringColorCount; colorLoop++) {
+			colorGroupIndex[colorLoop] = this->mSpringColorGroupStart.back();
+
+			if ((colorGroupSpringCount[colorLoop] > 0) ||
+				(colorLoop == mkMaxSpringColorCount))
+			{
+				this->mSpringColorGroupStart.push_back(this->mSpringColorGroupStart.back() +
+					colorGroupSpringCount[colorLoop]);
+			}
+		}
+
+		// Reorder the springs by group (the original order is retained within each
+		// group).
+		IndexArrayType				headIndex(springCount);
+		IndexArrayType				tailIndex(springCount);
+		NodeArrayType				springConstant(springCount);
+		NodeArrayType				springRestingLength(springCount);
+
+		for (IndexType springLoop = 0; springLoop < springCount; springLoop++) {
+			const IndexType			targetIndex = colorGroupIndex[springColor[springLoop]]++;
+
+			headIndex[targetIndex] = this->mSpringHeadIndex[springLoop];
+			tailIndex[targetIndex] = this->mSpringTailIndex[springLoop];
+			springConstant[targetIndex] = this->mSpringConstant[springLoop];
+			springRestingLength[targetIndex] = this->mSpringRestingLength[springLoop];
+		}
+
+		this->mSpringHeadIndex.swap(headIndex);
+		this->mSpringTailIndex.swap(tailIndex);
+		this->mSpringConstant.swap(springConstant);
+		this->mSpringRestingLength.swap(springRestingLength);
+
+		this->mbSpringsColored = true;
+		this->mbImplicitPatternBuilt = false;
+
+		bColoredSuccessfully = true;
+	}
+
+	return(bColoredSuccessfully);
+}
+
+
+template <class scalarType>
+void CTypedClothSpringArraySolver<scalarType>::ApplySpringForces(const IndexType firstSpringIndex,
+																 const IndexType endSpringIndex)
+{
+	// Apply each spring force to the head node, and the equal and opposite force to
+	// the tail node.
+	for (IndexType springLoop = firstSpringIndex; springLoop < endSpringIndex; springLoop++) {
+		const IndexType				headIndex = this->mSpringHeadIndex[springLoop];
+		const IndexType				tailIndex = this->mSpringTailIndex[springLoop];
+
+		this->mNodeForceX[headIndex] += this->mSpringForceX[springLoop];
+		this->mNodeForceY[headIndex] += this->mSpringForceY[springLoop];
+		this->mNodeForceZ[headIndex] += this->mSpringForceZ[springLoop];
+
+		this->mNodeForceX[tailIndex] -= this->mSpringForceX[springLoop];
+		this->mNodeForceY[tailIndex] -= this->mSpringForceY[springLoop];
+		this->mNodeForceZ[tailIndex] -= this->mSpringForceZ[springLoop];
+	}
+}
+
+
+template <class scalarType>
+void CTypedClothSpringArraySolver<scalarType>::IntegrateNodes(const IndexType firstFreeNodeIndex,
+															  const IndexType endFreeNodeIndex,
+															  const scalarType timeQuantum)
+{
+	for (IndexType freeNodeLoop = firstFreeNodeIndex; freeNodeLoop < endFreeNodeIndex;
+		freeNodeLoop++)
+	{
+		// Acceleration = Force (N) / Mass (kg) (anchor nodes are not within the free
+		// node list).
+		const IndexType				nodeIndex = this->mFreeNodeIndex[freeNodeLoop];
+		const scalarType			inverseMass = this->mNodeInverseMass[nodeIndex];
+
+		const scalarType			accelerationX = this->mNodeForceX[nodeIndex] * inverseMass;
+		const scalarType			accelerationY = this->mNodeForceY[nodeIndex] * inverseMass;
+		const scalarType			accelerationZ = this->mNodeForceZ[nodeIndex] * inverseMass;
+
+		// Displacement = (Velocity x Time) + (Acceleration x Time^2) - this matches the
+		// single-node evaluation in CPhysicalNodeBase::ApplyForceVector(...).
+		this->mNodeLocationX[nodeIndex] += (this->mNodeVelocityX[nodeIndex] * timeQuantum) +
+			(accelerationX * timeQuantum * timeQuantum);
+		this->mNodeLocationY[nodeIndex] += (this->mNodeVelocityY[nodeIndex] * timeQuantum) +
+			(accelerationY * timeQuantum * timeQuantum);
+		this->mNodeLocationZ[nodeIndex] += (this->mNodeVelocityZ[nodeIndex] * timeQuantum) +
+			(accelerationZ * timeQuantum * timeQuantum);
+
+		// Velocity = Velocity + (Acceleration x Time)
+		this->mNodeVelocityX[nodeIndex] += accelerationX * timeQuantum;
+		this->mNodeVelocityY[nodeIndex] += accelerationY * timeQuantum;
+		this->mNodeVelocityZ[nodeIndex] += accelerationZ * timeQuantum;
+	}
+}
+
+
+template <class scalarType>
+void CTypedClothSpringArraySolver<scalarType>::IntegrateNodesVerlet(const IndexType firstFreeNodeIndex,
+																	const IndexType endFreeNodeIndex,
+																	const scalarType timeQuantum)
+{
+	const scalarType				inertiaFactor = 1.0 - this->mIntegratorDampingFactor;
+	const scalarType				timeQuantumSquared = timeQuantum * timeQuantum;
+	const scalarType				inverseTimeQuantum = 1.0 / timeQuantum;
+
+	for (IndexType freeNodeLoop = firstFreeNodeIndex; freeNodeLoop < endFreeNodeIndex;
+		freeNodeLoop++)
+	{
+		// Acceleration = Force (N) / Mass (kg) (anchor nodes are not within the free
+		// node list).
+		const IndexType				nodeIndex = this->mFreeNodeIndex[freeNodeLoop];
+		const scalarType			inverseMass = this->mNodeInverseMass[nodeIndex];
+
+		const scalarType			currentLocationX = this->mNodeLocationX[nodeIndex];
+		const scalarType			currentLocationY = this->mNodeLocationY[nodeIndex];
+		const scalarType			currentLocationZ = this->mNodeLocationZ[nodeIndex];
+
+		// Displacement = ((Location - Previous Location) x (1 - Damping)) +
+		//	(Acceleration x Time^2) - this matches the single-node evaluation in
+		// CPhysicalNodeBase::ApplyForceVectorVerlet(...).
+		const scalarType			displacementX = ((currentLocationX -
+			this->mNodePreviousLocationX[nodeIndex]) * inertiaFactor) +
+			(this->mNodeForceX[nodeIndex] * inverseMass * timeQuantumSquared);
+		const scalarType			displacementY = ((currentLocationY -
+			this->mNodePreviousLocationY[nodeIndex]) * inertiaFactor) +
+			(this->mNodeForceY[nodeIndex] * inverseMass * timeQuantumSquared);
+		const scalarType			displacementZ = ((currentLocationZ -
+			this->mNodePreviousLocationZ[nodeIndex]) * inertiaFactor) +
+			(this->mNodeForceZ[nodeIndex] * inverseMass * timeQuantumSquared);
+
+		this->mNodeLocationX[nodeIndex] = currentLocationX + displacementX;
+		this->mNodeLocationY[nodeIndex] = currentLocationY + displacementY;
+		this->mNodeLocationZ[nodeIndex] = currentLocationZ + displacementZ;
+
+		this->mNodePreviousLocationX[nodeIndex] = currentLocationX;
+		this->mNodePreviousLocationY[nodeIndex] = currentLocationY;
+		this->mNodePreviousLocationZ[nodeIndex] = currentLocationZ;
+
+		// The velocity is implied by the displacement.
+		this->mNodeVelocityX[nodeIndex] = displacementX * inverseTimeQuantum;
+		this->mNodeVelocityY[nodeIndex] = displacementY * inverseTimeQuantum;
+		this->mNodeVelocityZ[nodeIndex] = displacementZ * inverseTimeQuantum;
+	}
+}
+
+
+template <class scalarType>
+void CTypedClothSpringArraySolver<scalarType>::ClearNodeForces()
+{
+	std::fill(this->mNodeForceX.begin(), this->mNodeForceX.end(), 0.0);
+	std::fill(this->mNodeForceY.begin(), this->mNodeForceY.end(), 0.0);
+	std::fill(this->mNodeForceZ.begin(), this->mNodeForceZ.end(), 0.0);
+}
+
+
+template <class scalarType>
+void CTypedClothSpringArraySolver<scalarType>::ResetPreviousNodeLocations(const scalarType timeQuantum)
+{
+	// Previous Location = Location - (Velocity x Time)
+	for (IndexType nodeLoop = 0; nodeLoop < this->GetNodeCount(); nodeLoop++) {
+		this->mNodePreviousLocationX[nodeLoop] = this->mNodeLocationX[nodeLoop] -
+			(this->mNodeVelocityX[nodeLoop] * timeQuantum);
+		this->mNodePreviousLocationY[nodeLoop] = this->mNodeLocationY[nodeLoop] -
+			(this->mNodeVelocityY[nodeLoop] * timeQuantum);
+		this->mNodePreviousLocationZ[nodeLoop] = this->mNodeLocationZ[nodeLoop] -
+			(this->mNodeVelocityZ[nodeLoop] * timeQuantum);
+	}
+}
+
+
+template <class scalarType>
+void CTypedClothSpringArraySolver<scalarType>::PredictNodeLocations(const scalarType timeQuantum)
+{
+	for (IndexType nodeLoop = 0; nodeLoop < this->GetNodeCount(); nodeLoop++) {
+		const scalarType			inverseMass = this->mNodeInverseMass[nodeLoop];
+
+		this->mNodePreviousLocationX[nodeLoop] = this->mNodeLocationX[nodeLoop];
+		this->mNodePreviousLocationY[nodeLoop] = this->mNodeLocationY[nodeLoop];
+		this->mNodePreviousLocationZ[nodeLoop] = this->mNodeLocationZ[nodeLoop];
+
+		if (inverseMass > 0.0) {
+			// Velocity = Velocity + (Acceleration x Time), Location = Location +
+			// (Velocity x Time)
+			this->mNodeVelocityX[nodeLoop] += this->mNodeForceX[nodeLoop] * inverseMass *
+				timeQuantum;
+			this->mNodeVelocityY[nodeLoop] += this->mNodeForceY[nodeLoop] * inverseMass *
+				timeQuantum;
+			this->mNodeVelocityZ[nodeLoop] += this->mNodeForceZ[nodeLoop] * inverseMass *
+				timeQuantum;
+
+			this->mNodeLocationX[nodeLoop] += this->mNodeVelocityX[nodeLoop] * timeQuantum;
+			this->mNodeLocationY[nodeLoop] += this->mNodeVelocityY[nodeLoop] * timeQuantum;
+			this->mNodeLocationZ[nodeLoop] += this->mNodeVelocityZ[nodeLoop] * timeQuantum;
+		}
+
+		// Clear the force after it has been applied.
+		this->mNodeForceX[nodeLoop] = 0.0;
+		this->mNodeForceY[nodeLoop] = 0.0;
+		this->mNodeForceZ[nodeLoop] = 0.0;
+	}
+}
+
+
+template <class scalarType>
+void CTypedClothSpringArraySolver<scalarType>::SolveDistanceConstraints(const IndexType firstSpringIndex,
+																		const IndexType endSpringIndex,
+																		const scalarType complianceScale)
+{
+	for (IndexType springLoop = firstSpringIndex; springLoop < endSpringIndex; springLoop++) {
+		const IndexType				headIndex = this->mSpringHeadIndex[springLoop];
+		const IndexType				tailIndex = this->mSpringTailIndex[springLoop];
+
+		const scalarType			inverseMassSum = this->mNodeInverseMass[headIndex] +
+			this->mNodeInverseMass[tailIndex];
+
+		const scalarType			deltaX = this->mNodeLocationX[headIndex] -
+			this->mNodeLocationX[tailIndex];
+		const scalarType			deltaY = this->mNodeLocationY[headIndex] -
+			this->mNodeLocationY[tailIndex];
+		const scalarType			deltaZ = this->mNodeLocationZ[headIndex] -
+			this->mNodeLocationZ[tailIndex];
+
+		const scalarType			springLength = (scalarType)::sqrt((deltaX * deltaX) +
+			(deltaY * deltaY) + (deltaZ * deltaZ));
+
+		if ((springLength > 0.0) && (inverseMassSum > 0.0) &&
+			(this->mSpringConstant[springLoop] > 0.0))
+		{
+			// Lagrange multiplier change = -(C + (a x lambda)) / (w1 + w2 + a), where C is
+			// the constraint value (length - resting length), and a is the scaled
+			// compliance.
+			const scalarType		compliance = complianceScale /
+				this->mSpringConstant[springLoop];
+			const scalarType		multiplierChange = -((springLength -
+				this->mSpringRestingLength[springLoop]) + (compliance *
+				this->mSpringLagrangeMultiplier[springLoop])) / (inverseMassSum + compliance);
+
+			this->mSpringLagrangeMultiplier[springLoop] += multiplierChange;
+
+			// Move the nodes along the spring, in proportion to the inverse node masses.
+			const scalarType		correctionScale = multiplierChange / springLength;
+			const scalarType		headScale = correctionScale *
+				this->mNodeInverseMass[headIndex];
+			const scalarType		tailScale = -correctionScale *
+				this->mNodeInverseMass[tailIndex];
+
+			this->mNodeLocationX[headIndex] += deltaX * headScale;
+			this->mNodeLocationY[headIndex] += deltaY * headScale;
+			this->mNodeLocationZ[headIndex] += deltaZ * headScale;
+
+			this->mNodeLocationX[tailIndex] += deltaX * tailScale;
+			this->mNodeLocationY[tailIndex] += deltaY * tailScale;
+			this->mNodeLocationZ[tailIndex] += deltaZ * tailScale;
+		}
+	}
+}
+
+
+template <class scalarType>
+void CTypedClothSpringArraySolver<scalarType>::EvaluateConstraintCorrections(const IndexType firstSpringIndex,
+																			 const IndexType endSpringIndex,
+																			 const scalarType complianceScale)
+{
+	for (IndexType springLoop = firstSpringIndex; springLoop < endSpringIndex; springLoop++) {
+		const IndexType				headIndex = this->mSpringHeadIndex[springLoop];
+		const IndexType				tailIndex = this->mSpringTailIndex[springLoop];
+
+		const scalarType			inverseMassSum = this->mNodeInverseMass[headIndex] +
+			this->mNodeInverseMass[tailIndex];
+
+		const scalarType			deltaX = this->mNodeLocationX[headIndex] -
+			this->mNodeLocationX[tailIndex];
+		const scalarType			deltaY = this->mNodeLocationY[headIndex] -
+			this->mNodeLocationY[tailIndex];
+		const scalarType			deltaZ = this->mNodeLocationZ[headIndex] -
+			this->mNodeLocationZ[tailIndex];
+
+		const scalarType			springLength = (scalarType)::sqrt((deltaX * deltaX) +
+			(deltaY * deltaY) + (deltaZ * deltaZ));
+
+		scalarType					correctionScale = 0.0;
+
+		if ((springLength > 0.0) && (inverseMassSum > 0.0) &&
+			(this->mSpringConstant[springLoop] > 0.0))
+		{
+			// (See SolveDistanceConstraints(...) - the multiplier change is relaxed, as
+			// the corrections of all constraints are applied together).
+			const scalarType		compliance = complianceScale /
+				this->mSpringConstant[springLoop];
+			const scalarType		multiplierChange = -((springLength -
+				this->mSpringRestingLength[springLoop]) + (compliance *
+				this->mSpringLagrangeMultiplier[springLoop])) / (inverseMassSum + compliance) *
+				mkJacobiRelaxationFactor;
+
+			this->mSpringLagrangeMultiplier[springLoop] += multiplierChange;
+
+			correctionScale = multiplierChange / springLength;
+		}
+
+		this->mSpringForceX[springLoop] = deltaX * correctionScale;
+		this->mSpringForceY[springLoop] = deltaY * correctionScale;
+		this->mSpringForceZ[springLoop] = deltaZ * correctionScale;
+	}
+}
+
+
+template <class scalarType>
+void CTypedClothSpringArraySolver<scalarType>::ApplyConstraintCorrections(const IndexType firstSpringIndex,
+																		  const IndexType endSpringIndex)
+{
+	// Move the nodes along the spring, in proportion to the inverse node masses.
+	for (IndexType springLoop = firstSpringIndex; springLoop < endSpringIndex; springLoop++) {
+		const IndexType				headIndex = this->mSpringHeadIndex[springLoop];
+		const IndexType				tailIndex = this->mSpringTailIndex[springLoop];
+
+		const scalarType			headInverseMass = this->mNodeInverseMass[headIndex];
+		const scalarType			tailInverseMass = this->mNodeInverseMass[tailIndex];
+
+		this->mNodeLocationX[headIndex] += this->mSpringForceX[springLoop] * headInverseMass;
+		this->mNodeLocationY[headIndex] += this->mSpringForceY[springLoop] * headInverseMass;
+		this->mNodeLocationZ[headIndex] += this->mSpringForceZ[springLoop] * headInverseMass;
+
+		this->mNodeLocationX[tailIndex] -= this->mSpringForceX[springLoop] * tailInverseMass;
+		this->mNodeLocationY[tailIndex] -= this->mSpringForceY[springLoop] * tailInverseMass;
+		this->mNodeLocationZ[tailIndex] -= this->mSpringForceZ[springLoop] * tailInverseMass;
+	}
+}
+
+
+template <class scalarType>
+void CTypedClothSpringArraySolver<scalarType>::ApplyStrainLimits(const scalarType timeQuantum)
+{
+	const QuantityType				springCount = this->GetSpringCount();
+	const scalarType				maximumLengthScale = 1.0 + this->mMaximumSpringElongation;
+	const scalarType				inverseTimeQuantum = 1.0 / timeQuantum;
+
+	bool							bNodesCorrected = true;
+
+	// Correct the springs in sequence (corrected node locations are used by subsequent
+	// springs), until no spring exceeds the maximum elongation, or the iteration limit
+	// is reached.
+	for (IndexType iterationLoop = 0; bNodesCorrected &&
+		(iterationLoop < this->mStrainLimitIterationCount); iterationLoop++)
+	{
+		bNodesCorrected = false;
+
+		for (IndexType springLoop = 0; springLoop < springCount; springLoop++) {
+			const IndexType			headIndex = this->mSpringHeadIndex[springLoop];
+			const IndexType			tailIndex = this->mSpringTailIndex[springLoop];
+
+			const scalarType		deltaX = this->mNodeLocationX[headIndex] -
+				this->mNodeLocationX[tailIndex];
+			const scalarType		deltaY = this->mNodeLocationY[headIndex] -
+				this->mNodeLocationY[tailIndex];
+			const scalarType		deltaZ = this->mNodeLocationZ[headIndex] -
+				this->mNodeLocationZ[tailIndex];
+
+			const scalarType		springLengthSquared = (deltaX * deltaX) +
+				(deltaY * deltaY) + (deltaZ * deltaZ);
+			const scalarType		maximumLength = this->mSpringRestingLength[springLoop] *
+				maximumLengthScale;
+
+			// The correction is distributed in proportion to the inverse node masses
+			// (anchor nodes are not moved).
+			const scalarType		inverseMassSum = this->mNodeInverseMass[headIndex] +
+				this->mNodeInverseMass[tailIndex];
+
+			if ((springLengthSquared > (maximumLength * maximumLength)) &&
+				(inverseMassSum > 0.0))
+			{
+				// Move the nodes towards each other along the spring, until the spring
+				// length matches the maximum length.
+				const scalarType	springLength = (scalarType)::sqrt(springLengthSquared);
+				const scalarType	correctionScale = (springLength - maximumLength) /
+					(springLength * inverseMassSum);
+
+				const scalarType	headScale = -correctionScale *
+					this->mNodeInverseMass[headIndex];
+				const scalarType	tailScale = correctionScale *
+					this->mNodeInverseMass[tailIndex];
+
+				this->mNodeLocationX[headIndex] += deltaX * headScale;
+				this->mNodeLocationY[headIndex] += deltaY * headScale;
+				this->mNodeLocationZ[headIndex] += deltaZ * headScale;
+
+				this->mNodeLocationX[tailIndex] += deltaX * tailScale;
+				this->mNodeLocationY[tailIndex] += deltaY * tailScale;
+				this->mNodeLocationZ[tailIndex] += deltaZ * tailScale;
+
+				// The node velocities include the correction (Verlet integration also
+				// implies the correction from the corrected locations).
+				this->mNodeVelocityX[headIndex] += deltaX * headScale * inverseTimeQuantum;
+				this->mNodeVelocityY[headIndex] += deltaY * headScale * inverseTimeQuantum;
+				this->mNodeVelocityZ[headIndex] += deltaZ * headScale * inverseTimeQuantum;
+
+				this->mNodeVelocityX[tailIndex] += deltaX * tailScale * inverseTimeQuantum;
+				this->mNodeVelocityY[tailIndex] += deltaY * tailScale * inverseTimeQuantum;
+				this->mNodeVelocityZ[tailIndex] += deltaZ * tailScale * inverseTimeQuantum;
+
+				bNodesCorrected = true;
+			}
+		}
+	}
+}
+
+
+template <class scalarType>
+bool CTypedClothSpringArraySolver<scalarType>::IntegrateNodesImplicit(const ScalarType timeQuantum)
+{
+	bool							bIntegratedSuccessfully = this->mbImplicitPatternBuilt ||
+		this->BuildImplicitSystemPattern();
+
+	if (bIntegratedSuccessfully) {
+		// Solve for the velocity change of each node...
+		this->AssembleImplicitSystem(timeQuantum);
+		this->mImplicitSolverIterationCount = this->SolveImplicitSystem();
+
+		// ...And apply the new velocity over the time quantum (anchor nodes have a
+		// velocity change of zero, and a velocity of zero).
+		for (IndexType nodeLoop = 0; nodeLoop < this->GetNodeCount(); nodeLoop++) {
+			if (this->mNodeInverseMass[nodeLoop] > 0.0) {
+				this->mNodeVelocityX[nodeLoop] += this->mImplicitVelocityChange[(nodeLoop * 3)];
+				this->mNodeVelocityY[nodeLoop] += this->mImplicitVelocityChange[(nodeLoop * 3) + 1];
+				this->mNodeVelocityZ[nodeLoop] += this->mImplicitVelocityChange[(nodeLoop * 3) + 2];
+
+				this->mNodeLocationX[nodeLoop] += this->mNodeVelocityX[nodeLoop] * timeQuantum;
+				this->mNodeLocationY[nodeLoop] += this->mNodeVelocityY[nodeLoop] * timeQuantum;
+				this->mNodeLocationZ[nodeLoop] += this->mNodeVelocityZ[nodeLoop] * timeQuantum;
+			}
+
+			// Clear the force after it has been applied.
+			this->mNodeForceX[nodeLoop] = 0.0;
+			this->mNodeForceY[nodeLoop] = 0.0;
+			this->mNodeForceZ[nodeLoop] = 0.0;
+		}
+	}
+
+	return(bIntegratedSuccessfully);
+}
+
+
+template <class scalarType>
+bool CTypedClothSpringArraySolver<scalarType>::BuildImplicitSystemPattern()
+{
+	bool							bPatternBuiltSuccessfully = false;
+
+	const QuantityType				nodeCount = this->GetNodeCount();
+	const QuantityType				springCount = this->GetSpringCount();
+
+	if (this->IsValid() && this->mImplicitSystemMatrix.BuildPattern(nodeCount,
+		(springCount > 0) ? &this->mSpringHeadIndex[0] : NULL,
+		(springCount > 0) ? &this->mSpringTailIndex[0] : NULL, springCount))
+	{
+		// Locate the off-diagonal blocks of each spring (assembly does not require
+		// any block searches).
+		this->mSpringHeadTailBlockIndex.resize(springCount);
+		this->mSpringTailHeadBlockIndex.resize(springCount);
+
+		for (IndexType springLoop = 0; springLoop < springCount; springLoop++) {
+			const IndexType			headIndex = this->mSpringHeadIndex[springLoop];
+			const IndexType			tailIndex = this->mSpringTailIndex[springLoop];
+
+			this->mSpringHeadTailBlockIndex[springLoop] =
+				this->mImplicitSystemMatrix.FindBlockIndex(headIndex, tailIndex);
+			this->mSpringTailHeadBlockIndex[springLoop] =
+				this->mImplicitSystemMatrix.FindBlockIndex(tailIndex, headIndex);
+		}
+
+		// Allocate the working vectors.
+		this->mImplicitRightHandSide.assign(nodeCount * 3, 0.0);
+		this->mImplicitVelocityChange.assign(nodeCount * 3, 0.0);
+		this->mImplicitResidual.assign(nodeCount * 3, 0.0);
+		this->mImplicitSearchDirection.assign(nodeCount * 3, 0.0);
+		this->mImplicitMatrixProduct.assign(nodeCount * 3, 0.0);
+		this->mImplicitPreconditionedResidual.assign(nodeCount * 3, 0.0);
+		this->mImplicitPreconditioner.assign(nodeCount * 3, 0.0);
+
+		this->mbImplicitPatternBuilt = true;
+
+		bPatternBuiltSuccessfully = true;
+	}
+
+	return(bPatternBuiltSuccessfully);
+}
+
+
+template <class scalarType>
+void CTypedClothSpringArraySolver<scalarType>::AssembleImplicitSystem(const ScalarType timeQuantum)
+{
+	const QuantityType				nodeCount = this->GetNodeCount();
+	const QuantityType				springCount = this->GetSpringCount();
+	const ScalarType				timeQuantumSquared = timeQuantum * timeQuantum;
+
+	this->mImplicitSystemMatrix.ClearBlocks();
+
+	// Diagonal blocks contain the node mass, and the right-hand side contains the
+	// impulse of the pending force (external and spring forces).
+	for (IndexType nodeLoop = 0; nodeLoop < nodeCount; nodeLoop++) {
+		ScalarType*					pDiagonalBlock = this->mImplicitSystemMatrix.GetBlock(
+			this->mImplicitSystemMatrix.GetDiagonalBlockIndex(nodeLoop));
+
+		pDiagonalBlock[0] = this->mNodeMass[nodeLoop];
+		pDiagonalBlock[4] = this->mNodeMass[nodeLoop];
+		pDiagonalBlock[8] = this->mNodeMass[nodeLoop];
+
+		this->mImplicitRightHandSide[(nodeLoop * 3)] = this->mNodeForceX[nodeLoop] * timeQuantum;
+		this->mImplicitRightHandSide[(nodeLoop * 3) + 1] = this->mNodeForceY[nodeLoop] * timeQuantum;
+		this->mImplicitRightHandSide[(nodeLoop * 3) + 2] = this->mNodeForceZ[nodeLoop] * timeQuantum;
+	}
+
+	for (IndexType springLoop = 0; springLoop < springCount; springLoop++) {
+		const IndexType				headIndex = this->mSpringHeadIndex[springLoop];
+		const IndexType				tailIndex = this->mSpringTailIndex[springLoop];
+
+		// Spring displacement vector (tail to head)...
+		const ScalarType			deltaX = this->mNodeLocationX[headIndex] -
+			this->mNodeLocationX[tailIndex];
+		const ScalarType			deltaY = this->mNodeLocationY[headIndex] -
+			this->mNodeLocationY[tailIndex];
+		const ScalarType			deltaZ = this->mNodeLocationZ[headIndex] -
+			this->mNodeLocationZ[tailIndex];
+
+		const ScalarType			springLength = ::sqrt((deltaX * deltaX) +
+			(deltaY * deltaY) + (deltaZ * deltaZ));
+
+		if (springLength > 0.0) {
+			// ...Spring stiffness (negated force Jacobian) - k x ((1 - c) x (u x uT) + c x I),
+			// where u is the spring direction, and c = 1 - (resting length / length). The
+			// transverse term is omitted for compressed springs (the system remains
+			// positive definite).
+			const ScalarType		directionX = deltaX / springLength;
+			const ScalarType		directionY = deltaY / springLength;
+			const ScalarType		directionZ = deltaZ / springLength;
+
+			const ScalarType		transverseScale = (springLength >
+				this->mSpringRestingLength[springLoop]) ? (1.0 -
+				(this->mSpringRestingLength[springLoop] / springLength)) : 0.0;
+			const ScalarType		stiffnessScale = this->mSpringConstant[springLoop] *
+				timeQuantumSquared;
+			const ScalarType		axialScale = stiffnessScale * (1.0 - transverseScale);
+
+			ScalarType				stiffnessBlock[9];
+
+			stiffnessBlock[0] = (axialScale * directionX * directionX) +
+				(stiffnessScale * transverseScale);
+			stiffnessBlock[1] = axialScale * directionX * directionY;
+			stiffnessBlock[2] = axialScale * directionX * directionZ;
+			stiffnessBlock[3] = stiffnessBlock[1];
+			stiffnessBlock[4] = (axialScale * directionY * directionY) +
+				(stiffnessScale * transverseScale);
+			stiffnessBlock[5] = axialScale * directionY * directionZ;
+			stiffnessBlock[6] = stiffnessBlock[2];
+			stiffnessBlock[7] = stiffnessBlock[5];
+			stiffnessBlock[8] = (axialScale * directionZ * directionZ) +
+				(stiffnessScale * transverseScale);
+
+			// Add the (time-scaled) stiffness to the diagonal blocks of both nodes, and
+			// subtract it from the blocks that link the nodes.
+			ScalarType*				pHeadBlock = this->mImplicitSystemMatrix.GetBlock(
+				this->mImplicitSystemMatrix.GetDiagonalBlockIndex(headIndex));
+			ScalarType*				pTailBlock = this->mImplicitSystemMatrix.GetBlock(
+				this->mImplicitSystemMatrix.GetDiagonalBlockIndex(tailIndex));
+			ScalarType*				pHeadTailBlock = this->mImplicitSystemMatrix.GetBlock(
+				this->mSpringHeadTailBlockIndex[springLoop]);
+			ScalarType*				pTailHeadBlock = this->mImplicitSystemMatrix.GetBlock(
+				this->mSpringTailHeadBlockIndex[springLoop]);
+
+			for (IndexType valueLoop = 0; valueLoop < CSparseBlockMatrix::mkBlockValueCount;
+				valueLoop++)
+			{
+				pHeadBlock[valueLoop] += stiffnessBlock[valueLoop];
+				pTailBlock[valueLoop] += stiffnessBlock[valueLoop];
+				pHeadTailBlock[valueLoop] -= stiffnessBlock[valueLoop];
+				pTailHeadBlock[valueLoop] -= stiffnessBlock[valueLoop];
+			}
+
+			// Right-hand side - h^2 x df/dx x v (the spring resists the relative velocity
+			// of the nodes).
+			const ScalarType		relativeVelocityX = this->mNodeVelocityX[headIndex] -
+				this->mNodeVelocityX[tailIndex];
+			const ScalarType		relativeVelocityY = this->mNodeVelocityY[headIndex] -
+				this->mNodeVelocityY[tailIndex];
+			const ScalarType		relativeVelocityZ = this->mNodeVelocityZ[headIndex] -
+				this->mNodeVelocityZ[tailIndex];
+
+			const ScalarType		velocityTermX = (stiffnessBlock[0] * relativeVelocityX) +
+				(stiffnessBlock[1] * relativeVelocityY) + (stiffnessBlock[2] * relativeVelocityZ);
+			const ScalarType		velocityTermY = (stiffnessBlock[3] * relativeVelocityX) +
+				(stiffnessBlock[4] * relativeVelocityY) + (stiffnessBlock[5] * relativeVelocityZ);
+			const ScalarType		velocityTermZ = (stiffnessBlock[6] * relativeVelocityX) +
+				(stiffnessBlock[7] * relativeVelocityY) + (stiffnessBlock[8] * relativeVelocityZ);
+
+			this->mImplicitRightHandSide[(headIndex * 3)] -= velocityTermX;
+			this->mImplicitRightHandSide[(headIndex * 3) + 1] -= velocityTermY;
+			this->mImplicitRightHandSide[(headIndex * 3) + 2] -= velocityTermZ;
+
+			this->mImplicitRightHandSide[(tailIndex * 3)] += velocityTermX;
+			this->mImplicitRightHandSide[(tailIndex * 3) + 1] += velocityTermY;
+			this->mImplicitRightHandSide[(tailIndex * 3) + 2] += velocityTermZ;
+		}
+	}
+
+	// Determine the preconditioner (inverse of the matrix diagonal) - anchor nodes are
+	// excluded from the solution.
+	for (IndexType nodeLoop = 0; nodeLoop < nodeCount; nodeLoop++) {
+		const ScalarType*			pDiagonalBlock = this->mImplicitSystemMatrix.GetBlock(
+			this->mImplicitSystemMatrix.GetDiagonalBlockIndex(nodeLoop));
+		const bool					bIsFreeNode = (this->mNodeInverseMass[nodeLoop] > 0.0);
+
+		for (IndexType componentLoop = 0; componentLoop < 3; componentLoop++) {
+			const ScalarType		diagonalValue = pDiagonalBlock[componentLoop * 4];
+
+			this->mImplicitPreconditioner[(nodeLoop * 3) + componentLoop] =
+				(bIsFreeNode && (diagonalValue > 0.0)) ? (1.0 / diagonalValue) : 0.0;
+
+			if (!bIsFreeNode) {
+				this->mImplicitRightHandSide[(nodeLoop * 3) + componentLoop] = 0.0;
+			}
+		}
+	}
+}
+
+
+// Explicit instantiation - solvers with single and double-precision node state.
+template class CTypedClothSpringArraySolver<float>;
+template class CTypedClothSpringArraySolver<double>;
+
+
+// Maximum number of conjugate gradient iterations performed during each implicit integration
+// step, and the convergence tolerance (relative to the initial residual).
+const QuantityType					CClothSpringArraySolver::mkImplicitSolverMaxIterations = 100;
+const ScalarType					CClothSpringArraySolver::mkImplicitSolverTolerance = 1.0e-4;
+
+// Fraction of each constraint correction applied during Jacobi iterations.
+const ScalarType					CClothSpringArraySolver::mkJacobiRelaxationFactor = 0.25;
+
+// Maximum number of spring color groups (limited by the number of bits in the node color
+// mask - cloth grids require fewer than half of the available colors).
+const QuantityType					CClothSpringArraySolver::mkMaxSpringColorCount = 32;
+
+// Minimum number of springs/nodes processed by each thread.
+const QuantityType					CClothSpringArraySolver::mkMinimumSpringsPerThread = 2048;
+const QuantityType					CClothSpringArraySolver::mkMinimumNodesPerThread = 1024;
+
+
+/////
+// CClothArrayNodeReference class
+/////
+CClothArrayNodeReference::CClothArrayNodeReference(const CClothSpringArraySolver&
+												   springArraySolver,
+												   const IndexType nodeIndex) :
+	CPhysicalNodeBase(CFloatPoint(0.0, 0.0, 0.0), springArraySolver.GetNodeMass(nodeIndex),
+		springArraySolver.IsAnchorNode(nodeIndex)),
+	mSpringArraySolver(springArraySolver), mNodeIndex(nodeIndex)
+{
+
+}
+
+CClothArrayNodeReference::~CClothArrayNodeReference()
+{
+
+}
+
+
+CFloatPoint CClothArrayNodeReference::GetNodeLocation() const
+{
+	// Retrieve the node location from the solver arrays.
+	return(this->mSpringArraySolver.GetNodeLocation(this->mNodeIndex));
+}
+
+
+ScalarType CClothArrayNodeReference::GetNodeMass() const
+{
+	// Retrieve the node mass from the solver arrays.
+	return(this->mSpringArraySolver.GetNodeMass(this->mNodeIndex));
+}
+
+
+CVector CClothArrayNodeReference::GetNodeVelocityVector() const
+{
+	// Retrieve the node velocity from the solver arrays.
+	return(this->mSpringArraySolver.GetNodeVelocityVector(this->mNodeIndex));
+}
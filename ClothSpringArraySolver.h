@@ -0,0 +1,578 @@
+// ClothSpringArraySolver.h - Contains declarations for the spring-centric cloth solver, which
+//                            stores node state in contiguous arrays and evaluates springs from
+//                            a flat spring list.
+
+#ifndef _CLOTHSPRINGARRAYSOLVER_H
+#define _CLOTHSPRINGARRAYSOLVER_H	1
+
+
+#include "PrimaryHeaders.h"
+#include "PrimitiveSupport.h"
+#include "PhysicalNode.h"
+#include "SparseBlockMatrix.h"
+#include "SpringForceKernels.h"
+#include "WorkerThreadPool.h"
+
+
+// Position constraint solver methods (extended position-based dynamics).
+typedef enum
+{
+	eConstraintSolverGaussSeidel = 0,	// Constraints are solved in sequence (each constraint uses
+										// the corrections of the preceding constraints).
+	eConstraintSolverJacobi				// Constraint corrections are determined independently, and
+										// applied together (evaluated concurrently).
+} EConstraintSolverMethod;
+
+
+// Precision of the node state stored by the spring array solver.
+typedef enum
+{
+	eSolverPrecisionDouble = 0,		// Node/spring arrays contain double-precision values.
+	eSolverPrecisionSingle			// Node/spring arrays contain single-precision values (half
+									// of the memory bandwidth, and twice the number of springs
+									// per SIMD kernel iteration).
+} ESolverPrecision;
+
+
+// Node state is stored as a structure of arrays (one array per coordinate), with
+// nodes referenced by index. Each spring is stored once as an index pair, and is
+// evaluated once per simulation step - the resulting force is applied to the head
+// node, and the equal/opposite force is applied to the tail node.
+//
+// Springs are partitioned into "color" groups, where no two springs within a group
+// share a node - groups are processed in sequence, permitting the springs within a
+// group to be applied concurrently without synchronization. Results do not depend
+// upon the number of threads used.
+//
+// This class contains the solver configuration, along with the implicit integration
+// system (always evaluated with ScalarType precision) - the node/spring arrays are
+// stored by CTypedClothSpringArraySolver, and the precision is selected when the
+// solver is created.
+class CClothSpringArraySolver : public CParallelTask
+{
+public:
+	virtual ~CClothSpringArraySolver();
+
+	// Creates a solver that stores node state with the specified precision (the solver
+	// must be deleted by the caller).
+	static CClothSpringArraySolver*	CreateSpringArraySolver(const ESolverPrecision
+		solverPrecision);
+
+	// Retrieves the precision of the node state stored by the solver.
+	virtual ESolverPrecision		GetSolverPrecision() const = 0;
+
+	// Copies all nodes, springs and configuration settings from another solver (the
+	// solvers may store node state with different precisions).
+	bool							CopySpringArraySolver(const CClothSpringArraySolver&
+		sourceSolver);
+
+	// Determines if the solver contains a valid node/spring definition.
+	bool							IsValid() const;
+
+	// Allocates storage for the specified number of nodes (all existing node
+	// and spring data is discarded).
+	virtual bool					AllocateNodes(const QuantityType nodeCount) = 0;
+
+	// Adds a spring between two indexed nodes.
+	virtual bool					AddSpring(const IndexType headNodeIndex,
+		const IndexType tailNodeIndex, const ScalarType springConstant,
+		const ScalarType restingLength) = 0;
+
+	// Retrieves the definition of an indexed spring (springs are reordered when they
+	// are first evaluated).
+	virtual bool					GetSpring(const IndexType springIndex,
+		IndexType& headNodeIndex, IndexType& tailNodeIndex, ScalarType& springConstant,
+		ScalarType& restingLength) const = 0;
+
+	// Returns the number of nodes stored within the solver.
+	virtual QuantityType			GetNodeCount() const = 0;
+
+	// Returns the number of springs stored within the solver.
+	virtual QuantityType			GetSpringCount() const = 0;
+
+	// Sets the complete physical state of an indexed node.
+	virtual bool					SetNodeState(const IndexType nodeIndex,
+		const CFloatPoint& nodeLocation, const CVector& velocityVector,
+		const ScalarType nodeMass, const bool bIsAnchorNode) = 0;
+
+	// Sets the anchor node status of an indexed node (anchor nodes are represented
+	// with an inverse mass of zero, and do not move - sleeping nodes are woken).
+	virtual bool					SetAnchorNodeStatus(const IndexType nodeIndex,
+		const bool bIsAnchorNode) = 0;
+
+	// Sets the sleeping status of an indexed node (anchor nodes cannot sleep). Sleeping
+	// nodes are stopped, and are excluded from external force evaluation and
+	// integration in the same manner as anchor nodes until they are woken.
+	virtual bool					SetSleepingNodeStatus(const IndexType nodeIndex,
+		const bool bIsSleepingNode) = 0;
+
+	// Retrieves the location of an indexed node.
+	virtual CFloatPoint				GetNodeLocation(const IndexType nodeIndex) const = 0;
+
+	// Retrieves the velocity of an indexed node.
+	virtual CVector					GetNodeVelocityVector(const IndexType nodeIndex) const = 0;
+
+	// Retrieves the mass of an indexed node.
+	virtual ScalarType				GetNodeMass(const IndexType nodeIndex) const = 0;
+
+	// Determines if an indexed node is an anchor node.
+	virtual bool					IsAnchorNode(const IndexType nodeIndex) const = 0;
+
+	// Determines if an indexed node is sleeping.
+	virtual bool					IsSleepingNode(const IndexType nodeIndex) const = 0;
+
+	// Returns the number of free nodes (nodes that are neither anchored nor sleeping).
+	virtual QuantityType			GetFreeNodeCount() const = 0;
+
+	// Retrieves the index of an entry within the free node list (free nodes are
+	// listed in ascending index order).
+	virtual IndexType				GetFreeNodeIndex(const IndexType freeNodeListIndex) const = 0;
+
+	// Sets the pending (external) force for an indexed node - spring forces are
+	// accumulated on top of this force.
+	virtual bool					SetNodeForceVector(const IndexType nodeIndex,
+		const CVector& forceVector) = 0;
+
+	// Evaluates external forces for the free nodes within the free node list range
+	// [firstFreeNodeIndex, endFreeNodeIndex), setting the pending forces of the nodes
+	// (forces are evaluated for batches of nodes).
+	virtual bool					EvaluateExternalForces(const CExternalNodeForceCollection&
+		externalNodeForceCollection, const IndexType firstFreeNodeIndex,
+		const IndexType endFreeNodeIndex, const ScalarType timeQuantum) = 0;
+
+	// Evaluates the surface forces of a collection, presenting the nodes as a grid with
+	// the specified dimensions (row-major order), and adds the forces to the pending
+	// forces of the free nodes.
+	virtual bool					AccumulateSurfaceForces(const
+		CExternalNodeForceCollection& externalNodeForceCollection,
+		const QuantityType nodesPerRow, const QuantityType nodesPerColumn) = 0;
+
+	// Evaluates every spring once, adding the spring forces to the pending
+	// forces of both linked nodes.
+	virtual bool					AccumulateSpringForces() = 0;
+
+	// Applies the pending forces to all nodes over a specified period of time,
+	// clearing the pending forces afterwards.
+	virtual bool					ApplyNodeForces(const ScalarType timeQuantum) = 0;
+
+	// Estimates the largest time quantum for which explicit integration of the springs
+	// remains stable - the largest eigenvalue of the (inverse mass-scaled) stiffness
+	// matrix is bounded using Gershgorin discs (sleeping nodes are treated as free
+	// nodes). Zero is returned if no free nodes are linked by springs.
+	virtual ScalarType				EstimateStableTimeQuantum() const = 0;
+
+	// Selects the method used to integrate node motion (the damping factor, 0.0 - 1.0,
+	// reduces the per-step displacement of Verlet integration).
+	bool							SetNodeIntegrator(const ENodeIntegrator nodeIntegrator,
+		const ScalarType dampingFactor);
+
+	// Retrieves the method used to integrate node motion.
+	ENodeIntegrator					GetNodeIntegrator() const;
+
+	// Selects the method used to solve position constraints, and the number of solver
+	// iterations performed during each step.
+	bool							SetConstraintSolver(const EConstraintSolverMethod
+		constraintSolverMethod, const QuantityType iterationCount);
+
+	// Advances the nodes over a specified period of time using extended position-based
+	// dynamics - springs are treated as distance constraints, with a compliance equal
+	// to the inverse of the spring constant. The pending forces (external forces only)
+	// are cleared afterwards.
+	virtual bool					SolvePositionConstraints(const ScalarType timeQuantum) = 0;
+
+	// Sets the maximum elongation of each spring, relative to its resting length (e.g.
+	// 0.1 permits springs to stretch by 10 percent). Springs are constrained after
+	// each integration step by repeatedly correcting the locations of the spring
+	// nodes (Provot) - an iteration count of zero disables the constraints.
+	bool							SetStrainLimit(const ScalarType maximumElongation,
+		const QuantityType iterationCount);
+
+	// Returns the number of conjugate gradient iterations performed during the most
+	// recent implicit integration step.
+	QuantityType					GetImplicitSolverIterationCount() const;
+
+	// Selects the kernel used to evaluate spring forces (the kernel must be supported
+	// by the processor).
+	bool							SetSpringForceKernel(const ESpringForceKernel
+		springForceKernel);
+
+	// Retrieves the kernel used to evaluate spring forces.
+	ESpringForceKernel				GetSpringForceKernel() const;
+
+	// Specifies whether SIMD spring force kernels determine spring lengths using the
+	// approximate reciprocal square root (refined with Newton-Raphson iterations), in
+	// place of an exact square root and division.
+	void							SetApproximateSpringLengths(const bool
+		bApproximateSpringLengths);
+
+	// Determines if SIMD spring force kernels use approximate spring lengths.
+	bool							UsesApproximateSpringLengths() const;
+
+	// Sets the thread pool used to evaluate springs and apply node forces (NULL
+	// disables parallel evaluation). Nodes are applied in blocks of the specified
+	// size (e.g. one row of cloth nodes).
+	bool							SetWorkerThreadPool(CWorkerThreadPool* pWorkerThreadPool,
+		const QuantityType nodesPerBlock);
+
+protected:
+	CClothSpringArraySolver();
+
+	// Parallel task designations.
+	typedef enum
+	{
+		eSolverTaskSpringForces = 0,	// Items are springs.
+		eSolverTaskSpringApplication,	// Items are springs (within one color group).
+		eSolverTaskNodeIntegration,		// Items are node blocks.
+		eSolverTaskConstraintCorrection,// Items are springs.
+		eSolverTaskConstraintApplication// Items are springs (within one color group).
+	} ESolverTask;
+
+
+	// Solves the implicit system for the node velocity changes (Jacobi-preconditioned
+	// conjugate gradient - anchor nodes are constrained to a velocity change of zero),
+	// returning the number of iterations performed.
+	QuantityType					SolveImplicitSystem();
+
+	// Executes a task over a range of items using the thread pool (item indices are
+	// offset by the specified amount).
+	bool							ExecuteParallelTask(const ESolverTask solverTask,
+		const IndexType itemOffset, const QuantityType itemCount,
+		const QuantityType minimumItemsPerBlock);
+
+	// Type definition - contiguous array of scalar values.
+	typedef std::vector<ScalarType>	ScalarArrayType;
+
+	// Type definition - contiguous array of node indices.
+	typedef std::vector<IndexType>	IndexArrayType;
+
+
+	// Method used to integrate node motion.
+	ENodeIntegrator					mNodeIntegrator;
+
+	// Fraction of the per-step displacement removed during Verlet integration.
+	ScalarType						mIntegratorDampingFactor;
+
+	// Time quantum of the most recent Verlet integration step (zero when the previous
+	// node locations must be determined from the node velocities).
+	ScalarType						mPreviousTimeQuantum;
+
+
+	// Method used to solve position constraints.
+	EConstraintSolverMethod			mConstraintSolverMethod;
+
+	// Number of position constraint iterations performed during each step.
+	QuantityType					mConstraintIterationCount;
+
+
+	// Maximum spring elongation (fraction of the resting length).
+	ScalarType						mMaximumSpringElongation;
+
+	// Maximum number of strain limiting iterations performed after each integration
+	// step (zero when strain limiting is disabled).
+	QuantityType					mStrainLimitIterationCount;
+
+
+	// Implicit integration state (the sparsity pattern and working vectors are retained
+	// between steps - vectors contain three interleaved components per node).
+
+	// System matrix.
+	CSparseBlockMatrix				mImplicitSystemMatrix;
+
+	// Indicates that the system matrix sparsity pattern matches the spring arrays.
+	bool							mbImplicitPatternBuilt;
+
+	// System matrix blocks that link the head and tail node of each spring (head row,
+	// tail column), and the tail and head node of each spring (tail row, head column).
+	IndexArrayType					mSpringHeadTailBlockIndex;
+	IndexArrayType					mSpringTailHeadBlockIndex;
+
+	// System right-hand side, solution (node velocity changes), residual, search
+	// direction, matrix/search direction product and preconditioned residual.
+	ScalarArrayType					mImplicitRightHandSide;
+	ScalarArrayType					mImplicitVelocityChange;
+	ScalarArrayType					mImplicitResidual;
+	ScalarArrayType					mImplicitSearchDirection;
+	ScalarArrayType					mImplicitMatrixProduct;
+	ScalarArrayType					mImplicitPreconditionedResidual;
+
+	// Inverse of the system matrix diagonal (zero for anchor nodes).
+	ScalarArrayType					mImplicitPreconditioner;
+
+	// Number of conjugate gradient iterations performed during the most recent step.
+	QuantityType					mImplicitSolverIterationCount;
+
+
+	// Kernel used to evaluate spring forces.
+	ESpringForceKernel				mSpringForceKernel;
+
+	// Indicates that SIMD spring force kernels use approximate spring lengths.
+	bool							mbApproximateSpringLengths;
+
+	// Indicates that the spring arrays have been partitioned into color groups.
+	bool							mbSpringsColored;
+
+	// Index of the first spring within each color group (the final entry contains the
+	// spring count). Springs that could not be assigned a color are placed within the
+	// last group, which is always processed serially.
+	IndexArrayType					mSpringColorGroupStart;
+
+
+	// Thread pool used for parallel evaluation (not owned by the solver).
+	CWorkerThreadPool*				mpWorkerThreadPool;
+
+	// Number of nodes in each node block (parallel node integration).
+	QuantityType					mNodesPerBlock;
+
+	// Parallel task that is currently being executed, along with its parameters.
+	ESolverTask						mCurrentTask;
+	IndexType						mCurrentTaskItemOffset;
+	ScalarType						mCurrentTimeQuantum;
+
+
+	// Maximum number of conjugate gradient iterations performed during each implicit
+	// integration step.
+	static const QuantityType		mkImplicitSolverMaxIterations;
+
+	// Conjugate gradient convergence tolerance (relative to the initial residual).
+	static const ScalarType			mkImplicitSolverTolerance;
+
+	// Fraction of each constraint correction applied during Jacobi iterations (corrections
+	// of constraints that share nodes are summed).
+	static const ScalarType			mkJacobiRelaxationFactor;
+
+	// Maximum number of spring color groups.
+	static const QuantityType		mkMaxSpringColorCount;
+
+	// Minimum number of springs/nodes processed by each thread (smaller ranges are
+	// not partitioned).
+	static const QuantityType		mkMinimumSpringsPerThread;
+	static const QuantityType		mkMinimumNodesPerThread;
+};
+
+
+// Spring array solver that stores node state and spring definitions using the specified
+// scalar type (instantiated for float and double within ClothSpringArraySolver.cpp -
+// all values exchanged through the solver interface are ScalarType values).
+template <class scalarType> class CTypedClothSpringArraySolver :
+	public CClothSpringArraySolver
+{
+public:
+	CTypedClothSpringArraySolver();
+	~CTypedClothSpringArraySolver();
+
+	// CClothSpringArraySolver interface (see CClothSpringArraySolver).
+	ESolverPrecision				GetSolverPrecision() const;
+	bool							AllocateNodes(const QuantityType nodeCount);
+	bool							AddSpring(const IndexType headNodeIndex,
+		const IndexType tailNodeIndex, const ScalarType springConstant,
+		const ScalarType restingLength);
+	bool							GetSpring(const IndexType springIndex,
+		IndexType& headNodeIndex, IndexType& tailNodeIndex, ScalarType& springConstant,
+		ScalarType& restingLength) const;
+	QuantityType					GetNodeCount() const;
+	QuantityType					GetSpringCount() const;
+	bool							SetNodeState(const IndexType nodeIndex,
+		const CFloatPoint& nodeLocation, const CVector& velocityVector,
+		const ScalarType nodeMass, const bool bIsAnchorNode);
+	bool							SetAnchorNodeStatus(const IndexType nodeIndex,
+		const bool bIsAnchorNode);
+	bool							SetSleepingNodeStatus(const IndexType nodeIndex,
+		const bool bIsSleepingNode);
+	CFloatPoint						GetNodeLocation(const IndexType nodeIndex) const;
+	CVector							GetNodeVelocityVector(const IndexType nodeIndex) const;
+	ScalarType						GetNodeMass(const IndexType nodeIndex) const;
+	bool							IsAnchorNode(const IndexType nodeIndex) const;
+	bool							IsSleepingNode(const IndexType nodeIndex) const;
+	QuantityType					GetFreeNodeCount() const;
+	IndexType						GetFreeNodeIndex(const IndexType freeNodeListIndex) const;
+	bool							SetNodeForceVector(const IndexType nodeIndex,
+		const CVector& forceVector);
+	bool							EvaluateExternalForces(const CExternalNodeForceCollection&
+		externalNodeForceCollection, const IndexType firstFreeNodeIndex,
+		const IndexType endFreeNodeIndex, const ScalarType timeQuantum);
+	bool							AccumulateSurfaceForces(const
+		CExternalNodeForceCollection& externalNodeForceCollection,
+		const QuantityType nodesPerRow, const QuantityType nodesPerColumn);
+	bool							AccumulateSpringForces();
+	bool							ApplyNodeForces(const ScalarType timeQuantum);
+	ScalarType						EstimateStableTimeQuantum() const;
+	bool							SolvePositionConstraints(const ScalarType timeQuantum);
+
+	// Performs the current parallel task over a range of items (invoked by the
+	// thread pool).
+	void							ExecuteRange(const IndexType firstIndex,
+		const IndexType endIndex);
+
+protected:
+
+	// Number of nodes within each batch of external force evaluations (node state is
+	// staged on the stack, permitting ranges to be evaluated concurrently).
+	enum { kExternalForceBatchSize = 64 };
+
+	// Creates a kernel block that references the node arrays, and the spring arrays
+	// within the range [firstSpringIndex, endSpringIndex).
+	CSpringForceKernelBlock<scalarType>
+									GetSpringForceKernelBlock(const IndexType
+		firstSpringIndex, const IndexType endSpringIndex);
+
+	// Partitions the springs into groups that do not share nodes (greedy graph
+	// coloring), and reorders the spring arrays so that each group is contiguous.
+	bool							ColorSprings();
+
+	// Adds the evaluated spring forces within the range [firstSpringIndex,
+	// endSpringIndex) to the pending forces of the linked nodes.
+	void							ApplySpringForces(const IndexType firstSpringIndex,
+		const IndexType endSpringIndex);
+
+	// Applies the pending forces to the free nodes within the free node list range
+	// [firstFreeNodeIndex, endFreeNodeIndex).
+	void							IntegrateNodes(const IndexType firstFreeNodeIndex,
+		const IndexType endFreeNodeIndex, const scalarType timeQuantum);
+
+	// Applies the pending forces to the free nodes within the free node list range
+	// [firstFreeNodeIndex, endFreeNodeIndex), using position Verlet integration.
+	void							IntegrateNodesVerlet(const IndexType firstFreeNodeIndex,
+		const IndexType endFreeNodeIndex, const scalarType timeQuantum);
+
+	// Clears the pending force of every node.
+	void							ClearNodeForces();
+
+	// Determines the previous location of each node from the node velocity (Verlet
+	// integration).
+	void							ResetPreviousNodeLocations(const scalarType timeQuantum);
+
+	// Applies the pending forces to all nodes using backward Euler integration (the
+	// spring forces are linearized about the current node locations).
+	bool							IntegrateNodesImplicit(const ScalarType timeQuantum);
+
+	// Moves the nodes using the pending forces and current velocities, retaining the
+	// current node locations (position-based dynamics).
+	void							PredictNodeLocations(const scalarType timeQuantum);
+
+	// Solves the distance constraints of the springs within the range
+	// [firstSpringIndex, endSpringIndex) in sequence, moving the linked nodes.
+	void							SolveDistanceConstraints(const IndexType firstSpringIndex,
+		const IndexType endSpringIndex, const scalarType complianceScale);
+
+	// Determines the position corrections of the springs within the range
+	// [firstSpringIndex, endSpringIndex), without moving the linked nodes.
+	void							EvaluateConstraintCorrections(const IndexType
+		firstSpringIndex, const IndexType endSpringIndex, const scalarType complianceScale);
+
+	// Applies the position corrections of the springs within the range
+	// [firstSpringIndex, endSpringIndex) to the linked nodes.
+	void							ApplyConstraintCorrections(const IndexType
+		firstSpringIndex, const IndexType endSpringIndex);
+
+	// Constrains the length of each spring to the maximum elongation, adjusting the
+	// node velocities to match the corrected node locations.
+	void							ApplyStrainLimits(const scalarType timeQuantum);
+
+	// Constructs the sparsity pattern of the implicit system matrix (one block for
+	// each node, and two blocks for each spring).
+	bool							BuildImplicitSystemPattern();
+
+	// Assembles the implicit system - (M - h^2 x df/dx) x dv = h x (f + h x df/dx x v).
+	void							AssembleImplicitSystem(const ScalarType timeQuantum);
+
+	// Type definition - contiguous array of node/spring values (one element per node or
+	// spring).
+	typedef std::vector<scalarType>	NodeArrayType;
+
+
+	// Node state arrays.
+
+	// Node locations.
+	NodeArrayType					mNodeLocationX;
+	NodeArrayType					mNodeLocationY;
+	NodeArrayType					mNodeLocationZ;
+
+	// Node velocities.
+	NodeArrayType					mNodeVelocityX;
+	NodeArrayType					mNodeVelocityY;
+	NodeArrayType					mNodeVelocityZ;
+
+	// Pending node forces.
+	NodeArrayType					mNodeForceX;
+	NodeArrayType					mNodeForceY;
+	NodeArrayType					mNodeForceZ;
+
+	// Node locations prior to the most recent Verlet integration step.
+	NodeArrayType					mNodePreviousLocationX;
+	NodeArrayType					mNodePreviousLocationY;
+	NodeArrayType					mNodePreviousLocationZ;
+
+	// Node masses (retained for anchor node status changes, and external force
+	// evaluation).
+	NodeArrayType					mNodeMass;
+
+	// Reciprocal node masses (zero for anchor nodes and sleeping nodes).
+	NodeArrayType					mNodeInverseMass;
+
+	// Sleeping designation of each node.
+	std::vector<bool>				mbIsSleepingNode;
+
+	// Indices of the free (non-anchor, non-sleeping) nodes, in ascending order - updated
+	// as anchor and sleeping node designations change, so that integration does not
+	// visit nodes that cannot move.
+	IndexArrayType					mFreeNodeIndex;
+
+	// Node state staged for surface force evaluation.
+	CExternalForceGridBuffer		mSurfaceForceGrid;
+
+
+	// Spring arrays.
+
+	// Index of the node attached to the "head" of each spring.
+	IndexArrayType					mSpringHeadIndex;
+
+	// Index of the node attached to the "tail" of each spring.
+	IndexArrayType					mSpringTailIndex;
+
+	// Spring constants ("k").
+	NodeArrayType					mSpringConstant;
+
+	// Length of each spring when no net force is being applied.
+	NodeArrayType					mSpringRestingLength;
+
+	// Force applied to the head node of each spring during the most recent
+	// evaluation (the tail node receives the equal and opposite force). Position-based
+	// Jacobi iterations store the position correction of each spring (scaled by the
+	// inverse node mass when applied).
+	NodeArrayType					mSpringForceX;
+	NodeArrayType					mSpringForceY;
+	NodeArrayType					mSpringForceZ;
+
+	// Accumulated Lagrange multiplier of each spring constraint (current step).
+	NodeArrayType					mSpringLagrangeMultiplier;
+};
+
+
+// Presents an indexed node within a spring array solver as a physical node, permitting
+// external force generators to evaluate forces for array-resident nodes.
+class CClothArrayNodeReference : public CPhysicalNodeBase
+{
+public:
+	CClothArrayNodeReference(const CClothSpringArraySolver& springArraySolver,
+		const IndexType nodeIndex);
+	~CClothArrayNodeReference();
+
+	// Retrieves the current node location.
+	CFloatPoint						GetNodeLocation() const;
+
+	// Retrieves the mass of the node.
+	ScalarType						GetNodeMass() const;
+
+	// Retrieves the current node velocity vector.
+	CVector							GetNodeVelocityVector() const;
+
+protected:
+	// Solver that contains the node state.
+	const CClothSpringArraySolver&	mSpringArraySolver;
+
+	// Index of the node within the solver arrays.
+	const IndexType					mNodeIndex;
+};
+
+
+#endif	// #ifndef _CLOTHSPRINGARRAYSOLVER_H
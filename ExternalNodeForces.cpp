@@ -2,6 +2,7 @@
 
 
 #include "ExternalNodeForces.h"
+#include "WindFieldProducer.h"
 
 
 /////
@@ -37,6 +38,27 @@ bool CGravityNodeForce::GenerateExternalForceVector(const CPhysicalNodeBase& tar
 }
 
 
+bool CGravityNodeForce::AccumulateExternalForceVectors(const CExternalForceNodeBatch&
+													   nodeBatch) const
+{
+	const ScalarType				gravityX = this->mGravityVector.GetXComponent();
+	const ScalarType				gravityY = this->mGravityVector.GetYComponent();
+	const ScalarType				gravityZ = this->mGravityVector.GetZComponent();
+
+	for (IndexType nodeLoop = 0; nodeLoop < nodeBatch.mNodeCount; nodeLoop++) {
+		// Gravitational force (N) = Mass (kg) x Gravitational acceleration constant (m / s^2)
+		const ScalarType			forceMagnitude = nodeBatch.mpNodeMass[nodeLoop] *
+			this->mGravitationalConstant;
+
+		nodeBatch.mpNodeForceX[nodeLoop] += gravityX * forceMagnitude;
+		nodeBatch.mpNodeForceY[nodeLoop] += gravityY * forceMagnitude;
+		nodeBatch.mpNodeForceZ[nodeLoop] += gravityZ * forceMagnitude;
+	}
+
+	return(true);
+}
+
+
 bool CGravityNodeForce::IsValid() const
 {
 	// The class is always "valid" - any gravitational constant is accepted (including
@@ -46,6 +68,7 @@ bool CGravityNodeForce::IsValid() const
 
 
 CWindNodeForce::CWindNodeForce(const CVector directionVector, const ScalarType magnitude) :
+	mAlterationConstant(0), mpNoiseField(NULL), mpFieldProducer(NULL),
 	mDirectionVector(directionVector),  mMaxMagnitude(magnitude)
 {
 
@@ -62,20 +85,44 @@ bool CWindNodeForce::GenerateExternalForceVector(const CPhysicalNodeBase& target
 {
 	bool							bForceGeneratedSuccessfully = false;
 
-	if (this->IsValid())
+	if (this->IsValid() && this->mpFieldProducer)
+	{
+		// Interpolate the force from the most recent producer frame.
+		CFloatPoint					nodeLocation = targetNode.GetNodeLocation();
+
+		const ScalarType			locationX = nodeLocation.GetXCoord();
+		const ScalarType			locationY = nodeLocation.GetYCoord();
+		const ScalarType			locationZ = nodeLocation.GetZCoord();
+
+		ScalarType					forceX = 0.0;
+		ScalarType					forceY = 0.0;
+		ScalarType					forceZ = 0.0;
+
+		this->mpFieldProducer->AccumulateWindForces(1, &locationX, &locationY, &locationZ,
+			&forceX, &forceY, &forceZ);
+
+		forceVector = CVector(forceX, forceY, forceZ);
+
+		bForceGeneratedSuccessfully = true;
+	}
+	else if (this->IsValid())
 	{
 		forceVector = this->mDirectionVector;
 
 
 		CFloatPoint					nodeLocation = targetNode.GetNodeLocation();
 
-		const double				noise = this->NoiseFunction(nodeLocation.GetXCoord(),
-			nodeLocation.GetYCoord(), nodeLocation.GetZCoord());
+		ScalarType					noise = 0.0;
+		ScalarType					gustFactor = 0.0;
+
+		this->EvaluateWindNoise(nodeLocation.GetXCoord(), nodeLocation.GetYCoord(),
+			nodeLocation.GetZCoord(), noise, gustFactor);
+
 		CVector						perturbation(noise, noise, noise);
 		forceVector = forceVector + perturbation;
 		forceVector.Normalize();
 
-		forceVector = forceVector * ((::cos(noise * this->mAlterationConstant) + 1.0) / 2.0); 
+		forceVector = forceVector * gustFactor;
 		forceVector = forceVector * this->mMaxMagnitude;
 
 		bForceGeneratedSuccessfully = true;
@@ -85,6 +132,90 @@ bool CWindNodeForce::GenerateExternalForceVector(const CPhysicalNodeBase& target
 	return(bForceGeneratedSuccessfully);
 }
 
+
+bool CWindNodeForce::AccumulateExternalForceVectors(const CExternalForceNodeBatch&
+													nodeBatch) const
+{
+	bool							bForceGeneratedSuccessfully = false;
+
+	if (this->IsValid() && this->mpFieldProducer)
+	{
+		// Interpolate the forces from the most recent producer frame.
+		this->mpFieldProducer->AccumulateWindForces(nodeBatch.mNodeCount,
+			nodeBatch.mpNodeLocationX, nodeBatch.mpNodeLocationY, nodeBatch.mpNodeLocationZ,
+			nodeBatch.mpNodeForceX, nodeBatch.mpNodeForceY, nodeBatch.mpNodeForceZ);
+
+		bForceGeneratedSuccessfully = true;
+	}
+	else if (this->IsValid())
+	{
+		const ScalarType			directionX = this->mDirectionVector.GetXComponent();
+		const ScalarType			directionY = this->mDirectionVector.GetYComponent();
+		const ScalarType			directionZ = this->mDirectionVector.GetZComponent();
+
+		const bool					bSampleNoiseField = this->mpNoiseField &&
+			this->mpNoiseField->IsValid();
+
+		ScalarType					noiseValue[kNoiseBlockSize];
+		ScalarType					gustFactor[kNoiseBlockSize];
+
+		for (IndexType blockStartIndex = 0; blockStartIndex < nodeBatch.mNodeCount;
+			blockStartIndex += kNoiseBlockSize)
+		{
+			const QuantityType		blockNodeCount =
+				((nodeBatch.mNodeCount - blockStartIndex) < kNoiseBlockSize) ?
+				(nodeBatch.mNodeCount - blockStartIndex) : (QuantityType)kNoiseBlockSize;
+
+			const ScalarType*		pLocationX = nodeBatch.mpNodeLocationX + blockStartIndex;
+			const ScalarType*		pLocationY = nodeBatch.mpNodeLocationY + blockStartIndex;
+			const ScalarType*		pLocationZ = nodeBatch.mpNodeLocationZ + blockStartIndex;
+
+			// Determine the noise applied to the wind at each node within the block...
+			if (bSampleNoiseField) {
+				this->mpNoiseField->SampleField(blockNodeCount, pLocationX, pLocationY,
+					pLocationZ, this->mAlterationConstant, noiseValue, gustFactor);
+			}
+			else {
+				for (IndexType noiseLoop = 0; noiseLoop < blockNodeCount; noiseLoop++) {
+					this->EvaluateWindNoise(pLocationX[noiseLoop], pLocationY[noiseLoop],
+						pLocationZ[noiseLoop], noiseValue[noiseLoop], gustFactor[noiseLoop]);
+				}
+			}
+
+			// ...And the resulting wind forces.
+			for (IndexType nodeLoop = 0; nodeLoop < blockNodeCount; nodeLoop++) {
+				const IndexType		nodeIndex = blockStartIndex + nodeLoop;
+
+				// Perturb the wind direction, and normalize the result.
+				ScalarType			forceX = directionX + noiseValue[nodeLoop];
+				ScalarType			forceY = directionY + noiseValue[nodeLoop];
+				ScalarType			forceZ = directionZ + noiseValue[nodeLoop];
+
+				const ScalarType	forceMagnitude = ::sqrt((forceX * forceX) +
+					(forceY * forceY) + (forceZ * forceZ));
+
+				if (forceMagnitude != 0.0) {
+					forceX /= forceMagnitude;
+					forceY /= forceMagnitude;
+					forceZ /= forceMagnitude;
+				}
+
+				nodeBatch.mpNodeForceX[nodeIndex] += (forceX * gustFactor[nodeLoop]) *
+					this->mMaxMagnitude;
+				nodeBatch.mpNodeForceY[nodeIndex] += (forceY * gustFactor[nodeLoop]) *
+					this->mMaxMagnitude;
+				nodeBatch.mpNodeForceZ[nodeIndex] += (forceZ * gustFactor[nodeLoop]) *
+					this->mMaxMagnitude;
+			}
+		}
+
+		bForceGeneratedSuccessfully = true;
+	}
+
+	return(bForceGeneratedSuccessfully);
+}
+
+
 bool CWindNodeForce::IsValid() const
 {
 	// Magnitude must be greater than or equal to zero (otherwise, final wind direction
@@ -96,11 +227,48 @@ bool CWindNodeForce::IsValid() const
 void CWindNodeForce::SetAlterationConstant(const QuantityType constant)
 {
 	this->mAlterationConstant = constant;
+
+	if (this->mpFieldProducer) {
+		// Adopt the most recently produced frame, and request the next frame (which is
+		// computed while the simulation proceeds).
+		this->mpFieldProducer->AdvanceFrame(constant);
+	}
+}
+
+
+void CWindNodeForce::SetNoiseField(const CWindNoiseField* pNoiseField)
+{
+	this->mpNoiseField = pNoiseField;
+}
+
+
+void CWindNodeForce::SetFieldProducer(CWindFieldProducer* pFieldProducer)
+{
+	this->mpFieldProducer = pFieldProducer;
+}
+
+
+void CWindNodeForce::EvaluateWindNoise(const ScalarType locationX,
+									   const ScalarType locationY,
+									   const ScalarType locationZ,
+									   ScalarType& noiseValue,
+									   ScalarType& gustFactor) const
+{
+	if (this->mpNoiseField && this->mpNoiseField->IsValid()) {
+		// Sample the precomputed field.
+		this->mpNoiseField->SampleField(locationX, locationY, locationZ,
+			this->mAlterationConstant, noiseValue, gustFactor);
+	}
+	else {
+		noiseValue = CWindNodeForce::NoiseFunction(locationX, locationY, locationZ);
+		gustFactor = ((::cos(noiseValue * this->mAlterationConstant) + 1.0) / 2.0);
+	}
 }
 
+
 double CWindNodeForce::NoiseFunction(const double noiseInputX,
 									 const double noiseInputY,
-									 const double noiseInputZ) const
+									 const double noiseInputZ)
 {
 	const							kDecimalMultiplier = 1000.0;
 	double							noiseResult = 0.0;
@@ -152,9 +320,259 @@ bool CViscousNodeForce::GenerateExternalForceVector(const CPhysicalNodeBase& tar
 }
 
 
+bool CViscousNodeForce::AccumulateExternalForceVectors(const CExternalForceNodeBatch&
+													   nodeBatch) const
+{
+	bool							bForceGeneratedSuccessfully = false;
+
+	if (this->IsValid()) {
+		const ScalarType			dampingFactor = -this->mViscousCoefficient;
+
+		// Visous Damping Force (N) =  Velocity (m / s) * Damping Coefficient (kg / s)
+		for (IndexType nodeLoop = 0; nodeLoop < nodeBatch.mNodeCount; nodeLoop++) {
+			nodeBatch.mpNodeForceX[nodeLoop] += nodeBatch.mpNodeVelocityX[nodeLoop] *
+				dampingFactor;
+			nodeBatch.mpNodeForceY[nodeLoop] += nodeBatch.mpNodeVelocityY[nodeLoop] *
+				dampingFactor;
+			nodeBatch.mpNodeForceZ[nodeLoop] += nodeBatch.mpNodeVelocityZ[nodeLoop] *
+				dampingFactor;
+		}
+
+		bForceGeneratedSuccessfully = true;
+	}
+
+	return(bForceGeneratedSuccessfully);
+}
+
+
 bool CViscousNodeForce::IsValid() const
 {
 	// The viscous coefficient must be greater (or equivalent to) zero; otherwise,
 	// acceleration occurs on the node instead of damping.
 	return(this->mViscousCoefficient >= 0.0);
 }
+
+
+/////
+// CAerodynamicSurfaceForce class
+/////
+CAerodynamicSurfaceForce::CAerodynamicSurfaceForce(const CVector windVelocity,
+												   const ScalarType airDensity,
+												   const ScalarType dragCoefficient,
+												   const ScalarType liftCoefficient) :
+	mWindVelocity(windVelocity), mAirDensity(airDensity), mDragCoefficient(dragCoefficient),
+	mLiftCoefficient(liftCoefficient)
+{
+
+}
+
+CAerodynamicSurfaceForce::~CAerodynamicSurfaceForce()
+{
+
+}
+
+
+bool CAerodynamicSurfaceForce::AccumulateSurfaceForceVectors(const CExternalForceNodeGrid&
+															 nodeGrid) const
+{
+	bool							bForceGeneratedSuccessfully = false;
+
+	if (this->IsValid() && (nodeGrid.mNodesPerRow > 1) && (nodeGrid.mNodesPerColumn > 1)) {
+		const QuantityType			rowStride = nodeGrid.mNodesPerRow;
+		const QuantityType			cellsPerRow = nodeGrid.mNodesPerRow - 1;
+
+		// Vertex forces of the lower-right triangle (upper-left, upper-right and
+		// lower-right nodes) and upper-left triangle (upper-left, lower-right and
+		// lower-left nodes) of each cell within a block.
+		ScalarType					lowerForceX[kCellBlockSize];
+		ScalarType					lowerForceY[kCellBlockSize];
+		ScalarType					lowerForceZ[kCellBlockSize];
+		ScalarType					upperForceX[kCellBlockSize];
+		ScalarType					upperForceY[kCellBlockSize];
+		ScalarType					upperForceZ[kCellBlockSize];
+
+		for (IndexType yLoop = 0; yLoop < (nodeGrid.mNodesPerColumn - 1); yLoop++) {
+			for (IndexType blockStartIndex = 0; blockStartIndex < cellsPerRow;
+				blockStartIndex += kCellBlockSize)
+			{
+				const QuantityType	blockCellCount =
+					((cellsPerRow - blockStartIndex) < kCellBlockSize) ?
+					(cellsPerRow - blockStartIndex) : (QuantityType)kCellBlockSize;
+
+				const IndexType		upperLeftIndex = (yLoop * rowStride) + blockStartIndex;
+				const IndexType		upperRightIndex = upperLeftIndex + 1;
+				const IndexType		lowerLeftIndex = upperLeftIndex + rowStride;
+				const IndexType		lowerRightIndex = lowerLeftIndex + 1;
+
+				// Evaluate the triangles of the block...
+				this->EvaluateTriangleForces(nodeGrid, blockCellCount, upperLeftIndex,
+					upperRightIndex, lowerRightIndex, lowerForceX, lowerForceY, lowerForceZ);
+				this->EvaluateTriangleForces(nodeGrid, blockCellCount, upperLeftIndex,
+					lowerRightIndex, lowerLeftIndex, upperForceX, upperForceY, upperForceZ);
+
+				// ...And distribute the forces to the cell corners in separate passes
+				// (successive cells share nodes).
+				for (IndexType cellLoop = 0; cellLoop < blockCellCount; cellLoop++) {
+					nodeGrid.mpNodeForceX[upperLeftIndex + cellLoop] += lowerForceX[cellLoop] +
+						upperForceX[cellLoop];
+					nodeGrid.mpNodeForceY[upperLeftIndex + cellLoop] += lowerForceY[cellLoop] +
+						upperForceY[cellLoop];
+					nodeGrid.mpNodeForceZ[upperLeftIndex + cellLoop] += lowerForceZ[cellLoop] +
+						upperForceZ[cellLoop];
+				}
+
+				for (IndexType cellLoop = 0; cellLoop < blockCellCount; cellLoop++) {
+					nodeGrid.mpNodeForceX[upperRightIndex + cellLoop] += lowerForceX[cellLoop];
+					nodeGrid.mpNodeForceY[upperRightIndex + cellLoop] += lowerForceY[cellLoop];
+					nodeGrid.mpNodeForceZ[upperRightIndex + cellLoop] += lowerForceZ[cellLoop];
+				}
+
+				for (IndexType cellLoop = 0; cellLoop < blockCellCount; cellLoop++) {
+					nodeGrid.mpNodeForceX[lowerRightIndex + cellLoop] += lowerForceX[cellLoop] +
+						upperForceX[cellLoop];
+					nodeGrid.mpNodeForceY[lowerRightIndex + cellLoop] += lowerForceY[cellLoop] +
+						upperForceY[cellLoop];
+					nodeGrid.mpNodeForceZ[lowerRightIndex + cellLoop] += lowerForceZ[cellLoop] +
+						upperForceZ[cellLoop];
+				}
+
+				for (IndexType cellLoop = 0; cellLoop < blockCellCount; cellLoop++) {
+					nodeGrid.mpNodeForceX[lowerLeftIndex + cellLoop] += upperForceX[cellLoop];
+					nodeGrid.mpNodeForceY[lowerLeftIndex + cellLoop] += upperForceY[cellLoop];
+					nodeGrid.mpNodeForceZ[lowerLeftIndex + cellLoop] += upperForceZ[cellLoop];
+				}
+			}
+		}
+
+		bForceGeneratedSuccessfully = true;
+	}
+
+	return(bForceGeneratedSuccessfully);
+}
+
+
+bool CAerodynamicSurfaceForce::IsValid() const
+{
+	// Negative densities and drag coefficients would draw the cloth into the wind (lift
+	// may act in either direction).
+	return((this->mAirDensity >= 0.0) && (this->mDragCoefficient >= 0.0));
+}
+
+
+void CAerodynamicSurfaceForce::SetWindVelocity(const CVector& windVelocity)
+{
+	this->mWindVelocity = windVelocity;
+}
+
+
+void CAerodynamicSurfaceForce::EvaluateTriangleForces(const CExternalForceNodeGrid& nodeGrid,
+													  const QuantityType triangleCount,
+													  const IndexType firstVertexIndex,
+													  const IndexType secondVertexIndex,
+													  const IndexType thirdVertexIndex,
+													  ScalarType* pVertexForceX,
+													  ScalarType* pVertexForceY,
+													  ScalarType* pVertexForceZ) const
+{
+	const ScalarType				kOneThird = 1.0 / 3.0;
+
+	const ScalarType				windX = this->mWindVelocity.GetXComponent();
+	const ScalarType				windY = this->mWindVelocity.GetYComponent();
+	const ScalarType				windZ = this->mWindVelocity.GetZComponent();
+
+	// Dynamic pressure scale (0.5 x density) for each force, including the share of the
+	// force applied to each vertex, and the halving of the cross product magnitude to
+	// obtain the triangle area.
+	const ScalarType				dragScale = 0.5 * this->mAirDensity *
+		this->mDragCoefficient * 0.5 * kOneThird;
+	const ScalarType				liftScale = 0.5 * this->mAirDensity *
+		this->mLiftCoefficient * 0.5 * kOneThird;
+
+	const ScalarType*				pFirstLocationX = nodeGrid.mpNodeLocationX + firstVertexIndex;
+	const ScalarType*				pFirstLocationY = nodeGrid.mpNodeLocationY + firstVertexIndex;
+	const ScalarType*				pFirstLocationZ = nodeGrid.mpNodeLocationZ + firstVertexIndex;
+	const ScalarType*				pSecondLocationX = nodeGrid.mpNodeLocationX + secondVertexIndex;
+	const ScalarType*				pSecondLocationY = nodeGrid.mpNodeLocationY + secondVertexIndex;
+	const ScalarType*				pSecondLocationZ = nodeGrid.mpNodeLocationZ + secondVertexIndex;
+	const ScalarType*				pThirdLocationX = nodeGrid.mpNodeLocationX + thirdVertexIndex;
+	const ScalarType*				pThirdLocationY = nodeGrid.mpNodeLocationY + thirdVertexIndex;
+	const ScalarType*				pThirdLocationZ = nodeGrid.mpNodeLocationZ + thirdVertexIndex;
+
+	const ScalarType*				pFirstVelocityX = nodeGrid.mpNodeVelocityX + firstVertexIndex;
+	const ScalarType*				pFirstVelocityY = nodeGrid.mpNodeVelocityY + firstVertexIndex;
+	const ScalarType*				pFirstVelocityZ = nodeGrid.mpNodeVelocityZ + firstVertexIndex;
+	const ScalarType*				pSecondVelocityX = nodeGrid.mpNodeVelocityX + secondVertexIndex;
+	const ScalarType*				pSecondVelocityY = nodeGrid.mpNodeVelocityY + secondVertexIndex;
+	const ScalarType*				pSecondVelocityZ = nodeGrid.mpNodeVelocityZ + secondVertexIndex;
+	const ScalarType*				pThirdVelocityX = nodeGrid.mpNodeVelocityX + thirdVertexIndex;
+	const ScalarType*				pThirdVelocityY = nodeGrid.mpNodeVelocityY + thirdVertexIndex;
+	const ScalarType*				pThirdVelocityZ = nodeGrid.mpNodeVelocityZ + thirdVertexIndex;
+
+	for (IndexType triangleLoop = 0; triangleLoop < triangleCount; triangleLoop++) {
+		// Triangle normal (the magnitude is twice the triangle area).
+		const ScalarType			firstEdgeX = pSecondLocationX[triangleLoop] -
+			pFirstLocationX[triangleLoop];
+		const ScalarType			firstEdgeY = pSecondLocationY[triangleLoop] -
+			pFirstLocationY[triangleLoop];
+		const ScalarType			firstEdgeZ = pSecondLocationZ[triangleLoop] -
+			pFirstLocationZ[triangleLoop];
+		const ScalarType			secondEdgeX = pThirdLocationX[triangleLoop] -
+			pFirstLocationX[triangleLoop];
+		const ScalarType			secondEdgeY = pThirdLocationY[triangleLoop] -
+			pFirstLocationY[triangleLoop];
+		const ScalarType			secondEdgeZ = pThirdLocationZ[triangleLoop] -
+			pFirstLocationZ[triangleLoop];
+
+		const ScalarType			normalX = (firstEdgeY * secondEdgeZ) -
+			(firstEdgeZ * secondEdgeY);
+		const ScalarType			normalY = (firstEdgeZ * secondEdgeX) -
+			(firstEdgeX * secondEdgeZ);
+		const ScalarType			normalZ = (firstEdgeX * secondEdgeY) -
+			(firstEdgeY * secondEdgeX);
+		const ScalarType			normalMagnitude = ::sqrt((normalX * normalX) +
+			(normalY * normalY) + (normalZ * normalZ));
+
+		// Wind velocity relative to the triangle (the triangle moves with the mean
+		// velocity of its vertices).
+		const ScalarType			relativeWindX = windX - ((pFirstVelocityX[triangleLoop] +
+			pSecondVelocityX[triangleLoop] + pThirdVelocityX[triangleLoop]) * kOneThird);
+		const ScalarType			relativeWindY = windY - ((pFirstVelocityY[triangleLoop] +
+			pSecondVelocityY[triangleLoop] + pThirdVelocityY[triangleLoop]) * kOneThird);
+		const ScalarType			relativeWindZ = windZ - ((pFirstVelocityZ[triangleLoop] +
+			pSecondVelocityZ[triangleLoop] + pThirdVelocityZ[triangleLoop]) * kOneThird);
+
+		const ScalarType			relativeSpeedSquared = (relativeWindX * relativeWindX) +
+			(relativeWindY * relativeWindY) + (relativeWindZ * relativeWindZ);
+		const ScalarType			relativeSpeed = ::sqrt(relativeSpeedSquared);
+
+		// Relative wind along the normal, scaled by the normal magnitude (proportional to
+		// the area of the triangle projected onto the relative wind).
+		const ScalarType			normalWind = (relativeWindX * normalX) +
+			(relativeWindY * normalY) + (relativeWindZ * normalZ);
+
+		// Degenerate triangles, and triangles at rest relative to the wind, receive no
+		// force.
+		const ScalarType			inverseNormalMagnitude = (normalMagnitude > 0.0) ?
+			(1.0 / normalMagnitude) : 0.0;
+		const ScalarType			inverseSpeedSquared = (relativeSpeedSquared > 0.0) ?
+			(1.0 / relativeSpeedSquared) : 0.0;
+
+		// Drag (N) = 0.5 x Density x Cd x Projected Area x Speed^2, along the relative
+		// wind.
+		const ScalarType			dragFactor = dragScale * ::fabs(normalWind);
+
+		// Lift (N) = 0.5 x Density x Cl x Projected Area x Speed^2, along the component of
+		// the normal that is perpendicular to the relative wind (the lift of a triangle
+		// that faces the wind, or is edge-on to the wind, is zero).
+		const ScalarType			liftFactor = liftScale * normalWind * relativeSpeed *
+			inverseNormalMagnitude;
+		const ScalarType			normalWindFraction = normalWind * inverseSpeedSquared;
+
+		pVertexForceX[triangleLoop] = (dragFactor * relativeWindX) +
+			(liftFactor * (normalX - (normalWindFraction * relativeWindX)));
+		pVertexForceY[triangleLoop] = (dragFactor * relativeWindY) +
+			(liftFactor * (normalY - (normalWindFraction * relativeWindY)));
+		pVertexForceZ[triangleLoop] = (dragFactor * relativeWindZ) +
+			(liftFactor * (normalZ - (normalWindFraction * relativeWindZ)));
+	}
+}
@@ -6,6 +6,10 @@
 
 
 #include "PhysicalNode.h"
+#include "WindNoiseField.h"
+
+
+class CWindFieldProducer;
 
 class CGravityNodeForce : public CExternalNodeForce
 {
@@ -19,6 +23,10 @@ public:
 	bool							GenerateExternalForceVector(
 		const CPhysicalNodeBase& targetNode, CVector& forceVector) const;
 
+	// Adds the instantaneous gravitational force to the forces of a batch of nodes.
+	bool							AccumulateExternalForceVectors(
+		const CExternalForceNodeBatch& nodeBatch) const;
+
 	// Determines if the external node gravitational force generator class
 	// is valid in accordance with its defining parameters.
 	bool							IsValid() const;
@@ -45,6 +53,10 @@ public:
 	bool							GenerateExternalForceVector(
 		const CPhysicalNodeBase& targetNode, CVector& forceVector) const;
 
+	// Adds the instantaneous wind force to the forces of a batch of nodes.
+	bool							AccumulateExternalForceVectors(
+		const CExternalForceNodeBatch& nodeBatch) const;
+
 	// Determines if the external node wind force generator class is valid
 	// in accordance with its defining parameters.
 	bool							IsValid() const;
@@ -52,15 +64,40 @@ public:
 
 	void							SetAlterationConstant(const QuantityType constant);
 
-protected:
+	// Sets a precomputed noise field to be sampled instead of evaluating the noise
+	// function for each node (the field is not owned by the wind force, and may be
+	// shared) - NULL restores per-node noise function evaluation.
+	void							SetNoiseField(const CWindNoiseField* pNoiseField);
+
+	// Sets a producer from which wind forces are interpolated instead of being evaluated
+	// for each node (the producer is not owned by the wind force, and is advanced
+	// whenever the alteration constant is set) - NULL restores per-node evaluation.
+	void							SetFieldProducer(CWindFieldProducer* pFieldProducer);
 
 	// Noise function generates a number between -1.0 and 1.0, based upon the provided
 	// input.
-	double							NoiseFunction(const double noiseInputX,
-		const double noiseInputY, const double noiseInputZ) const;
+	static double					NoiseFunction(const double noiseInputX,
+		const double noiseInputY, const double noiseInputZ);
+
+protected:
+
+	// Determines the noise value and gust factor (0.0 - 1.0) applied to the wind at a
+	// location.
+	void							EvaluateWindNoise(const ScalarType locationX,
+		const ScalarType locationY, const ScalarType locationZ, ScalarType& noiseValue,
+		ScalarType& gustFactor) const;
 
 	QuantityType					mAlterationConstant;
 
+	// Precomputed noise field (NULL if the noise function is evaluated for each node).
+	const CWindNoiseField*			mpNoiseField;
+
+	// Background wind force producer (NULL if forces are evaluated for each node).
+	CWindFieldProducer*				mpFieldProducer;
+
+	// Number of nodes for which wind noise is determined at once.
+	enum { kNoiseBlockSize = 64 };
+
 	const CVector					mDirectionVector;
 	const ScalarType				mMaxMagnitude;
 };
@@ -78,6 +115,10 @@ public:
 	bool							GenerateExternalForceVector(
 		const CPhysicalNodeBase& targetNode, CVector& forceVector) const;
 
+	// Adds the instantaneous viscous/drag force to the forces of a batch of nodes.
+	bool							AccumulateExternalForceVectors(
+		const CExternalForceNodeBatch& nodeBatch) const;
+
 	// Determines if the external node viscous force generator class is valid
 	// in accordance with its defining parameters.
 	bool							IsValid() const;
@@ -91,4 +132,55 @@ protected:
 };
 
 
+// Aerodynamic force applied to each triangle of the cloth surface, determined from the
+// wind velocity relative to the triangle - drag acts along the relative wind, and lift
+// acts perpendicular to it. Both forces are proportional to the area of the triangle
+// projected onto the relative wind (a triangle that is edge-on to the wind receives no
+// force). The force applied to each triangle is distributed equally to its vertices.
+class CAerodynamicSurfaceForce : public CExternalSurfaceForce
+{
+public:
+	CAerodynamicSurfaceForce(const CVector windVelocity, const ScalarType airDensity,
+		const ScalarType dragCoefficient, const ScalarType liftCoefficient);
+	~CAerodynamicSurfaceForce();
+
+	// Adds the instantaneous aerodynamic force of every grid triangle to the forces of
+	// the triangle vertices.
+	bool							AccumulateSurfaceForceVectors(
+		const CExternalForceNodeGrid& nodeGrid) const;
+
+	// Determines if the aerodynamic surface force generator class is valid
+	// in accordance with its defining parameters.
+	bool							IsValid() const;
+
+	// Sets the velocity (m/s) of the wind.
+	void							SetWindVelocity(const CVector& windVelocity);
+
+protected:
+
+	// Number of grid cells for which triangle forces are evaluated at once.
+	enum { kCellBlockSize = 32 };
+
+	// Evaluates the force applied to each vertex of a number of triangles - the vertices
+	// of successive triangles are successive grid nodes, starting at the specified
+	// first, second and third vertex indices (the triangles are evaluated independently,
+	// permitting the loop to be vectorized).
+	void							EvaluateTriangleForces(const CExternalForceNodeGrid&
+		nodeGrid, const QuantityType triangleCount, const IndexType firstVertexIndex,
+		const IndexType secondVertexIndex, const IndexType thirdVertexIndex,
+		ScalarType* pVertexForceX, ScalarType* pVertexForceY,
+		ScalarType* pVertexForceZ) const;
+
+	// Wind velocity (m/s).
+	CVector							mWindVelocity;
+
+	// Density of the air (kg/m^3).
+	const ScalarType				mAirDensity;
+
+	// Drag and lift coefficients (dimensionless).
+	const ScalarType				mDragCoefficient;
+	const ScalarType				mLiftCoefficient;
+};
+
+
 #endif	// #ifndef _EXTERNALNODEFORCES_H
\ No newline at end of file
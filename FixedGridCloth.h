@@ -0,0 +1,1075 @@
+// FixedGridCloth.h - Contains declarations for a cloth network with grid dimensions that are
+//                    fixed at compile time.
+
+#ifndef _FIXEDGRIDCLOTH_H
+#define _FIXEDGRIDCLOTH_H		1
+
+
+#include "PrimaryHeaders.h"
+#include "PrimitiveSupport.h"
+#include "ClothNetworkBase.h"
+#include <algorithm>
+
+
+// Cloth network with compile-time grid dimensions - node state is stored in fixed-size
+// arrays (row-major order), and springs are not stored individually. Each spring class
+// (structural, shear and flexion) connects every node to the node at a constant grid
+// offset, so springs are evaluated as stencils with compile-time index strides (all
+// springs of a stencil share a spring constant and resting length). Results match those
+// of the spring array solver (explicit Euler integration).
+//
+// Nodes are grouped into square tiles - when enabled, tiles that remain at rest for a
+// number of steps "sleep" (their nodes are neither moved nor subjected to external
+// forces) until an adjacent tile moves, or the external force applied to the tile
+// changes.
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+class CFixedGridCloth : public CClothNetworkBase
+{
+public:
+	CFixedGridCloth(const FloatCoord nodeNetworkWidth, const FloatCoord nodeNetworkHeight,
+		const CFloatPoint& networkCoordOffset, const ScalarType nodeMass,
+		const ScalarType structSpringConstant, const ScalarType shearSpringConstant,
+		const ScalarType flexionSpringConstant);
+	~CFixedGridCloth();
+
+	// Determines if the cloth network is valid.
+	bool							IsValid() const;
+
+	// Sets the anchor node designation flag as specified (when set, forces
+	// applied to the node will not result in node motion).
+	bool							SetAnchorNode(const IndexType xIndex,
+		const IndexType yIndex, const bool bIsAnchorNode);
+
+	// Sets the unit of time (seconds) used when performing stepwise evaluation of applied
+	// forces in the cloth simulation.
+	bool							SetForceTimeQuantum(const ScalarType timeQuantum);
+
+	// Retrieves the unit of time (seconds) used for each evaluation step.
+	ScalarType						GetForceTimeQuantum() const;
+
+	// Estimates the largest time quantum for which explicit integration of the cloth
+	// network remains stable (determined from the stencil spring constants and the
+	// node mass).
+	ScalarType						EstimateStableTimeQuantum() const;
+
+	// Sets the mean kinetic energy per free node (J) below which a tile is considered to
+	// be at rest, and the number of successive steps for which a tile must remain at rest
+	// before it sleeps (a threshold of zero disables sleeping).
+	bool							SetSleepThreshold(const ScalarType energyThreshold,
+		const QuantityType stepCount);
+
+	// Retrieves the number of nodes within sleeping tiles.
+	QuantityType					GetSleepingNodeCount() const;
+
+protected:
+
+	enum {
+		// Number of nodes within the grid.
+		kNodeCount = rowNodeCount * columnNodeCount,
+
+		// Interval between nodes for flexion spring connections.
+		kFlexionSpringStride = 2,
+
+		// Number of nodes along each side of a tile (tiles along the right and bottom
+		// edges of the grid may be smaller - tiles are larger than the flexion spring
+		// stride, so springs only link adjacent tiles).
+		kTileSize = 4,
+
+		// Number of tiles along each grid row/column, and within the grid.
+		kTilesPerRow = (rowNodeCount + kTileSize - 1) / kTileSize,
+		kTilesPerColumn = (columnNodeCount + kTileSize - 1) / kTileSize,
+		kTileCount = kTilesPerRow * kTilesPerColumn,
+
+		// Number of nodes within each batch of external force evaluations.
+		kExternalForceBatchSize = 64
+	};
+
+	// Spring stencils (grid offset from the head node to the tail node of each spring).
+	typedef enum
+	{
+		eSpringStencilStructuralX = 0,	// (+1, 0)
+		eSpringStencilStructuralY,		// (0, +1)
+		eSpringStencilShearDown,		// (+1, +1)
+		eSpringStencilShearUp,			// (+1, -1)
+		eSpringStencilFlexionX,			// (+2, 0)
+		eSpringStencilFlexionY,			// (0, +2)
+		eSpringStencilCount
+	} ESpringStencil;
+
+	// Evaluates all forces being applied to the cloth network over a single step
+	// (the previous network state is not stored).
+	bool							EvaluateClothNodeNetworkStep(
+		const CExternalNodeForceCollection&	externalNodeForceCollection);
+
+	// Returns the number of nodes within each grid row (x-axis).
+	QuantityType					GetNodesPerRow() const;
+
+	// Returns the number of nodes within each grid column (y-axis).
+	QuantityType					GetNodesPerColumn() const;
+
+	// Retrieves the location of a grid node for rendering, interpolated between the
+	// previous and current network states.
+	CFloatPoint						GetRenderNodeLocation(const IndexType xIndex,
+		const IndexType yIndex) const;
+
+	// Retrieves the spring constant shared by the springs of a stencil.
+	ScalarType						GetStencilSpringConstant(const ESpringStencil
+		springStencil) const;
+
+	// Sets the resting length of each spring stencil from the node spacing.
+	void							InitializeStencilRestingLengths(const FloatCoord
+		xSpacing, const FloatCoord ySpacing);
+
+	// Evaluates the force of every spring within a stencil, and adds the forces to the
+	// head and tail nodes (the grid offset, and thus the index stride from head node to
+	// tail node, is a compile-time constant).
+	template <RelativeIndexType xOffset, RelativeIndexType yOffset>
+	void							AccumulateStencilSpringForces(const scalarType
+		springConstant, const scalarType springRestingLength)
+	{
+		// Index stride from head node to tail node.
+		const RelativeIndexType		kTailNodeStride = (yOffset *
+			(RelativeIndexType)rowNodeCount) + xOffset;
+
+		// Range of head node grid indices for which the tail node lies within the grid.
+		const IndexType				kFirstXIndex = (xOffset < 0) ? (IndexType)(-xOffset) : 0;
+		const IndexType				kEndXIndex = (xOffset > 0) ?
+			(IndexType)(rowNodeCount - xOffset) : rowNodeCount;
+		const IndexType				kFirstYIndex = (yOffset < 0) ? (IndexType)(-yOffset) : 0;
+		const IndexType				kEndYIndex = (yOffset > 0) ?
+			(IndexType)(columnNodeCount - yOffset) : columnNodeCount;
+
+		for (IndexType yLoop = kFirstYIndex; yLoop < kEndYIndex; yLoop++) {
+			// Springs between rows of sleeping nodes are not evaluated.
+			if (!this->mbRowAwake[yLoop] &&
+				!this->mbRowAwake[(IndexType)((RelativeIndexType)yLoop + yOffset)])
+			{
+				continue;
+			}
+
+			const IndexType			rowHeadIndex = yLoop * rowNodeCount;
+			const IndexType			rowTailIndex = (IndexType)((RelativeIndexType)rowHeadIndex +
+				kTailNodeStride);
+
+			// Evaluate the springs of the row (the springs do not depend upon one
+			// another)...
+			for (IndexType xLoop = kFirstXIndex; xLoop < kEndXIndex; xLoop++) {
+				const scalarType	deltaX = this->mNodeLocationX[rowHeadIndex + xLoop] -
+					this->mNodeLocationX[rowTailIndex + xLoop];
+				const scalarType	deltaY = this->mNodeLocationY[rowHeadIndex + xLoop] -
+					this->mNodeLocationY[rowTailIndex + xLoop];
+				const scalarType	deltaZ = this->mNodeLocationZ[rowHeadIndex + xLoop] -
+					this->mNodeLocationZ[rowTailIndex + xLoop];
+				const scalarType	springLength = (scalarType)::sqrt((deltaX * deltaX) +
+					(deltaY * deltaY) + (deltaZ * deltaZ));
+
+				// Spring force = - (Spring Constant x Spring displacement), directed along
+				// the spring. Zero-length springs do not produce a force.
+				scalarType			forceScale = 0;
+
+				if (springLength > 0) {
+					forceScale = -springConstant * (springLength - springRestingLength) /
+						springLength;
+				}
+
+				this->mRowSpringForceX[xLoop] = deltaX * forceScale;
+				this->mRowSpringForceY[xLoop] = deltaY * forceScale;
+				this->mRowSpringForceZ[xLoop] = deltaZ * forceScale;
+			}
+
+			// ...And apply the forces to the head and tail nodes in separate passes
+			// (successive springs of a row may share nodes).
+			for (IndexType headLoop = kFirstXIndex; headLoop < kEndXIndex; headLoop++) {
+				this->mNodeForceX[rowHeadIndex + headLoop] += this->mRowSpringForceX[headLoop];
+				this->mNodeForceY[rowHeadIndex + headLoop] += this->mRowSpringForceY[headLoop];
+				this->mNodeForceZ[rowHeadIndex + headLoop] += this->mRowSpringForceZ[headLoop];
+			}
+
+			for (IndexType tailLoop = kFirstXIndex; tailLoop < kEndXIndex; tailLoop++) {
+				this->mNodeForceX[rowTailIndex + tailLoop] -= this->mRowSpringForceX[tailLoop];
+				this->mNodeForceY[rowTailIndex + tailLoop] -= this->mRowSpringForceY[tailLoop];
+				this->mNodeForceZ[rowTailIndex + tailLoop] -= this->mRowSpringForceZ[tailLoop];
+			}
+		}
+	}
+
+	// Evaluates external forces for every active node (forces are evaluated for batches
+	// of nodes).
+	void							EvaluateExternalForces(
+		const CExternalNodeForceCollection&	externalNodeForceCollection);
+
+	// Evaluates the surface forces applied to the grid, and adds the forces to the
+	// pending forces of the active nodes.
+	void							AccumulateSurfaceForces(
+		const CExternalNodeForceCollection&	externalNodeForceCollection);
+
+	// Evaluates the external force applied to a single node.
+	void							EvaluateNodeExternalForce(
+		const CExternalNodeForceCollection&	externalNodeForceCollection,
+		const IndexType nodeIndex, CVector& resultantForceVector) const;
+
+	// Moves each node that is not sleeping using the accumulated forces (explicit Euler
+	// integration), and clears the forces.
+	void							IntegrateNodes(const scalarType timeQuantum);
+
+	// Retrieves the tile that contains a grid node.
+	IndexType						GetNodeTileIndex(const IndexType xIndex,
+		const IndexType yIndex) const;
+
+	// Selects the node of each tile used to detect external force changes while the
+	// tile sleeps (the first free node of the tile).
+	void							SelectTileSampleNodes();
+
+	// Wakes sleeping tiles that are adjacent to moving tiles, or for which the external
+	// force applied to the sample node has changed (returns true if any tile was
+	// woken).
+	bool							WakeDisturbedTiles(
+		const CExternalNodeForceCollection&	externalNodeForceCollection);
+
+	// Determines the kinetic energy of each tile that is not sleeping, and places tiles
+	// that have remained at rest for the required number of steps into sleep (returns
+	// true if any tile was placed into sleep).
+	bool							UpdateTileRestStates(
+		const CExternalNodeForceCollection&	externalNodeForceCollection);
+
+	// Wakes a tile.
+	void							WakeTile(const IndexType tileIndex);
+
+	// Rebuilds the active node list (free nodes within tiles that are not sleeping) and
+	// the per-row activity designations, after anchor nodes or tile states change.
+	void							UpdateActiveNodeList();
+
+	// Stores the current location of each node as the previous network state.
+	void							StorePreviousNodeLocations();
+
+
+	// Node locations.
+	scalarType						mNodeLocationX[kNodeCount];
+	scalarType						mNodeLocationY[kNodeCount];
+	scalarType						mNodeLocationZ[kNodeCount];
+
+	// Node velocities.
+	scalarType						mNodeVelocityX[kNodeCount];
+	scalarType						mNodeVelocityY[kNodeCount];
+	scalarType						mNodeVelocityZ[kNodeCount];
+
+	// Pending node forces.
+	scalarType						mNodeForceX[kNodeCount];
+	scalarType						mNodeForceY[kNodeCount];
+	scalarType						mNodeForceZ[kNodeCount];
+
+	// Node locations prior to the most recent evaluation.
+	scalarType						mPreviousNodeLocationX[kNodeCount];
+	scalarType						mPreviousNodeLocationY[kNodeCount];
+	scalarType						mPreviousNodeLocationZ[kNodeCount];
+
+	// Inverse mass of each node (zero for anchor nodes).
+	scalarType						mNodeInverseMass[kNodeCount];
+
+	// Anchor node designation of each node.
+	bool							mbIsAnchorNode[kNodeCount];
+
+	// Spring forces of a single grid row (stencil evaluation).
+	scalarType						mRowSpringForceX[rowNodeCount];
+	scalarType						mRowSpringForceY[rowNodeCount];
+	scalarType						mRowSpringForceZ[rowNodeCount];
+
+	// Resting length of the springs within each stencil.
+	scalarType						mStencilRestingLength[eSpringStencilCount];
+
+	// Indices of the active nodes (free nodes within tiles that are not sleeping), in
+	// ascending order - only active nodes are subjected to external forces and moved.
+	IndexType						mActiveNodeIndex[kNodeCount];
+	QuantityType					mActiveNodeCount;
+
+	// Indicates whether or not each grid row contains active nodes (springs between
+	// rows without active nodes are not evaluated).
+	bool							mbRowAwake[columnNodeCount];
+
+	// Indicates whether or not each tile is sleeping.
+	bool							mbTileSleeping[kTileCount];
+
+	// Number of successive steps for which each tile has remained at rest.
+	QuantityType					mTileRestStepCount[kTileCount];
+
+	// Mean kinetic energy per free node of each tile after the most recent step (zero
+	// for sleeping tiles, and for tiles without free nodes).
+	scalarType						mTileKineticEnergy[kTileCount];
+
+	// Node of each tile used to detect external force changes (the node count if the
+	// tile does not contain free nodes), and the external force applied to the node
+	// when the tile was placed into sleep.
+	IndexType						mTileSampleNodeIndex[kTileCount];
+	CVector							mTileSampleForce[kTileCount];
+
+	// Node state staged for surface force evaluation.
+	CExternalForceGridBuffer		mSurfaceForceGrid;
+
+	// Mean kinetic energy per free node below which a tile is at rest (zero if sleeping
+	// is disabled).
+	ScalarType						mSleepEnergyThreshold;
+
+	// Number of successive steps at rest required before a tile sleeps.
+	QuantityType					mSleepStepCount;
+
+	// Number of nodes within sleeping tiles.
+	QuantityType					mSleepingNodeCount;
+
+	// Unit of time (seconds) used for each evaluation step in the cloth simulation.
+	ScalarType						mForceTimeQuantum;
+
+	// Node Mass
+	const ScalarType				mNodeMass;
+
+	// Main "structural" spring constants.
+	const ScalarType				mStructSpringConstant;
+
+	// Diagonal "shear" spring constants.
+	const ScalarType				mShearSpringConstant;
+
+	// "Flexion/Bend" spring constants.
+	const ScalarType				mFlexionSpringConstant;
+};
+
+
+/////
+// CFixedGridCloth class
+/////
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::CFixedGridCloth(
+	const FloatCoord nodeNetworkWidth, const FloatCoord nodeNetworkHeight,
+	const CFloatPoint& networkCoordOffset, const ScalarType nodeMass,
+	const ScalarType structSpringConstant, const ScalarType shearSpringConstant,
+	const ScalarType flexionSpringConstant) :
+
+	mActiveNodeCount(0), mSleepEnergyThreshold(0.0), mSleepStepCount(0),
+	mSleepingNodeCount(0), mForceTimeQuantum(0.0), mNodeMass(nodeMass),
+	mStructSpringConstant(structSpringConstant), mShearSpringConstant(shearSpringConstant),
+	mFlexionSpringConstant(flexionSpringConstant)
+{
+	// Nodes are positioned as they are within the generic node network.
+	const FloatCoord				xSpacing = nodeNetworkWidth / rowNodeCount;
+	const FloatCoord				ySpacing = nodeNetworkHeight / columnNodeCount;
+
+	for (IndexType yLoop = 0; yLoop < columnNodeCount; yLoop++) {
+		for (IndexType xLoop = 0; xLoop < rowNodeCount; xLoop++) {
+			const IndexType			nodeIndex = (yLoop * rowNodeCount) + xLoop;
+			const CFloatPoint		nodeLocation = CFloatPoint((FloatCoord)xLoop * xSpacing,
+				(FloatCoord)yLoop * ySpacing, 0.0) + networkCoordOffset;
+
+			this->mNodeLocationX[nodeIndex] = (scalarType)nodeLocation.GetXCoord();
+			this->mNodeLocationY[nodeIndex] = (scalarType)nodeLocation.GetYCoord();
+			this->mNodeLocationZ[nodeIndex] = (scalarType)nodeLocation.GetZCoord();
+
+			this->mNodeVelocityX[nodeIndex] = 0.0;
+			this->mNodeVelocityY[nodeIndex] = 0.0;
+			this->mNodeVelocityZ[nodeIndex] = 0.0;
+
+			this->mNodeForceX[nodeIndex] = 0.0;
+			this->mNodeForceY[nodeIndex] = 0.0;
+			this->mNodeForceZ[nodeIndex] = 0.0;
+
+			this->mNodeInverseMass[nodeIndex] = (nodeMass > 0.0) ?
+				(scalarType)(1.0 / nodeMass) : 0;
+			this->mbIsAnchorNode[nodeIndex] = false;
+		}
+	}
+
+	this->InitializeStencilRestingLengths(xSpacing, ySpacing);
+	this->StorePreviousNodeLocations();
+
+	// All tiles are initially awake.
+	for (IndexType tileLoop = 0; tileLoop < kTileCount; tileLoop++) {
+		this->WakeTile(tileLoop);
+	}
+
+	this->SelectTileSampleNodes();
+	this->UpdateActiveNodeList();
+}
+
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::~CFixedGridCloth()
+{
+
+}
+
+
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+bool CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::IsValid() const
+{
+	return((rowNodeCount > 0) && (columnNodeCount > 0) && (this->mNodeMass >= 0.0) &&
+		(this->mForceTimeQuantum > 0.0));
+}
+
+
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+bool CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::SetAnchorNode(
+	const IndexType xIndex, const IndexType yIndex, const bool bIsAnchorNode)
+{
+	bool							bAnchorNodeSet = false;
+
+	if ((xIndex < rowNodeCount) && (yIndex < columnNodeCount)) {
+		const IndexType				nodeIndex = (yIndex * rowNodeCount) + xIndex;
+
+		// Anchor nodes have an inverse mass of zero, and a velocity of zero.
+		this->mbIsAnchorNode[nodeIndex] = bIsAnchorNode;
+		this->mNodeInverseMass[nodeIndex] = (!bIsAnchorNode && (this->mNodeMass > 0.0)) ?
+			(scalarType)(1.0 / this->mNodeMass) : 0;
+
+		if (bIsAnchorNode) {
+			this->mNodeVelocityX[nodeIndex] = 0.0;
+			this->mNodeVelocityY[nodeIndex] = 0.0;
+			this->mNodeVelocityZ[nodeIndex] = 0.0;
+		}
+
+		// The set of free nodes within the tile has changed.
+		this->WakeTile(this->GetNodeTileIndex(xIndex, yIndex));
+		this->SelectTileSampleNodes();
+		this->UpdateActiveNodeList();
+
+		// The stable time quantum depends upon the set of free nodes.
+		this->InvalidateStableTimeQuantum();
+
+		bAnchorNodeSet = true;
+	}
+
+	return(bAnchorNodeSet);
+}
+
+
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+bool CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::SetForceTimeQuantum(
+	const ScalarType timeQuantum)
+{
+	bool							bQuantumSetSuccessfully = false;
+
+	if (timeQuantum > 0.0) {
+		this->mForceTimeQuantum = timeQuantum;
+		bQuantumSetSuccessfully = true;
+	}
+
+	return(bQuantumSetSuccessfully);
+}
+
+
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+ScalarType CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::GetForceTimeQuantum() const
+{
+	return(this->mForceTimeQuantum);
+}
+
+
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+ScalarType CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::EstimateStableTimeQuantum() const
+{
+	ScalarType						stableTimeQuantum = 0.0;
+
+	// Grid offset from the head node to the tail node of each spring stencil.
+	const RelativeIndexType			kStencilOffsetX[eSpringStencilCount] = { 1, 0, 1, 1,
+		kFlexionSpringStride, 0 };
+	const RelativeIndexType			kStencilOffsetY[eSpringStencilCount] = { 0, 1, 1, -1,
+		0, kFlexionSpringStride };
+
+	// Largest eigenvalue <= max(2 x Stiffness Sum / Mass), where the stiffness sum is the
+	// sum of the spring constants of the springs attached to a node (each node is the
+	// head of one spring, and the tail of another, within each stencil - anchor nodes
+	// do not move).
+	ScalarType						maximumEigenvalue = 0.0;
+
+	for (IndexType yLoop = 0; yLoop < columnNodeCount; yLoop++) {
+		for (IndexType xLoop = 0; xLoop < rowNodeCount; xLoop++) {
+			const IndexType			nodeIndex = (yLoop * rowNodeCount) + xLoop;
+			ScalarType				nodeStiffnessSum = 0.0;
+
+			for (IndexType stencilLoop = 0; stencilLoop < eSpringStencilCount; stencilLoop++) {
+				const RelativeIndexType
+									headXIndex = (RelativeIndexType)xLoop +
+					kStencilOffsetX[stencilLoop];
+				const RelativeIndexType
+									headYIndex = (RelativeIndexType)yLoop +
+					kStencilOffsetY[stencilLoop];
+				const RelativeIndexType
+									tailXIndex = (RelativeIndexType)xLoop -
+					kStencilOffsetX[stencilLoop];
+				const RelativeIndexType
+									tailYIndex = (RelativeIndexType)yLoop -
+					kStencilOffsetY[stencilLoop];
+
+				const ScalarType	springConstant = ::fabs(this->GetStencilSpringConstant(
+					(ESpringStencil)stencilLoop));
+
+				if ((headXIndex >= 0) && (headXIndex < (RelativeIndexType)rowNodeCount) &&
+					(headYIndex >= 0) && (headYIndex < (RelativeIndexType)columnNodeCount))
+				{
+					nodeStiffnessSum += springConstant;
+				}
+
+				if ((tailXIndex >= 0) && (tailXIndex < (RelativeIndexType)rowNodeCount) &&
+					(tailYIndex >= 0) && (tailYIndex < (RelativeIndexType)columnNodeCount))
+				{
+					nodeStiffnessSum += springConstant;
+				}
+			}
+
+			const ScalarType		eigenvalueBound = 2.0 * nodeStiffnessSum *
+				(ScalarType)this->mNodeInverseMass[nodeIndex];
+
+			if (eigenvalueBound > maximumEigenvalue) {
+				maximumEigenvalue = eigenvalueBound;
+			}
+		}
+	}
+
+	// Explicit integration of an oscillator with angular frequency w is stable when
+	// Time x w < 2.
+	if (maximumEigenvalue > 0.0) {
+		stableTimeQuantum = 2.0 / ::sqrt(maximumEigenvalue);
+	}
+
+	return(stableTimeQuantum);
+}
+
+
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+bool CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::EvaluateClothNodeNetworkStep(
+	const CExternalNodeForceCollection&	externalNodeForceCollection)
+{
+	bool							bEvaluatedSuccessfully = false;
+
+	if (this->IsValid()) {
+		// Wake any sleeping tiles that have been disturbed.
+		if ((this->mSleepEnergyThreshold > 0.0) &&
+			this->WakeDisturbedTiles(externalNodeForceCollection))
+		{
+			this->UpdateActiveNodeList();
+		}
+
+		// Evaluate external forces (spring forces are accumulated on top of the
+		// external forces)...
+		this->EvaluateExternalForces(externalNodeForceCollection);
+
+		if (externalNodeForceCollection.HasSurfaceForces()) {
+			this->AccumulateSurfaceForces(externalNodeForceCollection);
+		}
+
+		// ...Evaluate each spring stencil...
+		this->template AccumulateStencilSpringForces<1, 0>(
+			(scalarType)this->GetStencilSpringConstant(eSpringStencilStructuralX),
+			this->mStencilRestingLength[eSpringStencilStructuralX]);
+		this->template AccumulateStencilSpringForces<0, 1>(
+			(scalarType)this->GetStencilSpringConstant(eSpringStencilStructuralY),
+			this->mStencilRestingLength[eSpringStencilStructuralY]);
+		this->template AccumulateStencilSpringForces<1, 1>(
+			(scalarType)this->GetStencilSpringConstant(eSpringStencilShearDown),
+			this->mStencilRestingLength[eSpringStencilShearDown]);
+		this->template AccumulateStencilSpringForces<1, -1>(
+			(scalarType)this->GetStencilSpringConstant(eSpringStencilShearUp),
+			this->mStencilRestingLength[eSpringStencilShearUp]);
+		this->template AccumulateStencilSpringForces<kFlexionSpringStride, 0>(
+			(scalarType)this->GetStencilSpringConstant(eSpringStencilFlexionX),
+			this->mStencilRestingLength[eSpringStencilFlexionX]);
+		this->template AccumulateStencilSpringForces<0, kFlexionSpringStride>(
+			(scalarType)this->GetStencilSpringConstant(eSpringStencilFlexionY),
+			this->mStencilRestingLength[eSpringStencilFlexionY]);
+
+		// ...Move the nodes...
+		this->IntegrateNodes((scalarType)this->mForceTimeQuantum);
+
+		// ...And place tiles that have come to rest into sleep.
+		if ((this->mSleepEnergyThreshold > 0.0) &&
+			this->UpdateTileRestStates(externalNodeForceCollection))
+		{
+			this->UpdateActiveNodeList();
+		}
+
+		bEvaluatedSuccessfully = true;
+	}
+
+	return(bEvaluatedSuccessfully);
+}
+
+
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+bool CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::SetSleepThreshold(
+	const ScalarType energyThreshold, const QuantityType stepCount)
+{
+	bool							bThresholdSetSuccessfully = false;
+
+	if ((energyThreshold >= 0.0) && ((energyThreshold == 0.0) || (stepCount > 0))) {
+		this->mSleepEnergyThreshold = energyThreshold;
+		this->mSleepStepCount = stepCount;
+
+		// Tiles re-enter sleep using the new threshold.
+		for (IndexType tileLoop = 0; tileLoop < kTileCount; tileLoop++) {
+			this->WakeTile(tileLoop);
+		}
+
+		this->UpdateActiveNodeList();
+
+		bThresholdSetSuccessfully = true;
+	}
+
+	return(bThresholdSetSuccessfully);
+}
+
+
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+QuantityType CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::GetSleepingNodeCount() const
+{
+	return(this->mSleepingNodeCount);
+}
+
+
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+QuantityType CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::GetNodesPerRow() const
+{
+	return(rowNodeCount);
+}
+
+
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+QuantityType CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::GetNodesPerColumn() const
+{
+	return(columnNodeCount);
+}
+
+
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+CFloatPoint CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::GetRenderNodeLocation(
+	const IndexType xIndex, const IndexType yIndex) const
+{
+	CFloatPoint						nodeLocation(0.0, 0.0, 0.0);
+
+	if ((xIndex < rowNodeCount) && (yIndex < columnNodeCount)) {
+		// Interpolate linearly from the previous location to the current location.
+		const IndexType				nodeIndex = (yIndex * rowNodeCount) + xIndex;
+		const ScalarType			interpolationFactor = this->mRenderInterpolationFactor;
+
+		nodeLocation = CFloatPoint(
+			this->mPreviousNodeLocationX[nodeIndex] + ((this->mNodeLocationX[nodeIndex] -
+			this->mPreviousNodeLocationX[nodeIndex]) * interpolationFactor),
+			this->mPreviousNodeLocationY[nodeIndex] + ((this->mNodeLocationY[nodeIndex] -
+			this->mPreviousNodeLocationY[nodeIndex]) * interpolationFactor),
+			this->mPreviousNodeLocationZ[nodeIndex] + ((this->mNodeLocationZ[nodeIndex] -
+			this->mPreviousNodeLocationZ[nodeIndex]) * interpolationFactor));
+	}
+
+	return(nodeLocation);
+}
+
+
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+ScalarType CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::GetStencilSpringConstant(
+	const ESpringStencil springStencil) const
+{
+	ScalarType						springConstant = this->mStructSpringConstant;
+
+	if ((springStencil == eSpringStencilShearDown) ||
+		(springStencil == eSpringStencilShearUp))
+	{
+		springConstant = this->mShearSpringConstant;
+	}
+	else if ((springStencil == eSpringStencilFlexionX) ||
+		(springStencil == eSpringStencilFlexionY))
+	{
+		springConstant = this->mFlexionSpringConstant;
+	}
+
+	return(springConstant);
+}
+
+
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+void CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::InitializeStencilRestingLengths(
+	const FloatCoord xSpacing, const FloatCoord ySpacing)
+{
+	const FloatCoord				diagonalLength = ::sqrt((xSpacing * xSpacing) +
+		(ySpacing * ySpacing));
+
+	this->mStencilRestingLength[eSpringStencilStructuralX] = (scalarType)xSpacing;
+	this->mStencilRestingLength[eSpringStencilStructuralY] = (scalarType)ySpacing;
+	this->mStencilRestingLength[eSpringStencilShearDown] = (scalarType)diagonalLength;
+	this->mStencilRestingLength[eSpringStencilShearUp] = (scalarType)diagonalLength;
+	this->mStencilRestingLength[eSpringStencilFlexionX] = (scalarType)(xSpacing *
+		kFlexionSpringStride);
+	this->mStencilRestingLength[eSpringStencilFlexionY] = (scalarType)(ySpacing *
+		kFlexionSpringStride);
+}
+
+
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+void CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::EvaluateExternalForces(
+	const CExternalNodeForceCollection&	externalNodeForceCollection)
+{
+	ScalarType						nodeLocationX[kExternalForceBatchSize];
+	ScalarType						nodeLocationY[kExternalForceBatchSize];
+	ScalarType						nodeLocationZ[kExternalForceBatchSize];
+	ScalarType						nodeVelocityX[kExternalForceBatchSize];
+	ScalarType						nodeVelocityY[kExternalForceBatchSize];
+	ScalarType						nodeVelocityZ[kExternalForceBatchSize];
+	ScalarType						nodeMass[kExternalForceBatchSize];
+	ScalarType						nodeForceX[kExternalForceBatchSize];
+	ScalarType						nodeForceY[kExternalForceBatchSize];
+	ScalarType						nodeForceZ[kExternalForceBatchSize];
+
+	// All nodes have the same mass.
+	std::fill(nodeMass, nodeMass + kExternalForceBatchSize, this->mNodeMass);
+
+	// Anchor nodes and sleeping nodes are not moved (their pending forces remain
+	// clear).
+	for (IndexType batchStartIndex = 0; batchStartIndex < this->mActiveNodeCount;
+		batchStartIndex += kExternalForceBatchSize)
+	{
+		const QuantityType			batchNodeCount =
+			((this->mActiveNodeCount - batchStartIndex) < kExternalForceBatchSize) ?
+			(this->mActiveNodeCount - batchStartIndex) : (QuantityType)kExternalForceBatchSize;
+
+		// Gather the state of the active nodes within the batch...
+		for (IndexType gatherLoop = 0; gatherLoop < batchNodeCount; gatherLoop++) {
+			const IndexType			nodeIndex =
+				this->mActiveNodeIndex[batchStartIndex + gatherLoop];
+
+			nodeLocationX[gatherLoop] = this->mNodeLocationX[nodeIndex];
+			nodeLocationY[gatherLoop] = this->mNodeLocationY[nodeIndex];
+			nodeLocationZ[gatherLoop] = this->mNodeLocationZ[nodeIndex];
+			nodeVelocityX[gatherLoop] = this->mNodeVelocityX[nodeIndex];
+			nodeVelocityY[gatherLoop] = this->mNodeVelocityY[nodeIndex];
+			nodeVelocityZ[gatherLoop] = this->mNodeVelocityZ[nodeIndex];
+		}
+
+		// ...Evaluate all external forces for the batch...
+		const CExternalForceNodeBatch
+									nodeBatch(batchNodeCount, nodeLocationX, nodeLocationY,
+			nodeLocationZ, nodeVelocityX, nodeVelocityY, nodeVelocityZ, nodeMass,
+			nodeForceX, nodeForceY, nodeForceZ);
+
+		externalNodeForceCollection.EvaluateExternalForces(nodeBatch,
+			this->mForceTimeQuantum);
+
+		// ...And store the resulting forces.
+		for (IndexType scatterLoop = 0; scatterLoop < batchNodeCount; scatterLoop++) {
+			const IndexType			nodeIndex =
+				this->mActiveNodeIndex[batchStartIndex + scatterLoop];
+
+			this->mNodeForceX[nodeIndex] = (scalarType)nodeForceX[scatterLoop];
+			this->mNodeForceY[nodeIndex] = (scalarType)nodeForceY[scatterLoop];
+			this->mNodeForceZ[nodeIndex] = (scalarType)nodeForceZ[scatterLoop];
+		}
+	}
+}
+
+
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+void CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::AccumulateSurfaceForces(
+	const CExternalNodeForceCollection&	externalNodeForceCollection)
+{
+	// Stage the state of every node (triangles within sleeping tiles still bound the
+	// triangles of adjacent active tiles)...
+	this->mSurfaceForceGrid.AllocateGrid(rowNodeCount, columnNodeCount);
+
+	std::copy(this->mNodeLocationX, this->mNodeLocationX + kNodeCount,
+		this->mSurfaceForceGrid.mNodeLocationX.begin());
+	std::copy(this->mNodeLocationY, this->mNodeLocationY + kNodeCount,
+		this->mSurfaceForceGrid.mNodeLocationY.begin());
+	std::copy(this->mNodeLocationZ, this->mNodeLocationZ + kNodeCount,
+		this->mSurfaceForceGrid.mNodeLocationZ.begin());
+	std::copy(this->mNodeVelocityX, this->mNodeVelocityX + kNodeCount,
+		this->mSurfaceForceGrid.mNodeVelocityX.begin());
+	std::copy(this->mNodeVelocityY, this->mNodeVelocityY + kNodeCount,
+		this->mSurfaceForceGrid.mNodeVelocityY.begin());
+	std::copy(this->mNodeVelocityZ, this->mNodeVelocityZ + kNodeCount,
+		this->mSurfaceForceGrid.mNodeVelocityZ.begin());
+
+	// ...Evaluate the surface forces...
+	externalNodeForceCollection.EvaluateSurfaceForces(this->mSurfaceForceGrid.GetNodeGrid());
+
+	// ...And add the forces of the active nodes to the pending forces (the forces of
+	// sleeping nodes are not used to detect disturbances).
+	for (IndexType activeNodeLoop = 0; activeNodeLoop < this->mActiveNodeCount;
+		activeNodeLoop++)
+	{
+		const IndexType				nodeIndex = this->mActiveNodeIndex[activeNodeLoop];
+
+		this->mNodeForceX[nodeIndex] += (scalarType)this->mSurfaceForceGrid.mNodeForceX[nodeIndex];
+		this->mNodeForceY[nodeIndex] += (scalarType)this->mSurfaceForceGrid.mNodeForceY[nodeIndex];
+		this->mNodeForceZ[nodeIndex] += (scalarType)this->mSurfaceForceGrid.mNodeForceZ[nodeIndex];
+	}
+}
+
+
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+void CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::EvaluateNodeExternalForce(
+	const CExternalNodeForceCollection&	externalNodeForceCollection, const IndexType nodeIndex,
+	CVector& resultantForceVector) const
+{
+	const CPhysicalNodeState		nodeReference(CFloatPoint(this->mNodeLocationX[nodeIndex],
+		this->mNodeLocationY[nodeIndex], this->mNodeLocationZ[nodeIndex]),
+		CVector(this->mNodeVelocityX[nodeIndex], this->mNodeVelocityY[nodeIndex],
+		this->mNodeVelocityZ[nodeIndex]), this->mNodeMass, this->mbIsAnchorNode[nodeIndex]);
+
+	externalNodeForceCollection.EvaluateExternalForces(nodeReference,
+		resultantForceVector, this->mForceTimeQuantum);
+}
+
+
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+void CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::IntegrateNodes(
+	const scalarType timeQuantum)
+{
+	for (IndexType activeNodeLoop = 0; activeNodeLoop < this->mActiveNodeCount;
+		activeNodeLoop++)
+	{
+		// Acceleration = Force (N) / Mass (kg) (anchor nodes and sleeping nodes are
+		// not within the active node list).
+		const IndexType				nodeIndex = this->mActiveNodeIndex[activeNodeLoop];
+		const scalarType			inverseMass = this->mNodeInverseMass[nodeIndex];
+
+		const scalarType			accelerationX = this->mNodeForceX[nodeIndex] * inverseMass;
+		const scalarType			accelerationY = this->mNodeForceY[nodeIndex] * inverseMass;
+		const scalarType			accelerationZ = this->mNodeForceZ[nodeIndex] * inverseMass;
+
+		// Displacement = (Velocity x Time) + (Acceleration x Time^2)
+		this->mNodeLocationX[nodeIndex] += (this->mNodeVelocityX[nodeIndex] * timeQuantum) +
+			(accelerationX * timeQuantum * timeQuantum);
+		this->mNodeLocationY[nodeIndex] += (this->mNodeVelocityY[nodeIndex] * timeQuantum) +
+			(accelerationY * timeQuantum * timeQuantum);
+		this->mNodeLocationZ[nodeIndex] += (this->mNodeVelocityZ[nodeIndex] * timeQuantum) +
+			(accelerationZ * timeQuantum * timeQuantum);
+
+		// Velocity = Velocity + (Acceleration x Time)
+		this->mNodeVelocityX[nodeIndex] += accelerationX * timeQuantum;
+		this->mNodeVelocityY[nodeIndex] += accelerationY * timeQuantum;
+		this->mNodeVelocityZ[nodeIndex] += accelerationZ * timeQuantum;
+	}
+
+	// Clear the forces after they have been applied (spring forces are also
+	// accumulated for anchor nodes and sleeping nodes).
+	for (IndexType nodeLoop = 0; nodeLoop < kNodeCount; nodeLoop++) {
+		this->mNodeForceX[nodeLoop] = 0.0;
+		this->mNodeForceY[nodeLoop] = 0.0;
+		this->mNodeForceZ[nodeLoop] = 0.0;
+	}
+}
+
+
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+void CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::StorePreviousNodeLocations()
+{
+	for (IndexType nodeLoop = 0; nodeLoop < kNodeCount; nodeLoop++) {
+		this->mPreviousNodeLocationX[nodeLoop] = this->mNodeLocationX[nodeLoop];
+		this->mPreviousNodeLocationY[nodeLoop] = this->mNodeLocationY[nodeLoop];
+		this->mPreviousNodeLocationZ[nodeLoop] = this->mNodeLocationZ[nodeLoop];
+	}
+}
+
+
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+IndexType CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::GetNodeTileIndex(const IndexType xIndex,
+	const IndexType yIndex) const
+{
+	return(((yIndex / kTileSize) * kTilesPerRow) + (xIndex / kTileSize));
+}
+
+
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+void CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::SelectTileSampleNodes()
+{
+	for (IndexType tileLoop = 0; tileLoop < kTileCount; tileLoop++) {
+		this->mTileSampleNodeIndex[tileLoop] = kNodeCount;
+	}
+
+	// Nodes are visited in row-major order - retain the first free node of each tile.
+	for (IndexType yLoop = 0; yLoop < columnNodeCount; yLoop++) {
+		for (IndexType xLoop = 0; xLoop < rowNodeCount; xLoop++) {
+			const IndexType			nodeIndex = (yLoop * rowNodeCount) + xLoop;
+			const IndexType			tileIndex = this->GetNodeTileIndex(xLoop, yLoop);
+
+			if (!this->mbIsAnchorNode[nodeIndex] &&
+				(this->mTileSampleNodeIndex[tileIndex] == kNodeCount))
+			{
+				this->mTileSampleNodeIndex[tileIndex] = nodeIndex;
+			}
+		}
+	}
+}
+
+
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+bool CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::WakeDisturbedTiles(
+	const CExternalNodeForceCollection&	externalNodeForceCollection)
+{
+	bool							bTilesWoken = false;
+
+	// Period over which a tile must remain at rest.
+	const ScalarType				restPeriod = this->mForceTimeQuantum *
+		(ScalarType)this->mSleepStepCount;
+
+	for (IndexType tileYLoop = 0; tileYLoop < kTilesPerColumn; tileYLoop++) {
+		for (IndexType tileXLoop = 0; tileXLoop < kTilesPerRow; tileXLoop++) {
+			const IndexType			tileIndex = (tileYLoop * kTilesPerRow) + tileXLoop;
+			const IndexType			sampleNodeIndex = this->mTileSampleNodeIndex[tileIndex];
+
+			// Tiles that do not contain free nodes are never disturbed.
+			if (!this->mbTileSleeping[tileIndex] || (sampleNodeIndex == kNodeCount)) {
+				continue;
+			}
+
+			// Wake the tile if an adjacent tile is moving (tiles that have just been
+			// woken have no kinetic energy, so waking does not cascade within a
+			// step)...
+			bool					bTileDisturbed = false;
+
+			for (IndexType neighborYLoop = ((tileYLoop > 0) ? (tileYLoop - 1) : 0);
+				!bTileDisturbed && (neighborYLoop <= (tileYLoop + 1)) &&
+				(neighborYLoop < kTilesPerColumn); neighborYLoop++)
+			{
+				for (IndexType neighborXLoop = ((tileXLoop > 0) ? (tileXLoop - 1) : 0);
+					!bTileDisturbed && (neighborXLoop <= (tileXLoop + 1)) &&
+					(neighborXLoop < kTilesPerRow); neighborXLoop++)
+				{
+					bTileDisturbed = (this->mTileKineticEnergy[(neighborYLoop * kTilesPerRow) +
+						neighborXLoop] > this->mSleepEnergyThreshold);
+				}
+			}
+
+			// ...Or if the change in external force would impart more than the rest
+			// energy to the sample node over the rest period (E = (F x t)^2 / 2m).
+			if (!bTileDisturbed) {
+				CVector				sampleForceVector;
+
+				this->EvaluateNodeExternalForce(externalNodeForceCollection, sampleNodeIndex,
+					sampleForceVector);
+
+				const CVector		forceChangeVector = sampleForceVector -
+					this->mTileSampleForce[tileIndex];
+				const ScalarType	impulseMagnitude = forceChangeVector.GetMagnitude() *
+					restPeriod;
+
+				bTileDisturbed = ((impulseMagnitude * impulseMagnitude * 0.5 *
+					this->mNodeInverseMass[sampleNodeIndex]) > this->mSleepEnergyThreshold);
+			}
+
+			if (bTileDisturbed) {
+				this->WakeTile(tileIndex);
+				bTilesWoken = true;
+			}
+		}
+	}
+
+	return(bTilesWoken);
+}
+
+
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+bool CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::UpdateTileRestStates(
+	const CExternalNodeForceCollection&	externalNodeForceCollection)
+{
+	bool							bTilesSlept = false;
+	scalarType						tileEnergySum[kTileCount];
+	QuantityType					tileFreeNodeCount[kTileCount];
+
+	for (IndexType tileLoop = 0; tileLoop < kTileCount; tileLoop++) {
+		tileEnergySum[tileLoop] = 0;
+		tileFreeNodeCount[tileLoop] = 0;
+	}
+
+	// Kinetic Energy = Mass x Velocity^2 / 2 (the mean is determined over the free nodes
+	// of each tile - anchor nodes never move, and would otherwise make tiles that contain
+	// them appear to be calmer than they are).
+	for (IndexType yLoop = 0; yLoop < columnNodeCount; yLoop++) {
+		for (IndexType xLoop = 0; xLoop < rowNodeCount; xLoop++) {
+			const IndexType			nodeIndex = (yLoop * rowNodeCount) + xLoop;
+			const IndexType			tileIndex = this->GetNodeTileIndex(xLoop, yLoop);
+
+			if (!this->mbIsAnchorNode[nodeIndex]) {
+				tileEnergySum[tileIndex] += (scalarType)(0.5 * this->mNodeMass) *
+					((this->mNodeVelocityX[nodeIndex] * this->mNodeVelocityX[nodeIndex]) +
+					(this->mNodeVelocityY[nodeIndex] * this->mNodeVelocityY[nodeIndex]) +
+					(this->mNodeVelocityZ[nodeIndex] * this->mNodeVelocityZ[nodeIndex]));
+				tileFreeNodeCount[tileIndex]++;
+			}
+		}
+	}
+
+	for (IndexType tileLoop = 0; tileLoop < kTileCount; tileLoop++) {
+		if (this->mbTileSleeping[tileLoop]) {
+			continue;
+		}
+
+		// (Tiles that only contain anchor nodes are always at rest.)
+		this->mTileKineticEnergy[tileLoop] = (tileFreeNodeCount[tileLoop] > 0) ?
+			(tileEnergySum[tileLoop] / (scalarType)tileFreeNodeCount[tileLoop]) : 0;
+
+		if (this->mTileKineticEnergy[tileLoop] < this->mSleepEnergyThreshold) {
+			this->mTileRestStepCount[tileLoop]++;
+		}
+		else {
+			this->mTileRestStepCount[tileLoop] = 0;
+		}
+
+		if (this->mTileRestStepCount[tileLoop] >= this->mSleepStepCount) {
+			// Stop the nodes of the tile, and retain the external force applied to the
+			// sample node (used to detect external force changes).
+			this->mbTileSleeping[tileLoop] = true;
+			this->mTileKineticEnergy[tileLoop] = 0;
+			bTilesSlept = true;
+
+			for (IndexType yLoop = 0; yLoop < columnNodeCount; yLoop++) {
+				for (IndexType xLoop = 0; xLoop < rowNodeCount; xLoop++) {
+					if (this->GetNodeTileIndex(xLoop, yLoop) == tileLoop) {
+						const IndexType	nodeIndex = (yLoop * rowNodeCount) + xLoop;
+
+						this->mNodeVelocityX[nodeIndex] = 0.0;
+						this->mNodeVelocityY[nodeIndex] = 0.0;
+						this->mNodeVelocityZ[nodeIndex] = 0.0;
+					}
+				}
+			}
+
+			if (this->mTileSampleNodeIndex[tileLoop] < kNodeCount) {
+				this->EvaluateNodeExternalForce(externalNodeForceCollection,
+					this->mTileSampleNodeIndex[tileLoop], this->mTileSampleForce[tileLoop]);
+			}
+		}
+	}
+
+	return(bTilesSlept);
+}
+
+
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+void CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::WakeTile(const IndexType tileIndex)
+{
+	if (tileIndex < kTileCount) {
+		this->mbTileSleeping[tileIndex] = false;
+		this->mTileRestStepCount[tileIndex] = 0;
+		this->mTileKineticEnergy[tileIndex] = 0;
+	}
+}
+
+
+template <QuantityType rowNodeCount, QuantityType columnNodeCount, class scalarType>
+void CFixedGridCloth<rowNodeCount, columnNodeCount, scalarType>::UpdateActiveNodeList()
+{
+	this->mActiveNodeCount = 0;
+	this->mSleepingNodeCount = 0;
+
+	for (IndexType yLoop = 0; yLoop < columnNodeCount; yLoop++) {
+		this->mbRowAwake[yLoop] = false;
+
+		for (IndexType xLoop = 0; xLoop < rowNodeCount; xLoop++) {
+			const IndexType			nodeIndex = (yLoop * rowNodeCount) + xLoop;
+
+			if (this->mbTileSleeping[this->GetNodeTileIndex(xLoop, yLoop)]) {
+				this->mSleepingNodeCount++;
+			}
+			else if (!this->mbIsAnchorNode[nodeIndex]) {
+				this->mActiveNodeIndex[this->mActiveNodeCount++] = nodeIndex;
+				this->mbRowAwake[yLoop] = true;
+			}
+		}
+	}
+}
+
+
+#endif	// #ifndef _FIXEDGRIDCLOTH_H
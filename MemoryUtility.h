@@ -9,7 +9,16 @@
 #define MemIndexType unsigned long
 #define MemSizeType	 unsigned long
 
+#include <new>								//Required for placement new.
+#include <vector>
 
+
+//Alignment (bytes) of array storage (cache line size).
+const MemSizeType					kArrayDataAlignment = 64;
+
+
+//Two-dimensional array - elements are stored in row-major order (elements with
+//successive x indices are adjacent) within a single, aligned block of memory.
 template <class elementType> class CStatic2DArray
 {
 public:
@@ -35,6 +44,17 @@ public:
 
 	//Returns the number of elements per table column.
 	MemIndexType					GetColumnSize() const;
+
+	//Retrieves a pointer to the array storage (elements are stored in row-major
+	//order).
+	elementType*					GetRawData() const;
+
+	//Returns the number of elements contained in the array storage.
+	MemSizeType						GetRawElementCount() const;
+
+	//Retrieves a pointer to the first element of a row - the row elements are
+	//contiguous.
+	elementType*					GetRowSpan(const MemIndexType yIndex) const;
 private:
 	//Allocates memory required for the array.
 	bool							AllocateArrayMemory(const MemIndexType elementsPerRow,
@@ -47,8 +67,14 @@ private:
 	//Number of elements per column ("height" of two-dimensional array).
 	const MemIndexType				mColumnSize;
 
-	//Array data (created at class instantiation time).
-	elementType**					mpArrayData;
+	//Number of elements contained in the array storage.
+	MemSizeType						mRawElementCount;
+
+	//Array data (created at class instantiation time - aligned to
+	//kArrayDataAlignment bytes).
+	elementType*					mpArrayData;
+	//Allocated memory block that contains the array data.
+	void*							mpAllocatedMemory;
 };
 
 /////
@@ -59,7 +85,8 @@ private:
 template <class elementType>
 CStatic2DArray<elementType>::CStatic2DArray(const MemIndexType elementsPerRow,
 											const MemIndexType elementsPerColumn) : mRowSize(elementsPerRow),
-											mColumnSize(elementsPerColumn), mpArrayData(NULL)
+											mColumnSize(elementsPerColumn), mRawElementCount(0),
+											mpArrayData(NULL), mpAllocatedMemory(NULL)
 {
 	//Allocate memory required for the two-dimensional array.
 	::AssertExpression(this->AllocateArrayMemory(elementsPerRow, elementsPerColumn));
@@ -90,7 +117,7 @@ elementType* CStatic2DArray<elementType>::GetElementAt(MemIndexType xIndex,
 		(xIndex < this->GetRowSize()) && (yIndex < this->GetColumnSize()))
 	{
 		//Retrieve a pointer to the data at the specified index.
-		pElementPointer = &this->mpArrayData[xIndex][yIndex];		
+		pElementPointer = &this->mpArrayData[(yIndex * this->mRowSize) + xIndex];
 	}
 
 	return(pElementPointer);
@@ -109,7 +136,7 @@ bool CStatic2DArray<elementType>::SetElementAt(const MemIndexType xIndex,
 	if (this->IsValid() && mpArrayData &&
 		(xIndex < this->GetRowSize()) && (yIndex < this->GetColumnSize()))
 	{
-		(this->mpArrayData[xIndex][yIndex]) = element;
+		(this->mpArrayData[(yIndex * this->mRowSize) + xIndex]) = element;
 
 		bElementSuccessfullySet = true;
 	}
@@ -146,6 +173,30 @@ MemIndexType CStatic2DArray<elementType>::GetColumnSize() const
 	return(columnSize);
 }
 
+template <class elementType>
+elementType* CStatic2DArray<elementType>::GetRawData() const
+{
+	return(this->mpArrayData);
+}
+
+template <class elementType>
+MemSizeType CStatic2DArray<elementType>::GetRawElementCount() const
+{
+	return(this->mRawElementCount);
+}
+
+template <class elementType>
+elementType* CStatic2DArray<elementType>::GetRowSpan(const MemIndexType yIndex) const
+{
+	elementType*					pRowSpan = NULL;
+
+	if (this->IsValid() && (yIndex < this->GetColumnSize())) {
+		pRowSpan = &this->mpArrayData[yIndex * this->mRowSize];
+	}
+
+	return(pRowSpan);
+}
+
 template <class elementType>
 bool CStatic2DArray<elementType>::AllocateArrayMemory(const MemIndexType elementsPerRow,
 		const MemIndexType elementsPerColumn)
@@ -153,16 +204,32 @@ bool CStatic2DArray<elementType>::AllocateArrayMemory(const MemIndexType element
 	bool							bAllocatedSuccessfully = false;
 
 	if((elementsPerRow > 0) && (elementsPerColumn > 0) && !this->mpArrayData) {
-		//Allocate memory for the array representation.
-		this->mpArrayData = new elementType*[elementsPerRow];
-
-		if(::AssertExpression(this->mpArrayData != NULL)) {
-			for(MemIndexType rowLoop = 0; rowLoop < elementsPerRow; rowLoop++) {
-				this->mpArrayData[rowLoop] = new elementType[elementsPerColumn];
+		//Determine the number of elements required for the array representation.
+		this->mRawElementCount = elementsPerRow * elementsPerColumn;
+
+		//Allocate memory for the array representation as a single block (additional
+		//memory is allocated in order to permit alignment of the array data).
+		this->mpAllocatedMemory = ::malloc((this->mRawElementCount * sizeof(elementType)) +
+			kArrayDataAlignment);
+
+		if(::AssertExpression(this->mpAllocatedMemory != NULL)) {
+			//(The address is converted to a pointer-sized integer - MemSizeType is
+			//narrower than a pointer on 64-bit Windows.)
+			const MemSizeType		alignmentOffset = kArrayDataAlignment -
+				(MemSizeType)((size_t)this->mpAllocatedMemory % kArrayDataAlignment);
+
+			this->mpArrayData = (elementType*)((char*)this->mpAllocatedMemory +
+				alignmentOffset);
+
+			//Construct the array elements.
+			for(MemSizeType elementLoop = 0; elementLoop < this->mRawElementCount;
+				elementLoop++)
+			{
+				new (&this->mpArrayData[elementLoop]) elementType;
 			}
-		}
 
-		bAllocatedSuccessfully = true;
+			bAllocatedSuccessfully = true;
+		}
 	}
 
 	return(bAllocatedSuccessfully);
@@ -174,18 +241,18 @@ bool CStatic2DArray<elementType>::DeAllocateArrayMemory()
 	bool							bDeallocatedSuccessfully = false;
 
 	if (this->mpArrayData) {
-
-		const MemIndexType			elementsPerRow = this->GetRowSize();
-
-		for(MemIndexType rowLoop = 0; rowLoop < elementsPerRow; rowLoop++) {
-			//Free the memory allocated for all "columns" in the two-dimensional
-			//array.
-			delete [] this->mpArrayData[rowLoop];
+		//Destroy the array elements...
+		for(MemSizeType elementLoop = 0; elementLoop < this->mRawElementCount;
+			elementLoop++)
+		{
+			this->mpArrayData[elementLoop].~elementType();
 		}
 
-		//Free the memory allocated for all "rows" in the two-dimensional
-		//array.
-		delete [] this->mpArrayData;
+		//...And free the memory allocated for the array.
+		::free(this->mpAllocatedMemory);
+
+		this->mpArrayData = NULL;
+		this->mpAllocatedMemory = NULL;
 
 		bDeallocatedSuccessfully = true;
 	}
@@ -193,4 +260,240 @@ bool CStatic2DArray<elementType>::DeAllocateArrayMemory()
 	return(bDeallocatedSuccessfully);
 }
 
+//Stores elements within a single, contiguous block of memory. The pool capacity
+//is established before elements are added - elements remain at fixed locations
+//until the pool is released, at which point all elements are destroyed at once.
+template <class elementType> class CContiguousPool
+{
+public:
+	CContiguousPool();
+	~CContiguousPool();
+
+	//Allocates storage for the specified number of elements (any existing
+	//elements are released).
+	bool							Reserve(const MemSizeType elementCapacity);
+
+	//Copies an element into the next available pool location, returning a
+	//pointer to the pool element (NULL is returned if the pool is full).
+	elementType*					Allocate(const elementType& element);
+
+	//Destroys all pool elements, and frees the pool storage.
+	void							Release();
+
+	//Retrieves a pointer to the element at the specified index.
+	elementType*					GetElementAt(const MemIndexType elementIndex) const;
+
+	//Returns the number of elements stored in the pool.
+	MemSizeType						GetElementCount() const;
+
+	//Returns the maximum number of elements that can be stored in the pool.
+	MemSizeType						GetCapacity() const;
+private:
+	//Pools cannot be copied (elements are referenced by location).
+	CContiguousPool(const CContiguousPool& contiguousPool);
+	CContiguousPool&				operator=(const CContiguousPool& contiguousPool);
+
+	//Pool storage.
+	elementType*					mpPoolData;
+
+	//Number of elements stored in the pool.
+	MemSizeType						mElementCount;
+
+	//Maximum number of elements that can be stored in the pool.
+	MemSizeType						mCapacity;
+};
+
+/////
+// CContiguousPool
+/////
+
+// Template class - implementation must exist in header file.
+template <class elementType>
+CContiguousPool<elementType>::CContiguousPool() : mpPoolData(NULL), mElementCount(0),
+	mCapacity(0)
+{
+
+}
+
+template <class elementType>
+CContiguousPool<elementType>::~CContiguousPool()
+{
+	//Destroy the pool elements.
+	this->Release();
+}
+
+template <class elementType>
+bool CContiguousPool<elementType>::Reserve(const MemSizeType elementCapacity)
+{
+	bool							bReservedSuccessfully = false;
+
+	this->Release();
+
+	if (elementCapacity > 0) {
+		//Allocate uninitialized storage (elements are constructed as they are
+		//added to the pool).
+		this->mpPoolData = (elementType*)::malloc(elementCapacity * sizeof(elementType));
+
+		if (::AssertExpression(this->mpPoolData != NULL)) {
+			this->mCapacity = elementCapacity;
+
+			bReservedSuccessfully = true;
+		}
+	}
+
+	return(bReservedSuccessfully);
+}
+
+template <class elementType>
+elementType* CContiguousPool<elementType>::Allocate(const elementType& element)
+{
+	elementType*					pPoolElement = NULL;
+
+	if (this->mpPoolData && (this->mElementCount < this->mCapacity)) {
+		pPoolElement = new (&this->mpPoolData[this->mElementCount]) elementType(element);
+
+		this->mElementCount++;
+	}
+
+	return(pPoolElement);
+}
+
+template <class elementType>
+void CContiguousPool<elementType>::Release()
+{
+	if (this->mpPoolData) {
+		//Destroy the elements in the pool...
+		for (MemSizeType elementLoop = 0; elementLoop < this->mElementCount; elementLoop++) {
+			this->mpPoolData[elementLoop].~elementType();
+		}
+
+		//...And free the pool storage.
+		::free(this->mpPoolData);
+	}
+
+	this->mpPoolData = NULL;
+	this->mElementCount = 0;
+	this->mCapacity = 0;
+}
+
+template <class elementType>
+elementType* CContiguousPool<elementType>::GetElementAt(const MemIndexType elementIndex) const
+{
+	elementType*					pPoolElement = NULL;
+
+	if (elementIndex < this->mElementCount) {
+		pPoolElement = &this->mpPoolData[elementIndex];
+	}
+
+	return(pPoolElement);
+}
+
+template <class elementType>
+MemSizeType CContiguousPool<elementType>::GetElementCount() const
+{
+	return(this->mElementCount);
+}
+
+template <class elementType>
+MemSizeType CContiguousPool<elementType>::GetCapacity() const
+{
+	return(this->mCapacity);
+}
+
+
+
+//Read-only view of a contiguous sequence of elements that are owned by another object (e.g. a
+//std::vector) - the view does not copy the elements, and remains valid only while the owning
+//object is not modified.
+template <class elementType> class CConstArrayView
+{
+public:
+	//Constant element iterator type.
+	typedef const elementType*		ConstIterator;
+
+	CConstArrayView();
+	CConstArrayView(const elementType* pElements, const MemSizeType elementCount);
+	CConstArrayView(const std::vector<elementType>& elementVector);
+
+	//Returns an iterator that references the first element.
+	ConstIterator					begin() const;
+
+	//Returns an iterator that references the location after the last element.
+	ConstIterator					end() const;
+
+	//Returns the number of elements within the view.
+	MemSizeType						size() const;
+
+	//Determines if the view contains no elements.
+	bool							empty() const;
+
+	//Retrieves the element at the specified index (the index must be less than the
+	//number of elements within the view).
+	const elementType&				operator[](const MemIndexType elementIndex) const;
+
+private:
+	//First element within the view.
+	const elementType*				mpElements;
+
+	//Number of elements within the view.
+	MemSizeType						mElementCount;
+};
+
+/////
+// CConstArrayView
+/////
+
+// Template class - implementation must exist in header file.
+template <class elementType>
+CConstArrayView<elementType>::CConstArrayView() : mpElements(NULL), mElementCount(0)
+{
+
+}
+
+template <class elementType>
+CConstArrayView<elementType>::CConstArrayView(const elementType* pElements,
+											  const MemSizeType elementCount) :
+	mpElements(pElements), mElementCount(pElements ? elementCount : 0)
+{
+
+}
+
+template <class elementType>
+CConstArrayView<elementType>::CConstArrayView(const std::vector<elementType>& elementVector) :
+	mpElements(elementVector.empty() ? NULL : &elementVector[0]),
+	mElementCount(elementVector.size())
+{
+
+}
+
+template <class elementType>
+typename CConstArrayView<elementType>::ConstIterator CConstArrayView<elementType>::begin() const
+{
+	return(this->mpElements);
+}
+
+template <class elementType>
+typename CConstArrayView<elementType>::ConstIterator CConstArrayView<elementType>::end() const
+{
+	return(this->mpElements + this->mElementCount);
+}
+
+template <class elementType>
+MemSizeType CConstArrayView<elementType>::size() const
+{
+	return(this->mElementCount);
+}
+
+template <class elementType>
+bool CConstArrayView<elementType>::empty() const
+{
+	return(this->mElementCount == 0);
+}
+
+template <class elementType>
+const elementType& CConstArrayView<elementType>::operator[](const MemIndexType elementIndex) const
+{
+	return(this->mpElements[elementIndex]);
+}
+
 #endif	//#ifndef _MEMORYUTILITY_H
\ No newline at end of file
@@ -35,6 +35,22 @@ bool CStaticMeshBase::SetModelGeometry(const PolygonList& polygonList)
 	return(bModelGeometrySet);
 }
 
+
+bool CStaticMeshBase::AdoptModelGeometry(PolygonList& polygonList)
+{
+	bool							bModelGeometrySet = false;
+
+	if(!polygonList.empty()) {
+		//Exchange the polygon lists, and release the previous geometry.
+		this->mPolygonList.swap(polygonList);
+		PolygonList().swap(polygonList);
+
+		bModelGeometrySet = true;
+	}
+
+	return(bModelGeometrySet);
+}
+
 bool CStaticMeshBase::SetModelTexture(const CTextureCollection& modelTexture)
 {
 	bool							bModelTextureSet = false;
@@ -50,6 +66,22 @@ bool CStaticMeshBase::SetModelTexture(const CTextureCollection& modelTexture)
 }
 
 
+bool CStaticMeshBase::AdoptModelTexture(CTextureCollection& modelTexture)
+{
+	bool							bModelTextureSet = false;
+
+	if (modelTexture.GetNumTextureLayers() > 0) {
+		// Exchange the texture layers, and release the previous texture.
+		this->mModelTexture.SwapTextureLayers(modelTexture);
+		CTextureCollection().SwapTextureLayers(modelTexture);
+
+		bModelTextureSet = true;
+	}
+
+	return(bModelTextureSet);
+}
+
+
 const CTextureCollection& CStaticMeshBase::GetTextureCollection() const
 {
 	// Return the collection of textures.
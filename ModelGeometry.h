@@ -19,14 +19,31 @@ public:
 	//Stores geometry in the internal polygon list.
 	bool							SetModelGeometry(const PolygonList& polygonList);
 
+	//Stores geometry in the internal polygon list by exchanging the list contents (the
+	//polygons are not copied, and the provided list is left empty).
+	bool							AdoptModelGeometry(PolygonList& polygonList);
+
 	//Sets the texture that is to be used for the model.
 	bool							SetModelTexture(const CTextureCollection& modelTexture);
 
+	//Sets the texture that is to be used for the model by exchanging the texture layers
+	//(the texture data is not copied, and the provided collection is left empty).
+	bool							AdoptModelTexture(CTextureCollection& modelTexture);
+
 	//Retrieves the textures associated with the model.
 	const CTextureCollection&		GetTextureCollection() const;
 
-	//!!!Temporary...
-	PolygonList						GetPolygonList() const { return(this->mPolygonList); }
+	//Construct that provides read-only access to the polygons without copying them.
+	typedef CConstArrayView<CFloatPolygon>
+									PolygonView;
+
+	//Retrieves the internal polygon list (the reference remains valid until the model
+	//geometry is modified or the mesh is destroyed).
+	const PolygonList&				GetPolygonList() const { return(this->mPolygonList); }
+
+	//Retrieves a read-only view of the internal polygons (the view remains valid until the
+	//model geometry is modified or the mesh is destroyed).
+	PolygonView						GetPolygonView() const { return(PolygonView(this->mPolygonList)); }
 
 protected:
 	PolygonList						mPolygonList;
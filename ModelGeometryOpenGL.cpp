@@ -1,4 +1,5 @@
 #include "ModelGeometryOpenGL.h"
+#include <algorithm>
 
 
 #if _DEBUG
@@ -7,6 +8,170 @@
 #define RENDER_VERTEX_NORMALS 0
 #endif	//#if _DEBUG
 
+
+//Material state of a polygon (basic lighting model colors and specular exponent) -
+//polygons are grouped by material state when display lists are generated.
+class CPolygonMaterialState
+{
+public:
+	CPolygonMaterialState(const CFloatPolygon& polygon)
+	{
+		const ScalarType			kMaxSpecularExponent = 128.0;
+
+		this->StoreMaterialColor(polygon.GetLightShading(eShadeAmbient), kAmbientIndex);
+		this->StoreMaterialColor(polygon.GetLightShading(eShadeDiffuse), kDiffuseIndex);
+		this->StoreMaterialColor(polygon.GetLightShading(eShadeEmissive), kEmissiveIndex);
+		this->StoreMaterialColor(polygon.GetLightShading(eShadeSpecular), kSpecularIndex);
+
+		this->mMaterialValue[kSpecularExponentIndex] =
+			(GLfloat)(kMaxSpecularExponent * polygon.GetSpecularity());
+	}
+
+	//Orders material states (lexicographically, by material value).
+	bool							IsOrderedBefore(const CPolygonMaterialState&
+		materialState) const
+	{
+		IndexType					valueIndex = 0;
+
+		while ((valueIndex < (kMaterialValueCount - 1)) &&
+			(this->mMaterialValue[valueIndex] == materialState.mMaterialValue[valueIndex]))
+		{
+			valueIndex++;
+		}
+
+		return(this->mMaterialValue[valueIndex] < materialState.mMaterialValue[valueIndex]);
+	}
+
+	//Determines if two material states are identical.
+	bool							IsEquivalent(const CPolygonMaterialState&
+		materialState) const
+	{
+		return(!this->IsOrderedBefore(materialState) && !materialState.IsOrderedBefore(*this));
+	}
+
+	//Sets the current OpenGL material properties.
+	void							ApplyMaterialState() const
+	{
+		::glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, &this->mMaterialValue[kAmbientIndex]);
+		::glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, &this->mMaterialValue[kDiffuseIndex]);
+		::glMaterialfv(GL_FRONT_AND_BACK, GL_EMISSION, &this->mMaterialValue[kEmissiveIndex]);
+		::glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, &this->mMaterialValue[kSpecularIndex]);
+		::glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS,
+			this->mMaterialValue[kSpecularExponentIndex]);
+	}
+
+protected:
+	//Material value layout - four components (RGBA) for each color, followed by the
+	//specular exponent.
+	enum {
+		kAmbientIndex = 0,
+		kDiffuseIndex = 4,
+		kEmissiveIndex = 8,
+		kSpecularIndex = 12,
+		kSpecularExponentIndex = 16,
+		kMaterialValueCount = 17
+	};
+
+	//Stores a material color at the specified material value index (material colors
+	//are opaque).
+	void							StoreMaterialColor(const CFloatColor& materialColor,
+		const IndexType valueIndex)
+	{
+		this->mMaterialValue[valueIndex] = (GLfloat)materialColor.GetRedValue();
+		this->mMaterialValue[valueIndex + 1] = (GLfloat)materialColor.GetGreenValue();
+		this->mMaterialValue[valueIndex + 2] = (GLfloat)materialColor.GetBlueValue();
+		this->mMaterialValue[valueIndex + 3] = 1.0f;
+	}
+
+	//Material values.
+	GLfloat							mMaterialValue[kMaterialValueCount];
+};
+
+
+//Orders polygon indices by the material states of the indexed polygons.
+class CPolygonMaterialOrder
+{
+public:
+	CPolygonMaterialOrder(const std::vector<CPolygonMaterialState>& polygonMaterialStates) :
+		mPolygonMaterialStates(polygonMaterialStates)
+	{
+
+	}
+
+	bool							operator()(const IndexType firstPolygonIndex,
+		const IndexType secondPolygonIndex) const
+	{
+		return(this->mPolygonMaterialStates[firstPolygonIndex].IsOrderedBefore(
+			this->mPolygonMaterialStates[secondPolygonIndex]));
+	}
+
+protected:
+	const std::vector<CPolygonMaterialState>&
+									mPolygonMaterialStates;
+};
+
+
+//Adds the vertices of a polygon (color, normal, texture coordinates and location) to the
+//current OpenGL primitive.
+static void AddPolygonVertices(const CFloatPolygon& polygon)
+{
+	const CFloatPolygon::VertexList&	vertexList = polygon.GetVertexList();
+
+	for(CFloatPolygon::VertexList::const_iterator vertexListIterator = vertexList.begin();
+		vertexListIterator != vertexList.end(); vertexListIterator++)
+	{
+		//Retrieve the vertex normal.
+		CVector						vertexNormal = vertexListIterator->GetNormal();
+
+		//Store the color/alpha information.
+		CFloatColor					vertexColor = vertexListIterator->GetColor();
+		::glColor4d(vertexColor.GetRedValue(), vertexColor.GetGreenValue(),
+			vertexColor.GetBlueValue(), vertexColor.GetAlphaValue());
+		//Store the normal.
+		::glNormal3d(vertexNormal.GetXComponent(), vertexNormal.GetYComponent(),
+			vertexNormal.GetZComponent());
+
+		//Texture coordinates
+		ScalarType					uTextureCoordinate = 0.0;
+		ScalarType					vTextureCoordinate = 0.0;
+		vertexListIterator->GetTextureCoordinates(uTextureCoordinate, vTextureCoordinate);
+		::glTexCoord2f(uTextureCoordinate, vTextureCoordinate);
+
+		//Store the vertex coordinates.
+		::glVertex3d(vertexListIterator->GetXCoord(), 
+			vertexListIterator->GetYCoord(),
+			vertexListIterator->GetZCoord());
+	}
+}
+
+
+//Adds all polygons with the specified number of vertices, within a range of ordered
+//polygons, to the current display list as a single OpenGL primitive batch.
+static void AddPolygonBatch(const PolygonList& polygonList,
+							const std::vector<IndexType>& polygonOrder,
+							const IndexType firstOrderIndex, const IndexType endOrderIndex,
+							const QuantityType vertexCount, const GLenum primitiveMode)
+{
+	bool							bBatchStarted = false;
+
+	for (IndexType orderLoop = firstOrderIndex; orderLoop < endOrderIndex; orderLoop++) {
+		const CFloatPolygon&		currentPolygon = polygonList[polygonOrder[orderLoop]];
+
+		if (currentPolygon.GetVertexCount() == vertexCount) {
+			if (!bBatchStarted) {
+				::glBegin(primitiveMode);
+				bBatchStarted = true;
+			}
+
+			AddPolygonVertices(currentPolygon);
+		}
+	}
+
+	if (bBatchStarted) {
+		::glEnd();
+	}
+}
+
 COpenGLStaticMesh::COpenGLStaticMesh(const CStaticMeshBase& staticMesh) :
 	mModelReferenceOrigin(0.0, 0.0, 0.0), mDisplayListReference(0),
 		mbDisplayListReferenceSet(false)
@@ -99,8 +264,8 @@ bool COpenGLStaticMesh::GenerateDisplayListFromMesh(const CStaticMeshBase& stati
 	bool							bListGeneratedSuccessfully = false;
 
 
-	//Obtain a list of polygons from the mesh...
-	PolygonList						meshPolyList = staticMesh.GetPolygonList();	
+	//Obtain a list of polygons from the mesh (the polygons are not copied)...
+	const PolygonList&				meshPolyList = staticMesh.GetPolygonList();
 
 	if (!meshPolyList.empty()) {
 		//Number of display lists to generate.
@@ -144,81 +309,73 @@ bool COpenGLStaticMesh::GenerateDisplayListFromMesh(const CStaticMeshBase& stati
 			::glBindTexture(GL_TEXTURE_2D, textureID);
 		}
 
-		//Iterate through the list of mesh polygons, adding the polygons
-		//to the created OpenGL display list.
-		for(PolygonList::iterator polylistIterator = meshPolyList.begin();
+		//Group the polygons by material state (the material is specified once for each
+		//group of polygons, rather than for each vertex).
+		const QuantityType			polygonCount = meshPolyList.size();
+
+		std::vector<CPolygonMaterialState>
+									polygonMaterialStates;
+		std::vector<IndexType>		polygonOrder(polygonCount);
+
+		polygonMaterialStates.reserve(polygonCount);
+
+		for (IndexType polygonLoop = 0; polygonLoop < polygonCount; polygonLoop++) {
+			polygonMaterialStates.push_back(CPolygonMaterialState(meshPolyList[polygonLoop]));
+			polygonOrder[polygonLoop] = polygonLoop;
+		}
+
+		std::stable_sort(polygonOrder.begin(), polygonOrder.end(),
+			CPolygonMaterialOrder(polygonMaterialStates));
+
+		//Add each material group to the created OpenGL display list - triangles and
+		//quadrilaterals within a group are each drawn as a single batch.
+		IndexType					groupStartIndex = 0;
+
+		while (groupStartIndex < polygonCount) {
+			const CPolygonMaterialState&
+									groupMaterialState =
+									polygonMaterialStates[polygonOrder[groupStartIndex]];
+
+			IndexType				groupEndIndex = groupStartIndex + 1;
+
+			while ((groupEndIndex < polygonCount) && groupMaterialState.IsEquivalent(
+				polygonMaterialStates[polygonOrder[groupEndIndex]]))
+			{
+				groupEndIndex++;
+			}
+
+			groupMaterialState.ApplyMaterialState();
+
+			AddPolygonBatch(meshPolyList, polygonOrder, groupStartIndex, groupEndIndex, 3,
+				GL_TRIANGLES);
+			AddPolygonBatch(meshPolyList, polygonOrder, groupStartIndex, groupEndIndex, 4,
+				GL_QUADS);
+
+			//Polygons with more than four vertices are drawn individually.
+			for (IndexType polygonLoop = groupStartIndex; polygonLoop < groupEndIndex;
+				polygonLoop++)
+			{
+				const CFloatPolygon&	currentPolygon = meshPolyList[polygonOrder[polygonLoop]];
+
+				if (currentPolygon.GetVertexCount() > 4) {
+					::glBegin(GL_POLYGON);
+					AddPolygonVertices(currentPolygon);
+					::glEnd();
+				}
+			}
+
+			groupStartIndex = groupEndIndex;
+		}
+
+	#if RENDER_VERTEX_NORMALS
+		for(PolygonList::const_iterator polylistIterator = meshPolyList.begin();
 			polylistIterator != meshPolyList.end(); polylistIterator++)
 		{
 			//Obtain the vertex list from the current polygon...
-			CFloatPolygon::VertexList	
+			const CFloatPolygon::VertexList&
 									vertexList  = polylistIterator->GetVertexList();
 
-			//Create an OpenGl polygon.
-			::glBegin(GL_POLYGON);
-			for(CFloatPolygon::VertexList::iterator vertexListIterator = vertexList.begin();
-				vertexListIterator != vertexList.end(); vertexListIterator++)
-			{
-				//Set the material properties (basic lighting model interactions -
-				//ambient, diffuse, specular, emissive) for the polygon..
-
-				const ScalarType	kMaxSpecularExponent = 128.0;
-
-				//Ambient color.
-				CFloatColor			ambientColor =
-					polylistIterator->GetLightShading(eShadeAmbient);
-				GLfloat				ambientMaterial[] = { ambientColor.GetRedValue(),
-					ambientColor.GetGreenValue(), ambientColor.GetBlueValue(), 1.0 };
-				glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, ambientMaterial);
-
-				//Diffuse color.
-				CFloatColor			diffuseColor =
-					polylistIterator->GetLightShading(eShadeDiffuse);
-				GLfloat				diffuseMaterial[] = { diffuseColor.GetRedValue(),
-					diffuseColor.GetGreenValue(), diffuseColor.GetBlueValue(), 1.0 };
-				glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, diffuseMaterial);
-
-				//Emissive color.
-				CFloatColor			emissiveColor =
-					polylistIterator->GetLightShading(eShadeEmissive);
-				GLfloat				emissiveMaterial[] = { emissiveColor.GetRedValue(),
-					emissiveColor.GetGreenValue(), emissiveColor.GetBlueValue(), 1.0 };
-				glMaterialfv(GL_FRONT_AND_BACK, GL_EMISSION, emissiveMaterial);			
-
-				//Specular color.
-				CFloatColor			specularColor =
-					polylistIterator->GetLightShading(eShadeSpecular);
-				GLfloat				specularMaterial[] = { specularColor.GetRedValue(), 
-					specularColor.GetGreenValue(), specularColor.GetBlueValue(), 1.0 };
-				glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, specularMaterial);
-				glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS,
-					kMaxSpecularExponent * polylistIterator->GetSpecularity());
-				
-				//Retrieve the vertex normal.
-				CVector				vertexNormal = vertexListIterator->GetNormal();
-
-				//Store the color/alpha information.
-				CFloatColor			vertexColor = vertexListIterator->GetColor();
-				::glColor4d(vertexColor.GetRedValue(), vertexColor.GetGreenValue(),
-					vertexColor.GetBlueValue(), vertexColor.GetAlphaValue());
-				//Store the normal.
-				::glNormal3d(vertexNormal.GetXComponent(), vertexNormal.GetYComponent(),
-					vertexNormal.GetZComponent());
-
-				//Texture coordinates
-				ScalarType			uTextureCoordinate = 0.0;
-				ScalarType			vTextureCoordinate = 0.0;
-				vertexListIterator->GetTextureCoordinates(uTextureCoordinate, vTextureCoordinate);
-				::glTexCoord2f(uTextureCoordinate, vTextureCoordinate);
-
-				//Store the vertex coordinates.
-				::glVertex3d(vertexListIterator->GetXCoord(), 
-					vertexListIterator->GetYCoord(),
-					vertexListIterator->GetZCoord());
-			}
-			::glEnd();
-
-		#if RENDER_VERTEX_NORMALS
-			for(CFloatPolygon::VertexList::iterator vertexNormIterator = vertexList.begin();
+			for(CFloatPolygon::VertexList::const_iterator vertexNormIterator = vertexList.begin();
 				vertexNormIterator != vertexList.end(); vertexNormIterator++)
 			{
 				//Retrieve the vertex normal.
@@ -233,8 +390,8 @@ bool COpenGLStaticMesh::GenerateDisplayListFromMesh(const CStaticMeshBase& stati
 					vertexNormIterator->GetZCoord() + vertexNormal.GetZComponent());
 				::glEnd();
 			}
-		#endif	//#if RENDER_VERTEX_NORMALS
 		}
+	#endif	//#if RENDER_VERTEX_NORMALS
 
 		// Unbind any texture objects.
 		::glBindTexture(GL_TEXTURE_2D, 0);
@@ -326,4 +483,412 @@ bool COpenGLStaticMesh::ReleaseTextureLayers()
 	}
 
 	return(bTextureLayersReleased);
-}
\ No newline at end of file
+}
+
+
+/////
+// CTextureUploadCounters class
+/////
+CTextureUploadCounters::CTextureUploadCounters() : mUploadCount(0), mUploadByteCount(0),
+	mAllocationCount(0)
+{
+
+}
+
+
+/////
+// COpenGLGridMesh class
+/////
+COpenGLGridMesh::COpenGLGridMesh(const QuantityType verticesPerRow,
+								 const QuantityType verticesPerColumn) :
+	mVerticesPerRow(verticesPerRow), mVerticesPerColumn(verticesPerColumn),
+	mMeshBaseColor(kMaxColorComponentValue, kMaxColorComponentValue, kMaxColorComponentValue),
+	mMeshSpecularity(0.0), mTextureReference(0), mbTextureReferenceSet(false),
+	mTextureWidth(0), mTextureHeight(0), mTextureImageRevision(0), mbTextureImageSet(false),
+	mNextPixelBufferIndex(0), mbPixelBuffersCreated(false), mStreamVertexBufferReference(0),
+	mStaticVertexBufferReference(0), mIndexBufferReference(0), mbBufferObjectsCreated(false)
+{
+	if (this->IsValid()) {
+		// Allocate the vertex arrays (flat, facing the positive z-axis, until the
+		// vertices are first overwritten).
+		const QuantityType			vertexCount = this->GetVertexCount();
+
+		this->mVertexLocation.resize(vertexCount * 3, 0.0f);
+		this->mVertexNormal.resize(vertexCount * 3, 0.0f);
+
+		for (IndexType vertexLoop = 0; vertexLoop < vertexCount; vertexLoop++) {
+			this->mVertexNormal[(vertexLoop * 3) + 2] = 1.0f;
+		}
+
+		this->GenerateGridTopology();
+		this->CreateTextureObject();
+
+#if OPENGL_BUFFER_OBJECTS
+		this->CreateBufferObjects();
+
+#if OPENGL_PIXEL_BUFFER_UPLOAD
+		this->CreatePixelBufferObjects();
+#endif	// #if OPENGL_PIXEL_BUFFER_UPLOAD
+#endif	// #if OPENGL_BUFFER_OBJECTS
+	}
+}
+
+COpenGLGridMesh::~COpenGLGridMesh()
+{
+	// Release the texture object...
+	if (this->mbTextureReferenceSet) {
+		::glDeleteTextures(1, &this->mTextureReference);
+	}
+
+	// ...And the buffer objects.
+	if (this->mbBufferObjectsCreated) {
+		const GLuint				bufferReferences[] = { this->mStreamVertexBufferReference,
+			this->mStaticVertexBufferReference, this->mIndexBufferReference };
+
+		NOpenGLExtensions::DeleteBuffers(3, bufferReferences);
+	}
+
+	if (this->mbPixelBuffersCreated) {
+		NOpenGLExtensions::DeleteBuffers(kPixelBufferCount, this->mPixelBufferReference);
+	}
+}
+
+
+bool COpenGLGridMesh::IsValid() const
+{
+	return((this->mVerticesPerRow > 1) && (this->mVerticesPerColumn > 1));
+}
+
+
+QuantityType COpenGLGridMesh::GetVertexCount() const
+{
+	return(this->mVerticesPerRow * this->mVerticesPerColumn);
+}
+
+
+GLfloat* COpenGLGridMesh::GetVertexLocationArray()
+{
+	return(this->mVertexLocation.empty() ? NULL : &this->mVertexLocation[0]);
+}
+
+
+GLfloat* COpenGLGridMesh::GetVertexNormalArray()
+{
+	return(this->mVertexNormal.empty() ? NULL : &this->mVertexNormal[0]);
+}
+
+
+void COpenGLGridMesh::SetMeshMaterial(const CFloatColor& baseColor,
+									  const ScalarType specularity)
+{
+	this->mMeshBaseColor = baseColor;
+	this->mMeshSpecularity = specularity;
+}
+
+
+bool COpenGLGridMesh::SetTextureImage(const QuantityType textureWidth,
+									  const QuantityType textureHeight,
+									  const void* pTextureData,
+									  const QuantityType imageRevision)
+{
+	bool							bImageSetSuccessfully = false;
+
+	if (this->mbTextureReferenceSet && pTextureData && (textureWidth > 0) &&
+		(textureHeight > 0))
+	{
+		// Size of the image (four bytes per texel).
+		const QuantityType			kBytesPerTexel = 4;
+		const QuantityType			imageByteCount = textureWidth * textureHeight *
+			kBytesPerTexel;
+
+		::glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+		::glBindTexture(GL_TEXTURE_2D, this->mTextureReference);
+
+		// Allocate the texture storage if the dimensions have changed...
+		if ((textureWidth != this->mTextureWidth) || (textureHeight != this->mTextureHeight)) {
+			::glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, textureWidth, textureHeight, 0, GL_RGBA,
+				GL_UNSIGNED_BYTE, NULL);
+
+			this->mTextureWidth = textureWidth;
+			this->mTextureHeight = textureHeight;
+
+			this->mTextureUploadCounters.mAllocationCount++;
+		}
+
+		// ...And overwrite the storage with the image.
+		if (this->mbPixelBuffersCreated) {
+			// The image is copied into a pixel buffer, from which the texture is updated
+			// asynchronously (the buffer storage is respecified first, so that the copy
+			// does not wait for an upload that sources the previous contents).
+			NOpenGLExtensions::BindBuffer(GL_PIXEL_UNPACK_BUFFER,
+				this->mPixelBufferReference[this->mNextPixelBufferIndex]);
+			NOpenGLExtensions::BufferData(GL_PIXEL_UNPACK_BUFFER,
+				(OpenGLBufferSizeType)imageByteCount, NULL, GL_STREAM_DRAW);
+			NOpenGLExtensions::BufferSubData(GL_PIXEL_UNPACK_BUFFER, 0,
+				(OpenGLBufferSizeType)imageByteCount, pTextureData);
+
+			::glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, textureWidth, textureHeight, GL_RGBA,
+				GL_UNSIGNED_BYTE, NULL);
+
+			NOpenGLExtensions::BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+			this->mNextPixelBufferIndex = (this->mNextPixelBufferIndex + 1) % kPixelBufferCount;
+		}
+		else {
+			::glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, textureWidth, textureHeight, GL_RGBA,
+				GL_UNSIGNED_BYTE, pTextureData);
+		}
+
+		::glBindTexture(GL_TEXTURE_2D, 0);
+
+		this->mTextureImageRevision = imageRevision;
+		this->mbTextureImageSet = true;
+
+		this->mTextureUploadCounters.mUploadCount++;
+		this->mTextureUploadCounters.mUploadByteCount += imageByteCount;
+
+		bImageSetSuccessfully = true;
+	}
+
+	return(bImageSetSuccessfully);
+}
+
+
+bool COpenGLGridMesh::IsTextureImageCurrent(const QuantityType imageRevision) const
+{
+	return(this->mbTextureImageSet && (this->mTextureImageRevision == imageRevision));
+}
+
+
+const CTextureUploadCounters& COpenGLGridMesh::GetTextureUploadCounters() const
+{
+	return(this->mTextureUploadCounters);
+}
+
+
+void COpenGLGridMesh::ResetTextureUploadCounters()
+{
+	this->mTextureUploadCounters = CTextureUploadCounters();
+}
+
+
+bool COpenGLGridMesh::RenderMesh() const
+{
+	bool							bMeshRenderSuccessful = false;
+
+	if (this->IsValid()) {
+		// Set the material properties (basic lighting model interactions - the mesh
+		// has no ambient or emissive contribution).
+		const ScalarType			kMaxSpecularExponent = 128.0;
+
+		GLfloat						ambientMaterial[] = { 0.0, 0.0, 0.0, 1.0 };
+		GLfloat						diffuseMaterial[] = {
+			(GLfloat)this->mMeshBaseColor.GetRedValue(),
+			(GLfloat)this->mMeshBaseColor.GetGreenValue(),
+			(GLfloat)this->mMeshBaseColor.GetBlueValue(), 1.0 };
+		GLfloat						emissiveMaterial[] = { 0.0, 0.0, 0.0, 1.0 };
+
+		::glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, ambientMaterial);
+		::glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, diffuseMaterial);
+		::glMaterialfv(GL_FRONT_AND_BACK, GL_EMISSION, emissiveMaterial);
+		::glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, diffuseMaterial);
+		::glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS,
+			kMaxSpecularExponent * this->mMeshSpecularity);
+
+		::glColor4d(this->mMeshBaseColor.GetRedValue(), this->mMeshBaseColor.GetGreenValue(),
+			this->mMeshBaseColor.GetBlueValue(), this->mMeshBaseColor.GetAlphaValue());
+
+		if (this->mbTextureReferenceSet) {
+			::glBindTexture(GL_TEXTURE_2D, this->mTextureReference);
+		}
+
+		// Render all triangles with a single draw call.
+		::glEnableClientState(GL_VERTEX_ARRAY);
+		::glEnableClientState(GL_NORMAL_ARRAY);
+		::glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+
+		this->BindVertexArrays();
+
+		if (this->mbBufferObjectsCreated) {
+			NOpenGLExtensions::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->mIndexBufferReference);
+
+			::glDrawElements(GL_TRIANGLES, (GLsizei)this->mTriangleIndex.size(),
+				GL_UNSIGNED_INT, NULL);
+
+			NOpenGLExtensions::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+			NOpenGLExtensions::BindBuffer(GL_ARRAY_BUFFER, 0);
+		}
+		else {
+			::glDrawElements(GL_TRIANGLES, (GLsizei)this->mTriangleIndex.size(),
+				GL_UNSIGNED_INT, &this->mTriangleIndex[0]);
+		}
+
+		::glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+		::glDisableClientState(GL_NORMAL_ARRAY);
+		::glDisableClientState(GL_VERTEX_ARRAY);
+
+		// Unbind any texture objects.
+		::glBindTexture(GL_TEXTURE_2D, 0);
+
+		bMeshRenderSuccessful = true;
+	}
+
+	return(bMeshRenderSuccessful);
+}
+
+
+bool COpenGLGridMesh::UsesBufferObjects() const
+{
+	return(this->mbBufferObjectsCreated);
+}
+
+
+void COpenGLGridMesh::GenerateGridTopology()
+{
+	const QuantityType				verticesPerRow = this->mVerticesPerRow;
+	const QuantityType				verticesPerColumn = this->mVerticesPerColumn;
+
+	// Texture coordinates span the texture across the grid.
+	this->mVertexTextureCoord.resize(this->GetVertexCount() * 2);
+
+	for (IndexType yLoop = 0; yLoop < verticesPerColumn; yLoop++) {
+		for (IndexType xLoop = 0; xLoop < verticesPerRow; xLoop++) {
+			const IndexType			vertexIndex = (yLoop * verticesPerRow) + xLoop;
+
+			this->mVertexTextureCoord[(vertexIndex * 2)] =
+				(GLfloat)((ScalarType)xLoop / (ScalarType)(verticesPerRow - 1));
+			this->mVertexTextureCoord[(vertexIndex * 2) + 1] =
+				(GLfloat)((ScalarType)yLoop / (ScalarType)(verticesPerColumn - 1));
+		}
+	}
+
+	// Each grid cell is divided into two triangles along the diagonal from the upper
+	// left vertex to the lower right vertex.
+	this->mTriangleIndex.clear();
+	this->mTriangleIndex.reserve((verticesPerRow - 1) * (verticesPerColumn - 1) * 6);
+
+	for (IndexType cellYLoop = 0; cellYLoop < (verticesPerColumn - 1); cellYLoop++) {
+		for (IndexType cellXLoop = 0; cellXLoop < (verticesPerRow - 1); cellXLoop++) {
+			const GLuint			upperLeftIndex = (GLuint)((cellYLoop * verticesPerRow) +
+				cellXLoop);
+			const GLuint			upperRightIndex = upperLeftIndex + 1;
+			const GLuint			lowerLeftIndex = upperLeftIndex + (GLuint)verticesPerRow;
+			const GLuint			lowerRightIndex = lowerLeftIndex + 1;
+
+			this->mTriangleIndex.push_back(upperLeftIndex);
+			this->mTriangleIndex.push_back(lowerRightIndex);
+			this->mTriangleIndex.push_back(lowerLeftIndex);
+
+			this->mTriangleIndex.push_back(upperLeftIndex);
+			this->mTriangleIndex.push_back(upperRightIndex);
+			this->mTriangleIndex.push_back(lowerRightIndex);
+		}
+	}
+}
+
+
+bool COpenGLGridMesh::CreateTextureObject()
+{
+	::glGenTextures(1, &this->mTextureReference);
+
+	::glBindTexture(GL_TEXTURE_2D, this->mTextureReference);
+
+	::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+	::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+	::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+
+	::glBindTexture(GL_TEXTURE_2D, 0);
+
+	this->mbTextureReferenceSet = true;
+
+	return(this->mbTextureReferenceSet);
+}
+
+
+bool COpenGLGridMesh::CreateBufferObjects()
+{
+	if (!this->mbBufferObjectsCreated && NOpenGLExtensions::LoadBufferObjectFunctions()) {
+		GLuint						bufferReferences[3] = { 0, 0, 0 };
+
+		NOpenGLExtensions::GenBuffers(3, bufferReferences);
+
+		this->mStreamVertexBufferReference = bufferReferences[0];
+		this->mStaticVertexBufferReference = bufferReferences[1];
+		this->mIndexBufferReference = bufferReferences[2];
+
+		// Allocate the streamed buffer (the contents are specified whenever the mesh is
+		// rendered)...
+		NOpenGLExtensions::BindBuffer(GL_ARRAY_BUFFER, this->mStreamVertexBufferReference);
+		NOpenGLExtensions::BufferData(GL_ARRAY_BUFFER, (OpenGLBufferSizeType)(
+			(this->mVertexLocation.size() + this->mVertexNormal.size()) * sizeof(GLfloat)),
+			NULL, GL_STREAM_DRAW);
+
+		// ...And store the texture coordinates and triangle indices, which do not change.
+		NOpenGLExtensions::BindBuffer(GL_ARRAY_BUFFER, this->mStaticVertexBufferReference);
+		NOpenGLExtensions::BufferData(GL_ARRAY_BUFFER, (OpenGLBufferSizeType)(
+			this->mVertexTextureCoord.size() * sizeof(GLfloat)),
+			&this->mVertexTextureCoord[0], GL_STATIC_DRAW);
+		NOpenGLExtensions::BindBuffer(GL_ARRAY_BUFFER, 0);
+
+		NOpenGLExtensions::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->mIndexBufferReference);
+		NOpenGLExtensions::BufferData(GL_ELEMENT_ARRAY_BUFFER, (OpenGLBufferSizeType)(
+			this->mTriangleIndex.size() * sizeof(GLuint)), &this->mTriangleIndex[0],
+			GL_STATIC_DRAW);
+		NOpenGLExtensions::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+		this->mbBufferObjectsCreated = true;
+	}
+
+	return(this->mbBufferObjectsCreated);
+}
+
+
+bool COpenGLGridMesh::CreatePixelBufferObjects()
+{
+	if (!this->mbPixelBuffersCreated && NOpenGLExtensions::LoadBufferObjectFunctions() &&
+		NOpenGLExtensions::ArePixelBuffersAvailable())
+	{
+		// Buffer storage is specified when each image is uploaded.
+		NOpenGLExtensions::GenBuffers(kPixelBufferCount, this->mPixelBufferReference);
+
+		this->mNextPixelBufferIndex = 0;
+		this->mbPixelBuffersCreated = true;
+	}
+
+	return(this->mbPixelBuffersCreated);
+}
+
+
+void COpenGLGridMesh::BindVertexArrays() const
+{
+	if (this->mbBufferObjectsCreated) {
+		const OpenGLBufferSizeType	locationArraySize = (OpenGLBufferSizeType)(
+			this->mVertexLocation.size() * sizeof(GLfloat));
+		const OpenGLBufferSizeType	normalArraySize = (OpenGLBufferSizeType)(
+			this->mVertexNormal.size() * sizeof(GLfloat));
+
+		// Texture coordinates are sourced from the static buffer...
+		NOpenGLExtensions::BindBuffer(GL_ARRAY_BUFFER, this->mStaticVertexBufferReference);
+		::glTexCoordPointer(2, GL_FLOAT, 0, NULL);
+
+		// ...And the vertex locations and normals are streamed - the buffer storage is
+		// respecified ("orphaned") before the contents are replaced, so that the
+		// renderer need not wait for draw calls that source the previous contents.
+		NOpenGLExtensions::BindBuffer(GL_ARRAY_BUFFER, this->mStreamVertexBufferReference);
+		NOpenGLExtensions::BufferData(GL_ARRAY_BUFFER, locationArraySize + normalArraySize,
+			NULL, GL_STREAM_DRAW);
+		NOpenGLExtensions::BufferSubData(GL_ARRAY_BUFFER, 0, locationArraySize,
+			&this->mVertexLocation[0]);
+		NOpenGLExtensions::BufferSubData(GL_ARRAY_BUFFER, locationArraySize, normalArraySize,
+			&this->mVertexNormal[0]);
+
+		::glVertexPointer(3, GL_FLOAT, 0, NULL);
+		::glNormalPointer(GL_FLOAT, 0, (const GLvoid*)locationArraySize);
+	}
+	else {
+		::glVertexPointer(3, GL_FLOAT, 0, &this->mVertexLocation[0]);
+		::glNormalPointer(GL_FLOAT, 0, &this->mVertexNormal[0]);
+		::glTexCoordPointer(2, GL_FLOAT, 0, &this->mVertexTextureCoord[0]);
+	}
+}
@@ -1,5 +1,6 @@
 #include "PrimaryHeaders.h"
 #include "ModelGeometry.h"
+#include "OpenGLExtensions.h"
 
 #ifndef _MODELGEOMETRYOPENGL_H
 #define _MODELGEOMETRYOPENGL_H 1
@@ -64,4 +65,158 @@ protected:
 };
 
 
+
+// Texture upload statistics (accumulated until the counters are reset).
+class CTextureUploadCounters
+{
+public:
+	CTextureUploadCounters();
+
+	// Number of texture image uploads, and the total size of the uploaded images (bytes).
+	QuantityType					mUploadCount;
+	QuantityType					mUploadByteCount;
+
+	// Number of times that texture storage has been allocated.
+	QuantityType					mAllocationCount;
+};
+
+
+// Indexed triangle mesh of a rectangular grid of vertices (e.g. a cloth node network).
+// Texture coordinates, triangle indices and material properties are generated once -
+// vertex locations and normals are overwritten in place before the mesh is rendered,
+// so that no geometry is allocated once the mesh has been created. When buffer objects
+// are available, the texture coordinates and indices are stored within static buffer
+// objects, and the vertex locations and normals are streamed to a buffer object whenever
+// the mesh is rendered. The mesh must be created and destroyed while the rendering
+// context is current.
+class COpenGLGridMesh
+{
+public:
+	COpenGLGridMesh(const QuantityType verticesPerRow, const QuantityType verticesPerColumn);
+	~COpenGLGridMesh();
+
+	// Determines if the mesh contains at least one grid cell.
+	bool							IsValid() const;
+
+	// Returns the number of vertices within the mesh.
+	QuantityType					GetVertexCount() const;
+
+	// Retrieves the vertex location and vertex normal arrays (three components per
+	// vertex, with vertices stored in row order), which may be overwritten before the
+	// mesh is rendered.
+	GLfloat*						GetVertexLocationArray();
+	GLfloat*						GetVertexNormalArray();
+
+	// Sets the material properties of the mesh (diffuse and specular color, and the
+	// specularity, 0.0 - 1.0).
+	void							SetMeshMaterial(const CFloatColor& baseColor,
+		const ScalarType specularity);
+
+	// Replaces the image of the mesh texture (RGBA, eight bits per component), which is
+	// identified by a revision. Texture storage is allocated only when the image
+	// dimensions change - otherwise, the existing storage is overwritten.
+	bool							SetTextureImage(const QuantityType textureWidth,
+		const QuantityType textureHeight, const void* pTextureData,
+		const QuantityType imageRevision);
+
+	// Determines if the mesh texture contains the image with the specified revision.
+	bool							IsTextureImageCurrent(const QuantityType imageRevision) const;
+
+	// Retrieves the texture upload statistics.
+	const CTextureUploadCounters&	GetTextureUploadCounters() const;
+
+	// Resets the texture upload statistics.
+	void							ResetTextureUploadCounters();
+
+	// Renders the mesh with the current vertex locations and normals.
+	bool							RenderMesh() const;
+
+	// Determines if the mesh is rendered from buffer objects.
+	bool							UsesBufferObjects() const;
+
+protected:
+
+	// Type definitions - vertex attribute and triangle index arrays.
+	typedef std::vector<GLfloat>	VertexArrayType;
+	typedef std::vector<GLuint>		IndexArrayType;
+
+	// Generates the texture coordinates and triangle indices of the grid.
+	void							GenerateGridTopology();
+
+	// Creates the mesh texture object.
+	bool							CreateTextureObject();
+
+	// Creates the vertex and index buffer objects (if buffer objects are available).
+	bool							CreateBufferObjects();
+
+	// Creates the pixel buffer objects used to upload texture images (if pixel buffer
+	// objects are available).
+	bool							CreatePixelBufferObjects();
+
+	// Binds the vertex arrays to the buffer objects (streaming the vertex locations and
+	// normals), or to the client-side arrays.
+	void							BindVertexArrays() const;
+
+	// Grid dimensions.
+	QuantityType					mVerticesPerRow;
+	QuantityType					mVerticesPerColumn;
+
+	// Vertex attributes (three components per location and normal, two components per
+	// texture coordinate).
+	VertexArrayType					mVertexLocation;
+	VertexArrayType					mVertexNormal;
+	VertexArrayType					mVertexTextureCoord;
+
+	// Triangle vertex indices (two triangles per grid cell).
+	IndexArrayType					mTriangleIndex;
+
+	// Material properties.
+	CFloatColor						mMeshBaseColor;
+	ScalarType						mMeshSpecularity;
+
+	// Mesh texture object.
+	GLuint							mTextureReference;
+
+	// TRUE if the texture object has been created.
+	bool							mbTextureReferenceSet;
+
+	// Dimensions of the allocated texture storage.
+	QuantityType					mTextureWidth;
+	QuantityType					mTextureHeight;
+
+	// Revision of the texture image (valid once an image has been stored).
+	QuantityType					mTextureImageRevision;
+	bool							mbTextureImageSet;
+
+	// Texture upload statistics.
+	CTextureUploadCounters			mTextureUploadCounters;
+
+	// Number of pixel buffer objects used to upload texture images (uploads cycle through
+	// the buffers, so that an upload does not modify a buffer that may still be in use by
+	// the previous upload).
+	enum { kPixelBufferCount = 2 };
+
+	// Pixel buffer objects, and the index of the buffer used by the next upload.
+	GLuint							mPixelBufferReference[kPixelBufferCount];
+	IndexType						mNextPixelBufferIndex;
+
+	// TRUE if the pixel buffer objects have been created.
+	bool							mbPixelBuffersCreated;
+
+	// Buffer objects - streamed vertex locations and normals (locations precede the
+	// normals), static texture coordinates, and static triangle indices.
+	GLuint							mStreamVertexBufferReference;
+	GLuint							mStaticVertexBufferReference;
+	GLuint							mIndexBufferReference;
+
+	// TRUE if the buffer objects have been created.
+	bool							mbBufferObjectsCreated;
+
+private:
+	// Meshes cannot be copied (the texture and buffer objects are deleted with the mesh).
+	COpenGLGridMesh(const COpenGLGridMesh& gridMesh);
+	COpenGLGridMesh&				operator=(const COpenGLGridMesh& gridMesh);
+};
+
+
 #endif	//#ifndef _MODELGEOMETRYOPENGL_H
\ No newline at end of file
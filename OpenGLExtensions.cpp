@@ -0,0 +1,216 @@
+// OpenGLExtensions.cpp - Contains implementations for OpenGL entry points that are not exported by
+//                        the system OpenGL library (OpenGL 1.1), and are retrieved at run time.
+
+#include "OpenGLExtensions.h"
+#include <string.h>
+
+#if !defined(_WIN32)
+#include <GL/glx.h>
+#endif	// #if !defined(_WIN32)
+
+#ifndef APIENTRY
+#define APIENTRY
+#endif	// #ifndef APIENTRY
+
+
+// Type definitions - buffer object entry points.
+typedef void (APIENTRY* GenBuffersProcType)(GLsizei bufferCount, GLuint* pBuffers);
+typedef void (APIENTRY* DeleteBuffersProcType)(GLsizei bufferCount, const GLuint* pBuffers);
+typedef void (APIENTRY* BindBufferProcType)(GLenum target, GLuint buffer);
+typedef void (APIENTRY* BufferDataProcType)(GLenum target, OpenGLBufferSizeType size,
+	const GLvoid* pData, GLenum usage);
+typedef void (APIENTRY* BufferSubDataProcType)(GLenum target, OpenGLBufferSizeType offset,
+	OpenGLBufferSizeType size, const GLvoid* pData);
+
+
+// Buffer object entry points, retrieved from the rendering context.
+class CBufferObjectFunctions
+{
+public:
+	CBufferObjectFunctions() : mbLoadAttempted(false), mbPixelBuffersSupported(false),
+		mpGenBuffers(NULL),
+		mpDeleteBuffers(NULL), mpBindBuffer(NULL), mpBufferData(NULL),
+		mpBufferSubData(NULL)
+	{
+
+	}
+
+	// Determines if every entry point has been retrieved.
+	bool							IsValid() const
+	{
+		return(this->mpGenBuffers && this->mpDeleteBuffers && this->mpBindBuffer &&
+			this->mpBufferData && this->mpBufferSubData);
+	}
+
+	// Indicates that retrieval of the entry points has been attempted.
+	bool							mbLoadAttempted;
+
+	// Indicates that the rendering context supports pixel buffer objects.
+	bool							mbPixelBuffersSupported;
+
+	GenBuffersProcType				mpGenBuffers;
+	DeleteBuffersProcType			mpDeleteBuffers;
+	BindBufferProcType				mpBindBuffer;
+	BufferDataProcType				mpBufferData;
+	BufferSubDataProcType			mpBufferSubData;
+};
+
+
+// Returns the buffer object entry points (shared by all rendering contexts - the
+// program uses a single rendering context).
+static CBufferObjectFunctions& GetBufferObjectFunctions()
+{
+	static CBufferObjectFunctions	bufferObjectFunctions;
+
+	return(bufferObjectFunctions);
+}
+
+
+// Returns the flag that permits the use of buffer objects (shared by all rendering
+// contexts).
+static bool& GetBufferObjectsEnabled()
+{
+	static bool						bBufferObjectsEnabled = true;
+
+	return(bBufferObjectsEnabled);
+}
+
+
+// Retrieves the address of an OpenGL entry point from the current rendering context.
+static void* GetOpenGLProcAddress(const char* pProcName)
+{
+#if defined(_WIN32)
+	return((void*)::wglGetProcAddress(pProcName));
+#else
+	return((void*)::glXGetProcAddressARB((const GLubyte*)pProcName));
+#endif	// #if defined(_WIN32)
+}
+
+
+// Retrieves the buffer object entry points with the specified name suffix (none for the
+// OpenGL 1.5 entry points, or "ARB" for the extension entry points).
+static bool RetrieveBufferObjectFunctions(const char* pNameSuffix,
+										  CBufferObjectFunctions& bufferObjectFunctions)
+{
+	// Maximum length of an entry point name.
+	enum { kMaxProcNameLength = 64 };
+
+	char							procName[kMaxProcNameLength];
+
+	::sprintf(procName, "glGenBuffers%s", pNameSuffix);
+	bufferObjectFunctions.mpGenBuffers = (GenBuffersProcType)GetOpenGLProcAddress(procName);
+	::sprintf(procName, "glDeleteBuffers%s", pNameSuffix);
+	bufferObjectFunctions.mpDeleteBuffers =
+		(DeleteBuffersProcType)GetOpenGLProcAddress(procName);
+	::sprintf(procName, "glBindBuffer%s", pNameSuffix);
+	bufferObjectFunctions.mpBindBuffer = (BindBufferProcType)GetOpenGLProcAddress(procName);
+	::sprintf(procName, "glBufferData%s", pNameSuffix);
+	bufferObjectFunctions.mpBufferData = (BufferDataProcType)GetOpenGLProcAddress(procName);
+	::sprintf(procName, "glBufferSubData%s", pNameSuffix);
+	bufferObjectFunctions.mpBufferSubData =
+		(BufferSubDataProcType)GetOpenGLProcAddress(procName);
+
+	return(bufferObjectFunctions.IsValid());
+}
+
+
+bool NOpenGLExtensions::LoadBufferObjectFunctions()
+{
+	CBufferObjectFunctions&			bufferObjectFunctions = GetBufferObjectFunctions();
+
+	if (!bufferObjectFunctions.mbLoadAttempted) {
+		const char*					pVersionString = (const char*)::glGetString(GL_VERSION);
+		const char*					pExtensionString =
+			(const char*)::glGetString(GL_EXTENSIONS);
+
+		// Entry points may be retrieved even when they are not supported by the
+		// rendering context (the version and extension strings determine support). No
+		// version string is available if a rendering context is not current.
+		if (pVersionString) {
+			int						majorVersion = 0;
+			int						minorVersion = 0;
+
+			::sscanf(pVersionString, "%d.%d", &majorVersion, &minorVersion);
+
+			bool					bEntryPointsRetrieved = false;
+
+			if ((majorVersion > 1) || ((majorVersion == 1) && (minorVersion >= 5))) {
+				bEntryPointsRetrieved = RetrieveBufferObjectFunctions("",
+					bufferObjectFunctions);
+			}
+
+			if (!bEntryPointsRetrieved && pExtensionString &&
+				::strstr(pExtensionString, "GL_ARB_vertex_buffer_object"))
+			{
+				bEntryPointsRetrieved = RetrieveBufferObjectFunctions("ARB",
+					bufferObjectFunctions);
+			}
+
+			if (bEntryPointsRetrieved) {
+				bufferObjectFunctions.mbPixelBuffersSupported = (majorVersion > 2) ||
+					((majorVersion == 2) && (minorVersion >= 1)) || (pExtensionString &&
+					(::strstr(pExtensionString, "GL_ARB_pixel_buffer_object") ||
+					::strstr(pExtensionString, "GL_EXT_pixel_buffer_object")));
+			}
+			else {
+				bufferObjectFunctions = CBufferObjectFunctions();
+			}
+
+			bufferObjectFunctions.mbLoadAttempted = true;
+		}
+	}
+
+	return(NOpenGLExtensions::AreBufferObjectsAvailable());
+}
+
+
+bool NOpenGLExtensions::AreBufferObjectsAvailable()
+{
+	return(GetBufferObjectsEnabled() && GetBufferObjectFunctions().IsValid());
+}
+
+
+bool NOpenGLExtensions::ArePixelBuffersAvailable()
+{
+	return(NOpenGLExtensions::AreBufferObjectsAvailable() &&
+		GetBufferObjectFunctions().mbPixelBuffersSupported);
+}
+
+
+void NOpenGLExtensions::SetBufferObjectsEnabled(const bool bBufferObjectsEnabled)
+{
+	GetBufferObjectsEnabled() = bBufferObjectsEnabled;
+}
+
+
+void NOpenGLExtensions::GenBuffers(const GLsizei bufferCount, GLuint* pBuffers)
+{
+	GetBufferObjectFunctions().mpGenBuffers(bufferCount, pBuffers);
+}
+
+
+void NOpenGLExtensions::DeleteBuffers(const GLsizei bufferCount, const GLuint* pBuffers)
+{
+	GetBufferObjectFunctions().mpDeleteBuffers(bufferCount, pBuffers);
+}
+
+
+void NOpenGLExtensions::BindBuffer(const GLenum target, const GLuint buffer)
+{
+	GetBufferObjectFunctions().mpBindBuffer(target, buffer);
+}
+
+
+void NOpenGLExtensions::BufferData(const GLenum target, const OpenGLBufferSizeType size,
+								   const GLvoid* pData, const GLenum usage)
+{
+	GetBufferObjectFunctions().mpBufferData(target, size, pData, usage);
+}
+
+
+void NOpenGLExtensions::BufferSubData(const GLenum target,
+									  const OpenGLBufferSizeType offset,
+									  const OpenGLBufferSizeType size, const GLvoid* pData)
+{
+	GetBufferObjectFunctions().mpBufferSubData(target, offset, size, pData);
+}
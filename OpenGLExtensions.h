@@ -0,0 +1,64 @@
+// OpenGLExtensions.h - Contains declarations for OpenGL entry points that are not exported by the
+//                      system OpenGL library (OpenGL 1.1), and are retrieved at run time.
+
+#ifndef _OPENGLEXTENSIONS_H
+#define _OPENGLEXTENSIONS_H		1
+
+
+#include "PrimaryHeaders.h"
+#include <stddef.h>
+
+
+// Buffer object definitions (OpenGL 1.5/ARB_vertex_buffer_object).
+#ifndef GL_ARRAY_BUFFER
+#define GL_ARRAY_BUFFER					0x8892
+#define GL_ELEMENT_ARRAY_BUFFER			0x8893
+#define GL_STREAM_DRAW					0x88E0
+#define GL_STATIC_DRAW					0x88E4
+#endif	// #ifndef GL_ARRAY_BUFFER
+
+// Pixel buffer object definitions (OpenGL 2.1/ARB_pixel_buffer_object).
+#ifndef GL_PIXEL_UNPACK_BUFFER
+#define GL_PIXEL_UNPACK_BUFFER			0x88EC
+#endif	// #ifndef GL_PIXEL_UNPACK_BUFFER
+
+// Type definition - buffer object sizes and offsets (bytes).
+typedef ptrdiff_t						OpenGLBufferSizeType;
+
+
+namespace NOpenGLExtensions
+{
+	// Retrieves the buffer object entry points, if buffer objects are supported by the
+	// current rendering context (a rendering context must be current - the entry points
+	// are retrieved once). Returns true if buffer objects are available.
+	bool							LoadBufferObjectFunctions();
+
+	// Determines if the buffer object entry points have been retrieved (and the use of
+	// buffer objects is permitted).
+	bool							AreBufferObjectsAvailable();
+
+	// Permits or prevents the use of buffer objects (permitted by default) - when
+	// prevented, buffer objects are reported as unavailable, and client-side vertex
+	// arrays and texture images are used by objects that are subsequently created.
+	void							SetBufferObjectsEnabled(const bool
+		bBufferObjectsEnabled);
+
+	// Determines if buffer objects may also be used as sources of pixel data (the
+	// GL_PIXEL_UNPACK_BUFFER target).
+	bool							ArePixelBuffersAvailable();
+
+	// Buffer object functions (equivalent to the OpenGL functions of the same name -
+	// buffer objects must be available).
+	void							GenBuffers(const GLsizei bufferCount, GLuint* pBuffers);
+	void							DeleteBuffers(const GLsizei bufferCount,
+		const GLuint* pBuffers);
+	void							BindBuffer(const GLenum target, const GLuint buffer);
+	void							BufferData(const GLenum target,
+		const OpenGLBufferSizeType size, const GLvoid* pData, const GLenum usage);
+	void							BufferSubData(const GLenum target,
+		const OpenGLBufferSizeType offset, const OpenGLBufferSizeType size,
+		const GLvoid* pData);
+};
+
+
+#endif	// #ifndef _OPENGLEXTENSIONS_H
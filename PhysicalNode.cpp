@@ -1,13 +1,14 @@
 // PhysicalNode.cpp - Contains implementations pertaining to nodes/node physics.
 
 #include "PhysicalNode.h"
+#include <algorithm>
 
 /////
 // CPhysicalNodeBase class
 /////
 CPhysicalNodeBase::CPhysicalNodeBase() :
 	mNodeLocation(0.0, 0.0, 0.0), mNodeMass(0.0), mVelocityVector(0.0, 0.0, 0.0),
-	mbIsAnchorNode(false)
+	mbIsAnchorNode(false), mPreviousNodeLocation(0.0, 0.0, 0.0), mPreviousTimeQuantum(0.0)
 {
 	// Copy constructor
 }
@@ -16,7 +17,8 @@ CPhysicalNodeBase::CPhysicalNodeBase() :
 CPhysicalNodeBase::CPhysicalNodeBase(const CFloatPoint& initialLocation, 
 									 const ScalarType nodeMass, const bool bIsAnchorNode) : 
 	mNodeLocation(initialLocation), mNodeMass(nodeMass), mVelocityVector(0.0, 0.0, 0.0),
-	mbIsAnchorNode(bIsAnchorNode)
+	mbIsAnchorNode(bIsAnchorNode), mPreviousNodeLocation(initialLocation),
+	mPreviousTimeQuantum(0.0)
 {
 	
 }
@@ -108,6 +110,64 @@ bool CPhysicalNodeBase::ApplyForceVector(const ScalarType timeQuantum)
 	return (bAppliedSuccessfully);
 }
 
+bool CPhysicalNodeBase::ApplyForceVectorVerlet(const ScalarType timeQuantum,
+											   const ScalarType dampingFactor)
+{
+	bool							bAppliedSuccessfully = false;
+
+	if ((timeQuantum > 0.0) && (dampingFactor >= 0.0) && (dampingFactor < 1.0) &&
+		this->IsValid() && !this->IsAnchorNode())
+	{
+		const CFloatPoint			currentNodeLocation = this->GetNodeLocation();
+
+		// Determine the previous node location from the node velocity if the node
+		// has not been integrated with the current time quantum (Verlet integration
+		// relies upon a constant time quantum).
+		if (this->mPreviousTimeQuantum != timeQuantum) {
+			const CVector			previousDisplacementVector =
+				this->GetNodeVelocityVector() * timeQuantum;
+
+			this->mPreviousNodeLocation = currentNodeLocation - CFloatPoint(
+				previousDisplacementVector.GetXComponent(),
+				previousDisplacementVector.GetYComponent(),
+				previousDisplacementVector.GetZComponent());
+		}
+
+		// Acceleration = Force (N) / Mass (kg)
+		const CVector				nodeAccelerationVector = this->mPendingForceVector /
+			this->GetNodeMass();
+
+		// Location = Location + ((Location - Previous Location) x (1 - Damping)) +
+		//	(Acceleration x Time^2)
+		const CFloatPoint			inertialDisplacement = (currentNodeLocation -
+			this->mPreviousNodeLocation) * (1.0 - dampingFactor);
+		const CVector				forceDisplacementVector = nodeAccelerationVector *
+			timeQuantum * timeQuantum;
+
+		const CFloatPoint			nodeDisplacement = inertialDisplacement + CFloatPoint(
+			forceDisplacementVector.GetXComponent(), forceDisplacementVector.GetYComponent(),
+			forceDisplacementVector.GetZComponent());
+
+		this->SetNodeLocation(currentNodeLocation + nodeDisplacement);
+
+		// The velocity is implied by the displacement (external forces, such as viscous
+		// forces, are evaluated using the node velocity).
+		this->SetNodeVelocityVector(CVector(nodeDisplacement.GetXCoord(),
+			nodeDisplacement.GetYCoord(), nodeDisplacement.GetZCoord()) / timeQuantum);
+
+		this->mPreviousNodeLocation = currentNodeLocation;
+		this->mPreviousTimeQuantum = timeQuantum;
+
+		bAppliedSuccessfully = true;
+	}
+
+	// Clear the force vector after the force has been applied to the node (no forces are
+	// currently pending).
+	this->mPendingForceVector = CVector(0.0, 0.0, 0.0);
+
+	return(bAppliedSuccessfully);
+}
+
 void CPhysicalNodeBase::SetAnchorNodeStatus(const bool bIsAnchorNode)
 {
 	// Set the anchor node flag (indicates whether or not the node
@@ -135,9 +195,142 @@ void CPhysicalNodeBase::SetNodeVelocityVector(const CVector& newVelocityVector)
 	if (this->IsValid() && !this->IsAnchorNode()) {
 		// Set the velocity vector if the node is not an anchor node.
 		this->mVelocityVector = newVelocityVector;
+
+		// The previous node location (Verlet integration) will be determined from
+		// the new velocity.
+		this->mPreviousTimeQuantum = 0.0;
 	}
 }
 
+/////
+// CPhysicalNodeState class
+/////
+CPhysicalNodeState::CPhysicalNodeState(const CFloatPoint& nodeLocation,
+									   const CVector& velocityVector,
+									   const ScalarType nodeMass,
+									   const bool bIsAnchorNode) :
+	CPhysicalNodeBase(nodeLocation, nodeMass, bIsAnchorNode)
+{
+	this->SetNodeVelocityVector(velocityVector);
+}
+
+CPhysicalNodeState::~CPhysicalNodeState()
+{
+
+}
+
+
+/////
+// CExternalForceNodeBatch class
+/////
+CExternalForceNodeBatch::CExternalForceNodeBatch(const QuantityType nodeCount,
+												 const ScalarType* pNodeLocationX,
+												 const ScalarType* pNodeLocationY,
+												 const ScalarType* pNodeLocationZ,
+												 const ScalarType* pNodeVelocityX,
+												 const ScalarType* pNodeVelocityY,
+												 const ScalarType* pNodeVelocityZ,
+												 const ScalarType* pNodeMass,
+												 ScalarType* pNodeForceX,
+												 ScalarType* pNodeForceY,
+												 ScalarType* pNodeForceZ) :
+	mNodeCount(nodeCount), mpNodeLocationX(pNodeLocationX),
+	mpNodeLocationY(pNodeLocationY), mpNodeLocationZ(pNodeLocationZ),
+	mpNodeVelocityX(pNodeVelocityX), mpNodeVelocityY(pNodeVelocityY),
+	mpNodeVelocityZ(pNodeVelocityZ), mpNodeMass(pNodeMass), mpNodeForceX(pNodeForceX),
+	mpNodeForceY(pNodeForceY), mpNodeForceZ(pNodeForceZ)
+{
+
+}
+
+CExternalForceNodeBatch::~CExternalForceNodeBatch()
+{
+
+}
+
+
+/////
+// CExternalForceNodeGrid class
+/////
+CExternalForceNodeGrid::CExternalForceNodeGrid(const QuantityType nodesPerRow,
+											   const QuantityType nodesPerColumn,
+											   const ScalarType* pNodeLocationX,
+											   const ScalarType* pNodeLocationY,
+											   const ScalarType* pNodeLocationZ,
+											   const ScalarType* pNodeVelocityX,
+											   const ScalarType* pNodeVelocityY,
+											   const ScalarType* pNodeVelocityZ,
+											   ScalarType* pNodeForceX,
+											   ScalarType* pNodeForceY,
+											   ScalarType* pNodeForceZ) :
+	mNodesPerRow(nodesPerRow), mNodesPerColumn(nodesPerColumn),
+	mpNodeLocationX(pNodeLocationX), mpNodeLocationY(pNodeLocationY),
+	mpNodeLocationZ(pNodeLocationZ), mpNodeVelocityX(pNodeVelocityX),
+	mpNodeVelocityY(pNodeVelocityY), mpNodeVelocityZ(pNodeVelocityZ),
+	mpNodeForceX(pNodeForceX), mpNodeForceY(pNodeForceY), mpNodeForceZ(pNodeForceZ)
+{
+
+}
+
+CExternalForceNodeGrid::~CExternalForceNodeGrid()
+{
+
+}
+
+
+/////
+// CExternalForceGridBuffer class
+/////
+CExternalForceGridBuffer::CExternalForceGridBuffer() : mNodesPerRow(0), mNodesPerColumn(0)
+{
+
+}
+
+CExternalForceGridBuffer::~CExternalForceGridBuffer()
+{
+
+}
+
+
+void CExternalForceGridBuffer::AllocateGrid(const QuantityType nodesPerRow,
+											const QuantityType nodesPerColumn)
+{
+	const QuantityType				gridNodeCount = nodesPerRow * nodesPerColumn;
+
+	this->mNodesPerRow = nodesPerRow;
+	this->mNodesPerColumn = nodesPerColumn;
+
+	this->mNodeLocationX.resize(gridNodeCount);
+	this->mNodeLocationY.resize(gridNodeCount);
+	this->mNodeLocationZ.resize(gridNodeCount);
+	this->mNodeVelocityX.resize(gridNodeCount);
+	this->mNodeVelocityY.resize(gridNodeCount);
+	this->mNodeVelocityZ.resize(gridNodeCount);
+	this->mNodeForceX.resize(gridNodeCount);
+	this->mNodeForceY.resize(gridNodeCount);
+	this->mNodeForceZ.resize(gridNodeCount);
+}
+
+
+CExternalForceNodeGrid CExternalForceGridBuffer::GetNodeGrid()
+{
+	// Empty grids are presented with no node state.
+	const bool						bGridAllocated = !this->mNodeLocationX.empty();
+
+	return(CExternalForceNodeGrid(bGridAllocated ? this->mNodesPerRow : 0,
+		bGridAllocated ? this->mNodesPerColumn : 0,
+		bGridAllocated ? &this->mNodeLocationX[0] : NULL,
+		bGridAllocated ? &this->mNodeLocationY[0] : NULL,
+		bGridAllocated ? &this->mNodeLocationZ[0] : NULL,
+		bGridAllocated ? &this->mNodeVelocityX[0] : NULL,
+		bGridAllocated ? &this->mNodeVelocityY[0] : NULL,
+		bGridAllocated ? &this->mNodeVelocityZ[0] : NULL,
+		bGridAllocated ? &this->mNodeForceX[0] : NULL,
+		bGridAllocated ? &this->mNodeForceY[0] : NULL,
+		bGridAllocated ? &this->mNodeForceZ[0] : NULL));
+}
+
+
 /////
 // CExternalNodeForce class
 /////
@@ -151,6 +344,31 @@ CExternalNodeForce::~CExternalNodeForce()
 
 }
 
+bool CExternalNodeForce::AccumulateExternalForceVectors(const CExternalForceNodeBatch&
+														nodeBatch) const
+{
+	bool							bGeneratedSuccessfully = false;
+
+	for (IndexType nodeLoop = 0; nodeLoop < nodeBatch.mNodeCount; nodeLoop++) {
+		// Present the node state as a physical node.
+		const CPhysicalNodeState	nodeState(CFloatPoint(nodeBatch.mpNodeLocationX[nodeLoop],
+			nodeBatch.mpNodeLocationY[nodeLoop], nodeBatch.mpNodeLocationZ[nodeLoop]),
+			CVector(nodeBatch.mpNodeVelocityX[nodeLoop], nodeBatch.mpNodeVelocityY[nodeLoop],
+			nodeBatch.mpNodeVelocityZ[nodeLoop]), nodeBatch.mpNodeMass[nodeLoop], false);
+		CVector						forceVector(0.0, 0.0, 0.0);
+
+		if (this->GenerateExternalForceVector(nodeState, forceVector)) {
+			nodeBatch.mpNodeForceX[nodeLoop] += forceVector.GetXComponent();
+			nodeBatch.mpNodeForceY[nodeLoop] += forceVector.GetYComponent();
+			nodeBatch.mpNodeForceZ[nodeLoop] += forceVector.GetZComponent();
+
+			bGeneratedSuccessfully = true;
+		}
+	}
+
+	return(bGeneratedSuccessfully);
+}
+
 bool CExternalNodeForce::IsValid() const
 {
 	// Derived classes should override this method, and perform the
@@ -159,6 +377,27 @@ bool CExternalNodeForce::IsValid() const
 }
 
 
+/////
+// CExternalSurfaceForce class
+/////
+CExternalSurfaceForce::CExternalSurfaceForce()
+{
+
+}
+
+CExternalSurfaceForce::~CExternalSurfaceForce()
+{
+
+}
+
+bool CExternalSurfaceForce::IsValid() const
+{
+	// Derived classes should override this method, and perform the
+	// appropriate parameter verifications as necessary.
+	return(false);
+}
+
+
 /////
 // CExternalNodeForceCollection class
 /////
@@ -170,6 +409,7 @@ CExternalNodeForceCollection::CExternalNodeForceCollection()
 CExternalNodeForceCollection::~CExternalNodeForceCollection()
 {
 	this->mExternalForceList.clear();
+	this->mSurfaceForceList.clear();
 }
 
 
@@ -219,3 +459,84 @@ bool CExternalNodeForceCollection::EvaluateExternalForces(const CPhysicalNodeBas
 	return(bEvaluatedSuccessfully);
 }
 
+
+bool CExternalNodeForceCollection::EvaluateExternalForces(const CExternalForceNodeBatch&
+														  nodeBatch,
+														  const ScalarType timeQuantum) const
+{
+	bool							bEvaluatedSuccessfully = false;
+
+	// Clear the force arrays...
+	std::fill(nodeBatch.mpNodeForceX, nodeBatch.mpNodeForceX + nodeBatch.mNodeCount, 0.0);
+	std::fill(nodeBatch.mpNodeForceY, nodeBatch.mpNodeForceY + nodeBatch.mNodeCount, 0.0);
+	std::fill(nodeBatch.mpNodeForceZ, nodeBatch.mpNodeForceZ + nodeBatch.mNodeCount, 0.0);
+
+	ExternalForceListType::const_iterator
+									forceListIterator;
+
+	// ...And accumulate each force for the entire batch.
+	for (forceListIterator = this->mExternalForceList.begin(); forceListIterator !=
+		this->mExternalForceList.end(); forceListIterator++)
+	{
+		if (*forceListIterator &&
+			(*forceListIterator)->AccumulateExternalForceVectors(nodeBatch))
+		{
+			bEvaluatedSuccessfully = true;
+		}
+	}
+
+	return(bEvaluatedSuccessfully);
+}
+
+
+bool CExternalNodeForceCollection::AddExternalSurfaceForce(CExternalSurfaceForce&
+														   externalSurfaceForce)
+{
+	bool							bAddedSuccessfully = false;
+
+	// Add the surface force generator to the list of generators.
+	if (externalSurfaceForce.IsValid()) {
+		this->mSurfaceForceList.push_back(&externalSurfaceForce);
+		bAddedSuccessfully = true;
+	}
+
+	return(bAddedSuccessfully);
+}
+
+
+bool CExternalNodeForceCollection::HasSurfaceForces() const
+{
+	return(!this->mSurfaceForceList.empty());
+}
+
+
+bool CExternalNodeForceCollection::EvaluateSurfaceForces(const CExternalForceNodeGrid&
+														 nodeGrid) const
+{
+	bool							bEvaluatedSuccessfully = false;
+
+	const QuantityType				gridNodeCount = nodeGrid.mNodesPerRow *
+		nodeGrid.mNodesPerColumn;
+
+	// Clear the force arrays...
+	std::fill(nodeGrid.mpNodeForceX, nodeGrid.mpNodeForceX + gridNodeCount, 0.0);
+	std::fill(nodeGrid.mpNodeForceY, nodeGrid.mpNodeForceY + gridNodeCount, 0.0);
+	std::fill(nodeGrid.mpNodeForceZ, nodeGrid.mpNodeForceZ + gridNodeCount, 0.0);
+
+	SurfaceForceListType::const_iterator
+									forceListIterator;
+
+	// ...And accumulate each surface force for the entire grid.
+	for (forceListIterator = this->mSurfaceForceList.begin(); forceListIterator !=
+		this->mSurfaceForceList.end(); forceListIterator++)
+	{
+		if (*forceListIterator &&
+			(*forceListIterator)->AccumulateSurfaceForceVectors(nodeGrid))
+		{
+			bEvaluatedSuccessfully = true;
+		}
+	}
+
+	return(bEvaluatedSuccessfully);
+}
+
@@ -8,6 +8,18 @@
 #include "PrimitiveSupport.h"
 
 
+// Node integration methods.
+typedef enum
+{
+	eNodeIntegratorEuler = 0,		// Explicit Euler (velocity and displacement updated from
+									// the applied force).
+	eNodeIntegratorVerlet,			// Position Verlet (velocity is implied by the previous
+									// node location, with damping applied to the displacement).
+	eNodeIntegratorImplicitEuler	// Backward Euler (spring array solver only - spring forces
+									// are linearized, and the velocity change is solved).
+} ENodeIntegrator;
+
+
 class CPhysicalNodeBase
 {
 public:
@@ -37,15 +49,21 @@ public:
 	// Applies the pending force to the current node over a specified period of time.
 	bool							ApplyForceVector(const ScalarType timeQuantum);
 
+	// Applies the pending force to the current node over a specified period of time,
+	// using position Verlet integration - the displacement since the previous step is
+	// reduced by the damping factor (0.0 - 1.0) before being applied.
+	bool							ApplyForceVectorVerlet(const ScalarType timeQuantum,
+		const ScalarType dampingFactor);
+
 	// Sets the anchor node status (node will always report a velocity of zero
 	// while this flag is set to TRUE).
 	virtual void					SetAnchorNodeStatus(const bool bIsAnchorNode);
 
-protected:
-
 	// Determines if the current node is an anchor node.
 	virtual bool					IsAnchorNode() const;
 
+protected:
+
 	// Sets the current node position.
 	void							SetNodeLocation(const CFloatPoint& nodeLocation);
 
@@ -67,12 +85,147 @@ protected:
 	// Node location in three-dimensional space.
 	CFloatPoint						mNodeLocation;
 
+	// Node location prior to the most recent Verlet integration step.
+	CFloatPoint						mPreviousNodeLocation;
+
+	// Time quantum of the most recent Verlet integration step (zero when the
+	// previous node location must be determined from the node velocity).
+	ScalarType						mPreviousTimeQuantum;
+
 	// Externally-applied force (will have no direction/magnitude
 	// after force has been applied).
 	CVector							mPendingForceVector;
 };
 
 
+// Presents the state of a node that is not stored as a physical node (e.g. a node
+// within a node array), permitting external force generators to evaluate forces for
+// the node.
+class CPhysicalNodeState : public CPhysicalNodeBase
+{
+public:
+	CPhysicalNodeState(const CFloatPoint& nodeLocation, const CVector& velocityVector,
+		const ScalarType nodeMass, const bool bIsAnchorNode);
+	~CPhysicalNodeState();
+};
+
+
+// Describes a batch of nodes whose state is stored within component arrays (the
+// arrays are owned by the client, and must contain at least mNodeCount elements),
+// permitting external forces to be evaluated for many nodes at once.
+class CExternalForceNodeBatch
+{
+public:
+	CExternalForceNodeBatch(
+		const QuantityType nodeCount,
+		const ScalarType* pNodeLocationX,
+		const ScalarType* pNodeLocationY,
+		const ScalarType* pNodeLocationZ,
+		const ScalarType* pNodeVelocityX,
+		const ScalarType* pNodeVelocityY,
+		const ScalarType* pNodeVelocityZ,
+		const ScalarType* pNodeMass,
+		ScalarType* pNodeForceX,
+		ScalarType* pNodeForceY,
+		ScalarType* pNodeForceZ);
+	~CExternalForceNodeBatch();
+
+	QuantityType					mNodeCount;
+
+	// Node locations, velocities and masses.
+	const ScalarType*				mpNodeLocationX;
+	const ScalarType*				mpNodeLocationY;
+	const ScalarType*				mpNodeLocationZ;
+	const ScalarType*				mpNodeVelocityX;
+	const ScalarType*				mpNodeVelocityY;
+	const ScalarType*				mpNodeVelocityZ;
+	const ScalarType*				mpNodeMass;
+
+	// Forces (N) generated for the nodes.
+	ScalarType*						mpNodeForceX;
+	ScalarType*						mpNodeForceY;
+	ScalarType*						mpNodeForceZ;
+};
+
+
+// Describes a rectangular grid of nodes whose state is stored within component arrays
+// (row-major order - the arrays are owned by the client, and must contain an element
+// for every grid node), permitting forces that depend upon the cloth surface to be
+// evaluated. Each grid cell is divided into two triangles.
+class CExternalForceNodeGrid
+{
+public:
+	CExternalForceNodeGrid(
+		const QuantityType nodesPerRow,
+		const QuantityType nodesPerColumn,
+		const ScalarType* pNodeLocationX,
+		const ScalarType* pNodeLocationY,
+		const ScalarType* pNodeLocationZ,
+		const ScalarType* pNodeVelocityX,
+		const ScalarType* pNodeVelocityY,
+		const ScalarType* pNodeVelocityZ,
+		ScalarType* pNodeForceX,
+		ScalarType* pNodeForceY,
+		ScalarType* pNodeForceZ);
+	~CExternalForceNodeGrid();
+
+	// Grid dimensions.
+	QuantityType					mNodesPerRow;
+	QuantityType					mNodesPerColumn;
+
+	// Node locations and velocities.
+	const ScalarType*				mpNodeLocationX;
+	const ScalarType*				mpNodeLocationY;
+	const ScalarType*				mpNodeLocationZ;
+	const ScalarType*				mpNodeVelocityX;
+	const ScalarType*				mpNodeVelocityY;
+	const ScalarType*				mpNodeVelocityZ;
+
+	// Forces (N) generated for the nodes.
+	ScalarType*						mpNodeForceX;
+	ScalarType*						mpNodeForceY;
+	ScalarType*						mpNodeForceZ;
+};
+
+
+// Stages the state of a node grid for surface force evaluation (used by networks that
+// do not store node state within ScalarType component arrays).
+class CExternalForceGridBuffer
+{
+public:
+	CExternalForceGridBuffer();
+	~CExternalForceGridBuffer();
+
+	// Sizes the component arrays for a grid of the specified dimensions (the array
+	// contents are not initialized).
+	void							AllocateGrid(const QuantityType nodesPerRow,
+		const QuantityType nodesPerColumn);
+
+	// Presents the component arrays as a node grid.
+	CExternalForceNodeGrid			GetNodeGrid();
+
+	// Type definition - component array (one element per grid node).
+	typedef std::vector<ScalarType>	ComponentArrayType;
+
+	// Grid dimensions.
+	QuantityType					mNodesPerRow;
+	QuantityType					mNodesPerColumn;
+
+	// Node locations and velocities (row-major order).
+	ComponentArrayType				mNodeLocationX;
+	ComponentArrayType				mNodeLocationY;
+	ComponentArrayType				mNodeLocationZ;
+	ComponentArrayType				mNodeVelocityX;
+	ComponentArrayType				mNodeVelocityY;
+	ComponentArrayType				mNodeVelocityZ;
+
+	// Surface forces (N) generated for the nodes.
+	ComponentArrayType				mNodeForceX;
+	ComponentArrayType				mNodeForceY;
+	ComponentArrayType				mNodeForceZ;
+};
+
+
 class CExternalNodeForce
 {
 public:
@@ -85,6 +238,12 @@ public:
 	virtual bool					GenerateExternalForceVector(
 		const CPhysicalNodeBase& targetNode, CVector& forceVector) const = 0;
 
+	// Generates the instantaneous forces to be applied to a batch of nodes, adding
+	// each force to the batch force arrays - by default, each node is evaluated
+	// individually with GenerateExternalForceVector.
+	virtual bool					AccumulateExternalForceVectors(
+		const CExternalForceNodeBatch& nodeBatch) const;
+
 	// Determines if the external node force generator class is valid
 	// in accordance with its defining parameters.
 	virtual bool					IsValid() const;
@@ -95,6 +254,26 @@ protected:
 
 };
 
+
+// External force that is determined by the shape of the cloth surface (rather than by
+// the state of each node in isolation) - forces are evaluated for an entire node grid.
+class CExternalSurfaceForce
+{
+public:
+	CExternalSurfaceForce();
+	virtual ~CExternalSurfaceForce();
+
+	// Generates the instantaneous forces to be applied to the nodes of a grid, adding
+	// each force to the grid force arrays.
+	virtual bool					AccumulateSurfaceForceVectors(
+		const CExternalForceNodeGrid& nodeGrid) const = 0;
+
+	// Determines if the external surface force generator class is valid
+	// in accordance with its defining parameters.
+	virtual bool					IsValid() const;
+};
+
+
 class CExternalNodeForceCollection
 {
 public:
@@ -110,6 +289,23 @@ public:
 	bool EvaluateExternalForces(const CPhysicalNodeBase& targetNode,
 		CVector& forceVector, const ScalarType timeQuantum) const;
 
+	// Evaluates all contained external forces for a batch of nodes (the batch force
+	// arrays receive the sum of the forces applied to each node).
+	bool EvaluateExternalForces(const CExternalForceNodeBatch& nodeBatch,
+		const ScalarType timeQuantum) const;
+
+	// Adds an external surface force evaluator to the collection of forces
+	// to be evaluated.
+	bool AddExternalSurfaceForce(CExternalSurfaceForce& externalSurfaceForce);
+
+	// Determines if the collection contains surface forces (networks need only
+	// present their node grids when surface forces are present).
+	bool HasSurfaceForces() const;
+
+	// Evaluates all contained surface forces for a node grid (the grid force arrays
+	// receive the sum of the surface forces applied to each node).
+	bool EvaluateSurfaceForces(const CExternalForceNodeGrid& nodeGrid) const;
+
 protected:
 
 
@@ -121,6 +317,14 @@ protected:
 
 	// Collection of external forces.
 	ExternalForceListType			mExternalForceList;
+
+	// Type definition - list of surface forces that will be applied to a
+	// node grid.
+	typedef std::vector<CExternalSurfaceForce*>
+									SurfaceForceListType;
+
+	// Collection of surface forces.
+	SurfaceForceListType			mSurfaceForceList;
 };
 
 
@@ -445,6 +445,12 @@ const CBaseTextureData*	CTextureCollection::GetTextureLayer(const IndexType text
 	return(pBaseTextureData);
 }
 
+void CTextureCollection::SwapTextureLayers(CTextureCollection& textureCollection)
+{
+	// Exchange the list contents (only the internal list storage is exchanged).
+	this->mTextureList.swap(textureCollection.mTextureList);
+}
+
 
 /////
 // CVector class
@@ -747,7 +753,7 @@ bool CFloatPolygon::DeleteVertex(const IndexType vertexIndex)
 }
 
 
-CFloatColor	CFloatPolygon::GetLightShading(const EBasicLightShading lightShadingType)
+CFloatColor	CFloatPolygon::GetLightShading(const EBasicLightShading lightShadingType) const
 {
 	CFloatColor						shadingColor(0.0, 0.0, 0.0);
 
@@ -899,17 +905,23 @@ bool CVertexGrid::GeneratePolygonsFromGrid(PolygonList& polygonList,
 		(gridHeight > 1))
 	{
 		for(IndexType heightLoop = 0; heightLoop < (gridHeight - 1); heightLoop++) {
-			for(IndexType widthLoop = 0; widthLoop < (gridWidth - 1); widthLoop++) {
+			//Vertices within each row are contiguous (row-major grid storage).
+			const CPolygonVertex*	pUpperVertexRow = this->mVertexGrid.GetRowSpan(heightLoop);
+			const CPolygonVertex*	pLowerVertexRow = this->mVertexGrid.GetRowSpan(heightLoop + 1);
+
+			for(IndexType widthLoop = 0; pUpperVertexRow && pLowerVertexRow &&
+				(widthLoop < (gridWidth - 1)); widthLoop++)
+			{
 				//Obtain a group of vertices that constitute a rectangular region
 				//(quadratic patch in three-dimensional space)...
-				const CPolygonVertex
-					upperLeft = *(this->mVertexGrid.GetElementAt(widthLoop, heightLoop));
-				const CPolygonVertex
-					upperRight = *(this->mVertexGrid.GetElementAt(widthLoop + 1, heightLoop));
-				const CPolygonVertex
-					lowerLeft = *(this->mVertexGrid.GetElementAt(widthLoop, heightLoop + 1));
-				const CPolygonVertex
-					lowerRight = *(this->mVertexGrid.GetElementAt(widthLoop + 1, heightLoop + 1));
+				const CPolygonVertex&
+					upperLeft = pUpperVertexRow[widthLoop];
+				const CPolygonVertex&
+					upperRight = pUpperVertexRow[widthLoop + 1];
+				const CPolygonVertex&
+					lowerLeft = pLowerVertexRow[widthLoop];
+				const CPolygonVertex&
+					lowerRight = pLowerVertexRow[widthLoop + 1];
 
 				//Create two triangles from the rectangle.
 				CFloatPolygon		firstPolygon;
@@ -232,6 +232,9 @@ public:
 	// Retrieves texture information for a specified texture layer.
 	const CBaseTextureData*			GetTextureLayer(const IndexType textureLayer) const;
 
+	// Exchanges the texture layers of two collections (no texture data is copied).
+	void							SwapTextureLayers(CTextureCollection& textureCollection);
+
 protected:
 
 	typedef std::vector<CBaseTextureData>
@@ -379,12 +382,21 @@ public:
 	//polygon vertices.
 	bool						DeleteVertex(const IndexType vertexIndex);
 
-	//!!!Temporary
-	VertexList					GetVertexList() const {return(mVertexList);}
+	//Construct that provides read-only access to the vertices without copying them.
+	typedef CConstArrayView<CPolygonVertex>
+								VertexView;
+
+	//Retrieves the vertex list of the polygon (the reference remains valid until the
+	//polygon is modified or destroyed).
+	const VertexList&			GetVertexList() const {return(this->mVertexList);}
+
+	//Retrieves a read-only view of the polygon vertices (the view remains valid until the
+	//polygon is modified or destroyed).
+	VertexView					GetVertexView() const {return(VertexView(this->mVertexList));}
 
 
 	//Retrieves the surface color contribution for the particular basic lighting model.
-	CFloatColor					GetLightShading(const EBasicLightShading lightShadingType);
+	CFloatColor					GetLightShading(const EBasicLightShading lightShadingType) const;
 
 	//Sets the surface color for the particular basic lighting model.
 	void						SetLightShading(const EBasicLightShading lightShadingType,
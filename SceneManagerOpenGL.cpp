@@ -23,17 +23,49 @@ void CSceneManagerOpenGL::ExecuteSceneManagerStep()
 
 		//Determine if the current scene should be switched...
 		if(currentSceneTime < CSceneManagerOpenGL::mSceneDuration) {
-			//Enforce the update rate limit (frame rate limiter).
-			if(CSceneManagerOpenGL::ComputeCountDuration(CSceneManagerOpenGL::mSceneUpdateTimeReference) >
+			//Accumulate the time elapsed since the previous iteration...
+			CSceneManagerOpenGL::mSceneUpdateTimeAccumulator +=
+				CSceneManagerOpenGL::ComputeCountDuration(CSceneManagerOpenGL::mSceneUpdateTimeReference);
+			//Set the scene update time reference.
+			CSceneManagerOpenGL::mSceneUpdateTimeReference =
+				CSceneManagerOpenGL::GetCurrentClockCount();
+
+			//...Execute a scene step for each complete update period (scene updates are
+			//decoupled from the display refresh rate - each step receives the scene time at
+			//the end of its update period, which precedes the current scene time by the
+			//time that remains unconsumed)...
+			QuantityType			updateCount = 0;
+
+			while((CSceneManagerOpenGL::mSceneUpdateTimeAccumulator >=
+				CSceneManagerOpenGL::mSceneUpdateRate) &&
+				(updateCount < CSceneManagerOpenGL::mkMaximumUpdatesPerRefresh))
+			{
+				CSceneManagerOpenGL::mSceneUpdateTimeAccumulator -=
+					CSceneManagerOpenGL::mSceneUpdateRate;
+
+				const QuantityType	updateSceneTime = (currentSceneTime >
+					CSceneManagerOpenGL::mSceneUpdateTimeAccumulator) ? (currentSceneTime -
+					CSceneManagerOpenGL::mSceneUpdateTimeAccumulator) : 0;
+
+				CSceneManagerOpenGL::ExecuteCurrentSceneStep(updateSceneTime);
+				updateCount++;
+			}
+
+			//(Discard complete periods that could not be consumed, preventing the
+			//scene from falling progressively further behind)...
+			if(CSceneManagerOpenGL::mSceneUpdateTimeAccumulator >=
 				CSceneManagerOpenGL::mSceneUpdateRate)
 			{
-				//Set the scene update time reference.
-				CSceneManagerOpenGL::mSceneUpdateTimeReference =
-					CSceneManagerOpenGL::GetCurrentClockCount();
-				//Execute a scene step.
-				CSceneManagerOpenGL::ExecuteCurrentSceneStep(currentSceneTime);
+				CSceneManagerOpenGL::mSceneUpdateTimeAccumulator %=
+					CSceneManagerOpenGL::mSceneUpdateRate;
 			}
 
+			//...And interpolate the rendered scene state by the remaining fraction of an
+			//update period.
+			(*CSceneManagerOpenGL::mCurrentScene)->SetStateInterpolation(
+				(ScalarType)CSceneManagerOpenGL::mSceneUpdateTimeAccumulator /
+				(ScalarType)CSceneManagerOpenGL::mSceneUpdateRate);
+
 			//Update the OpenGL camera.
 			//CSceneManagerOpenGL::UpdateSceneCamera(
 			//	(*CSceneManagerOpenGL::mCurrentScene)->GetSceneCamera());
@@ -118,19 +150,28 @@ void CSceneManagerOpenGL::SetTransitionDuration(const QuantityType transitionDur
 
 
 //Sets the target/maximum scene refresh rate.
-void CSceneManagerOpenGL::SetUpdateRate(const QuantityType updateRate)
+bool CSceneManagerOpenGL::SetUpdateRate(const QuantityType updateRate)
 {
-	//Wait for the scene manager resources to become available....
-	while (CSceneManagerOpenGL::IsSceneManagerDataLocked()) { }
+	bool							bUpdateRateSetSuccessfully = false;
 
-	//Acquire exclusive access to scene manager resources.
-	CSceneManagerOpenGL::LockSceneManagerData();
+	//Scene updates are executed in fixed steps of the update rate, which must be non-zero.
+	if (updateRate != 0) {
+		//Wait for the scene manager resources to become available....
+		while (CSceneManagerOpenGL::IsSceneManagerDataLocked()) { }
 
-	//Set the delay between scene updates.
-	CSceneManagerOpenGL::mSceneUpdateRate = updateRate;
+		//Acquire exclusive access to scene manager resources.
+		CSceneManagerOpenGL::LockSceneManagerData();
 
-	//Relinquish control of the scene manager resources.
-	CSceneManagerOpenGL::UnlockSceneManagerData();
+		//Set the delay between scene updates.
+		CSceneManagerOpenGL::mSceneUpdateRate = updateRate;
+
+		bUpdateRateSetSuccessfully = true;
+
+		//Relinquish control of the scene manager resources.
+		CSceneManagerOpenGL::UnlockSceneManagerData();
+	}
+
+	return(bUpdateRateSetSuccessfully);
 }
 
 
@@ -307,6 +348,11 @@ bool CSceneManagerOpenGL::StartCurrentScene()
 	CSceneManagerOpenGL::mCurrentSceneStartTime =
 		CSceneManagerOpenGL::GetCurrentClockCount();
 
+	//Scene updates commence from the scene start time.
+	CSceneManagerOpenGL::mSceneUpdateTimeReference =
+		CSceneManagerOpenGL::mCurrentSceneStartTime;
+	CSceneManagerOpenGL::mSceneUpdateTimeAccumulator = 0;
+
 
 	return(bStartedSuccessfully);
 }
@@ -454,6 +500,12 @@ QuantityType						CSceneManagerOpenGL::mSceneUpdateRate = 0;
 //Time reference used to compute time since last scene refresh (milliseconds).
 QuantityType						CSceneManagerOpenGL::mSceneUpdateTimeReference = 0;
 
+//Elapsed time that has not yet been consumed by scene updates (milliseconds).
+QuantityType						CSceneManagerOpenGL::mSceneUpdateTimeAccumulator = 0;
+
+//Maximum number of scene updates performed before each display refresh.
+const QuantityType					CSceneManagerOpenGL::mkMaximumUpdatesPerRefresh = 5;
+
 //Internal list of OpenGL scenes.
 CSceneManagerOpenGL::SceneList		CSceneManagerOpenGL::mSceneList;
 
@@ -22,8 +22,10 @@ public:
 	//Sets the scene transition duration (independent of scene duration).
 	static void						SetTransitionDuration(const QuantityType transitionDuration);
 
-	//Sets the target/maximum scene refresh rate.
-	static void						SetUpdateRate(const QuantityType updateRate);
+	//Sets the target/maximum scene refresh rate (milliseconds between scene updates - a
+	//rate of zero is rejected, and the scene manager cannot be started until a rate has
+	//been set).
+	static bool						SetUpdateRate(const QuantityType updateRate);
 
 	//Initializes the scene manager, and commences scene manager execution.
 	static bool						StartSceneManager();
@@ -101,6 +103,14 @@ protected:
 	//Time reference used to compute time since last scene refresh (milliseconds).
 	static QuantityType				mSceneUpdateTimeReference;
 
+	//Elapsed time that has not yet been consumed by scene updates (milliseconds - scenes
+	//are updated in fixed steps of the update rate).
+	static QuantityType				mSceneUpdateTimeAccumulator;
+
+	//Maximum number of scene updates performed before each display refresh (unconsumed
+	//time is discarded beyond this limit).
+	static const QuantityType		mkMaximumUpdatesPerRefresh;
+
 	//Type definition - list of OpenGL scenes.
 	typedef std::vector<CSceneOpenGL*>
 									SceneList;
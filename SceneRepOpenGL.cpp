@@ -216,6 +216,13 @@ bool CSceneOpenGL::UpdateScene(const QuantityType currentClockTick)
 {
 	return(false);
 }
+
+//Sets the fraction of the next update period that has elapsed when the scene is rendered.
+bool CSceneOpenGL::SetStateInterpolation(const ScalarType interpolationFactor)
+{
+	//Scenes render their most recent state by default.
+	return(false);
+}
 	
 //Retrieves the current camera configuration specified by the scene.
 const CSceneCameraOpenGL& CSceneOpenGL::GetSceneCamera() const
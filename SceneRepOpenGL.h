@@ -155,6 +155,10 @@ public:
 	//Renders the scene (does not perform a flush or buffer swap).
 	virtual bool					RenderScene() const = 0;
 
+	//Sets the fraction (0.0 - 1.0) of the next update period that has elapsed when the
+	//scene is rendered (scenes may interpolate between their two most recent states).
+	virtual bool					SetStateInterpolation(const ScalarType interpolationFactor);
+
 	//Adds a transition object to the scene.
 	bool							SetTransition(const CSceneTransitionOpenGL& sceneTransition);
 
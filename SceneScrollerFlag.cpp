@@ -26,22 +26,25 @@ bool CSceneScrollerFlag::InitializeScene()
 	bool							bSceneInitializedSuccessfully = false;
 
 	// Set the time quantum used for force application calculations.
-	this->mClothNodeNetwork.SetForceTimeQuantum(mkFlagSceneConstants.mSimulationTimeQuantum);
+	this->mpClothNetwork->SetForceTimeQuantum(mkFlagSceneConstants.mSimulationTimeQuantum);
 
 	// Set the flag color and specularity values (for rendering).
-	this->mClothNodeNetwork.SetClothBaseColor(mkFlagSceneConstants.mClothColor);
-	this->mClothNodeNetwork.SetClothSpecularity(mkFlagSceneConstants.mClothSpecularity);
+	this->mpClothNetwork->SetClothBaseColor(mkFlagSceneConstants.mClothColor);
+	this->mpClothNetwork->SetClothSpecularity(mkFlagSceneConstants.mClothSpecularity);
 
 	// Set the nodes on the left side of the flag to be anchor nodes.
 	for (IndexType anchorNodeSetLoop = 0;
 		anchorNodeSetLoop < this->mkFlagSceneConstants.mNodesPerColumn;
 		anchorNodeSetLoop++)
 	{
-		this->mClothNodeNetwork.SetAnchorNode(0, anchorNodeSetLoop, true);
+		this->mpClothNetwork->SetAnchorNode(0, anchorNodeSetLoop, true);
 	}
 	
+	// Create the cloth mesh.
+	bSceneInitializedSuccessfully = this->SetupClothMesh();
+
 	// Create the scene backdrop.
-	bSceneInitializedSuccessfully = this->SetupBackDrop();
+	bSceneInitializedSuccessfully = this->SetupBackDrop() && bSceneInitializedSuccessfully;
 
 	return(bSceneInitializedSuccessfully);
 }
@@ -117,9 +120,8 @@ bool CSceneScrollerFlag::UpdateScene(const QuantityType currentClockTick)
 
 	this->mWindForce.SetAlterationConstant(currentClockTick);
 
-	// Perform a cloth network simulation step.
-	bUpdatedSuccessfully =
-		this->mClothNodeNetwork.EvaluateClothNodeNetworkForces(this->mExternalForceCollection);
+	// Advance the cloth network simulation by one update period.
+	bUpdatedSuccessfully = this->AdvanceClothNetwork();
 	
 	return(bUpdatedSuccessfully);
 }
@@ -25,11 +25,11 @@ bool CSceneScrollerRisingCloth::InitializeScene()
 	bool							bSceneInitializedSuccessfully = false;
 
 	// Set the time quantum used for force application calculations.
-	this->mClothNodeNetwork.SetForceTimeQuantum(mkRisingClothSceneConstants.mSimulationTimeQuantum);
+	this->mpClothNetwork->SetForceTimeQuantum(mkRisingClothSceneConstants.mSimulationTimeQuantum);
 
 	// Set the rising cloth color and specularity values (for rendering).
-	this->mClothNodeNetwork.SetClothBaseColor(mkRisingClothSceneConstants.mClothColor);
-	this->mClothNodeNetwork.SetClothSpecularity(mkRisingClothSceneConstants.mClothSpecularity);
+	this->mpClothNetwork->SetClothBaseColor(mkRisingClothSceneConstants.mClothColor);
+	this->mpClothNetwork->SetClothSpecularity(mkRisingClothSceneConstants.mClothSpecularity);
 
 
 	// Set the nodes on the bottom of the cloth to be anchor nodes.
@@ -37,11 +37,14 @@ bool CSceneScrollerRisingCloth::InitializeScene()
 		anchorNodeSetLoop < this->mkRisingClothSceneConstants.mNodesPerRow;
 		anchorNodeSetLoop++)
 	{
-		this->mClothNodeNetwork.SetAnchorNode(anchorNodeSetLoop, 0, true);
+		this->mpClothNetwork->SetAnchorNode(anchorNodeSetLoop, 0, true);
 	}
 
+	// Create the cloth mesh.
+	bSceneInitializedSuccessfully = this->SetupClothMesh();
+
 	// Create the scene backdrop.
-	bSceneInitializedSuccessfully = this->SetupBackDrop();
+	bSceneInitializedSuccessfully = this->SetupBackDrop() && bSceneInitializedSuccessfully;
 
 	return(bSceneInitializedSuccessfully);
 }
@@ -116,9 +119,8 @@ bool CSceneScrollerRisingCloth::UpdateScene(const QuantityType currentClockTick)
 
 	this->mWindForce.SetAlterationConstant(currentClockTick);
 
-	// Perform a cloth network simulation step.
-	bUpdatedSuccessfully =
-		this->mClothNodeNetwork.EvaluateClothNodeNetworkForces(this->mExternalForceCollection);
+	// Advance the cloth network simulation by one update period.
+	bUpdatedSuccessfully = this->AdvanceClothNetwork();
 
 	return(bUpdatedSuccessfully);
 }
@@ -25,11 +25,15 @@ bool CSceneScrollerTapestry::InitializeScene()
 	bool							bSceneInitializedSuccessfully = false;
 
 	// Set the time quantum used for force application calculations.
-	this->mClothNodeNetwork.SetForceTimeQuantum(mkTapestrySceneConstants.mSimulationTimeQuantum);
+	this->mpClothNetwork->SetForceTimeQuantum(mkTapestrySceneConstants.mSimulationTimeQuantum);
 
 	// Set the tapestry color and specularity values (for rendering).
-	this->mClothNodeNetwork.SetClothBaseColor(mkTapestrySceneConstants.mClothColor);
-	this->mClothNodeNetwork.SetClothSpecularity(mkTapestrySceneConstants.mClothSpecularity);
+	this->mpClothNetwork->SetClothBaseColor(mkTapestrySceneConstants.mClothColor);
+	this->mpClothNetwork->SetClothSpecularity(mkTapestrySceneConstants.mClothSpecularity);
+
+	// Stop evaluating regions of the cloth that have come to rest.
+	::AssertExpression(this->mpClothNetwork->SetSleepThreshold(mkSleepEnergyThreshold,
+		mkSleepStepCount));
 
 
 	// Set the nodes on the top of the tapestry to be anchor nodes.
@@ -37,12 +41,15 @@ bool CSceneScrollerTapestry::InitializeScene()
 		anchorNodeSetLoop < this->mkTapestrySceneConstants.mNodesPerRow;
 		anchorNodeSetLoop++)
 	{
-		this->mClothNodeNetwork.SetAnchorNode(anchorNodeSetLoop, 
+		this->mpClothNetwork->SetAnchorNode(anchorNodeSetLoop, 
 			(this->mkTapestrySceneConstants.mNodesPerColumn - 1), true);
 	}
 
+	// Create the cloth mesh.
+	bSceneInitializedSuccessfully = this->SetupClothMesh();
+
 	// Create the scene backdrop.
-	bSceneInitializedSuccessfully = this->SetupBackDrop();
+	bSceneInitializedSuccessfully = this->SetupBackDrop() && bSceneInitializedSuccessfully;
 
 	return(bSceneInitializedSuccessfully);
 }
@@ -119,9 +126,8 @@ bool CSceneScrollerTapestry::UpdateScene(const QuantityType currentClockTick)
 
 	this->mWindForce.SetAlterationConstant(currentClockTick);
 
-	// Perform a cloth network simulation step.
-	bUpdatedSuccessfully =
-		this->mClothNodeNetwork.EvaluateClothNodeNetworkForces(this->mExternalForceCollection);
+	// Advance the cloth network simulation by one update period.
+	bUpdatedSuccessfully = this->AdvanceClothNetwork();
 	
 	return(bUpdatedSuccessfully);
 }
@@ -164,4 +170,10 @@ const CBaseClothScrollerSceneParamBlock
 		0.4,										// Wind magnitude
         CVector(0.0, 1.0, 1.0),						// Wind direction
 		0.01,										// Viscous drag coefficient
-		CFloatColor(0.4, 0.4, 0.4));				// Backdrop cylinder color.
\ No newline at end of file
+		CFloatColor(0.4, 0.4, 0.4));				// Backdrop cylinder color.
+
+// Mean kinetic energy per node below which regions of the cloth are at rest.
+const ScalarType					CSceneScrollerTapestry::mkSleepEnergyThreshold = 0.000001;
+
+// Number of steps at rest after which regions of the cloth are no longer evaluated.
+const QuantityType					CSceneScrollerTapestry::mkSleepStepCount = 30;
@@ -23,27 +23,30 @@ bool CSceneScrollerTeatheredCloth::InitializeScene()
 	bool							bSceneInitializedSuccessfully = false;
 
 	// Set the time quantum used for force application calculations.
-	this->mClothNodeNetwork.SetForceTimeQuantum(mkTeatheredClothSceneConstants.mSimulationTimeQuantum);
+	this->mpClothNetwork->SetForceTimeQuantum(mkTeatheredClothSceneConstants.mSimulationTimeQuantum);
 
 	// Set the teathered cloth color and specularity values (for rendering).
-	this->mClothNodeNetwork.SetClothBaseColor(mkTeatheredClothSceneConstants.mClothColor);
-	this->mClothNodeNetwork.SetClothSpecularity(mkTeatheredClothSceneConstants.mClothSpecularity);
+	this->mpClothNetwork->SetClothBaseColor(mkTeatheredClothSceneConstants.mClothColor);
+	this->mpClothNetwork->SetClothSpecularity(mkTeatheredClothSceneConstants.mClothSpecularity);
 
 	// Set the nodes at the corners of the flag node network to be anchor nodes.
 
 	bSceneInitializedSuccessfully =
-		this->mClothNodeNetwork.SetAnchorNode(0, 0, true) &&
+		this->mpClothNetwork->SetAnchorNode(0, 0, true) &&
 
-		this->mClothNodeNetwork.SetAnchorNode(this->mkTeatheredClothSceneConstants.mNodesPerRow - 1,
+		this->mpClothNetwork->SetAnchorNode(this->mkTeatheredClothSceneConstants.mNodesPerRow - 1,
 			0, true) &&
 
-		this->mClothNodeNetwork.SetAnchorNode(0, this->mkTeatheredClothSceneConstants.mNodesPerColumn - 1,
+		this->mpClothNetwork->SetAnchorNode(0, this->mkTeatheredClothSceneConstants.mNodesPerColumn - 1,
 			true) &&
 
-		this->mClothNodeNetwork.SetAnchorNode(this->mkTeatheredClothSceneConstants.mNodesPerRow - 1,
+		this->mpClothNetwork->SetAnchorNode(this->mkTeatheredClothSceneConstants.mNodesPerRow - 1,
 			this->mkTeatheredClothSceneConstants.mNodesPerColumn - 1,
 			true);
 
+	// Create the cloth mesh.
+	bSceneInitializedSuccessfully = this->SetupClothMesh() && bSceneInitializedSuccessfully;
+
 	// Create the scene backdrop.
 	bSceneInitializedSuccessfully = this->SetupBackDrop() && bSceneInitializedSuccessfully;
 
@@ -121,9 +124,8 @@ bool CSceneScrollerTeatheredCloth::UpdateScene(const QuantityType currentClockTi
 
 	this->mWindForce.SetAlterationConstant(currentClockTick);
 
-	// Perform a cloth network simulation step.
-	bUpdatedSuccessfully =
-		this->mClothNodeNetwork.EvaluateClothNodeNetworkForces(this->mExternalForceCollection);
+	// Advance the cloth network simulation by one update period.
+	bUpdatedSuccessfully = this->AdvanceClothNetwork();
 	
 	return(bUpdatedSuccessfully);
 }
@@ -22,11 +22,15 @@ bool CSceneScrollerTrampoline::InitializeScene()
 	bool							bSceneInitializedSuccessfully = false;
 
 	// Set the time quantum used for force application calculations.
-	this->mClothNodeNetwork.SetForceTimeQuantum(mkTrampolineSceneConstants.mSimulationTimeQuantum);
+	this->mpClothNetwork->SetForceTimeQuantum(mkTrampolineSceneConstants.mSimulationTimeQuantum);
 
 	// Set the rising cloth color and specularity values (for rendering).
-	this->mClothNodeNetwork.SetClothBaseColor(mkTrampolineSceneConstants.mClothColor);
-	this->mClothNodeNetwork.SetClothSpecularity(mkTrampolineSceneConstants.mClothSpecularity);
+	this->mpClothNetwork->SetClothBaseColor(mkTrampolineSceneConstants.mClothColor);
+	this->mpClothNetwork->SetClothSpecularity(mkTrampolineSceneConstants.mClothSpecularity);
+
+	// Stop evaluating regions of the cloth that have come to rest.
+	::AssertExpression(this->mpClothNetwork->SetSleepThreshold(mkSleepEnergyThreshold,
+		mkSleepStepCount));
 
 
 	// Set the nodes on the bottom of the cloth to be anchor nodes.
@@ -34,8 +38,8 @@ bool CSceneScrollerTrampoline::InitializeScene()
 		anchorNodeSetLoopRow < this->mkTrampolineSceneConstants.mNodesPerRow - 1;
 		anchorNodeSetLoopRow++)
 	{
-		this->mClothNodeNetwork.SetAnchorNode(anchorNodeSetLoopRow, 0, true);
-		this->mClothNodeNetwork.SetAnchorNode(anchorNodeSetLoopRow, 
+		this->mpClothNetwork->SetAnchorNode(anchorNodeSetLoopRow, 0, true);
+		this->mpClothNetwork->SetAnchorNode(anchorNodeSetLoopRow, 
 			this->mkTrampolineSceneConstants.mNodesPerColumn - 1, true);
 	}
 
@@ -43,14 +47,17 @@ bool CSceneScrollerTrampoline::InitializeScene()
 		anchorNodeSetLoopColumn < this->mkTrampolineSceneConstants.mNodesPerColumn;
 		anchorNodeSetLoopColumn++)
 	{
-		this->mClothNodeNetwork.SetAnchorNode(0, anchorNodeSetLoopColumn, true);
-		this->mClothNodeNetwork.SetAnchorNode(
+		this->mpClothNetwork->SetAnchorNode(0, anchorNodeSetLoopColumn, true);
+		this->mpClothNetwork->SetAnchorNode(
 			this->mkTrampolineSceneConstants.mNodesPerColumn - 1,
 			anchorNodeSetLoopColumn, true);
 	}
 		
+	// Create the cloth mesh.
+	bSceneInitializedSuccessfully = this->SetupClothMesh();
+
 	// Create the scene backdrop.
-	bSceneInitializedSuccessfully = this->SetupBackDrop();
+	bSceneInitializedSuccessfully = this->SetupBackDrop() && bSceneInitializedSuccessfully;
 
 	return(bSceneInitializedSuccessfully);
 }
@@ -127,9 +134,8 @@ bool CSceneScrollerTrampoline::UpdateScene(const QuantityType currentClockTick)
 
 	this->mWindForce.SetAlterationConstant(currentClockTick);
 
-	// Perform a cloth network simulation step.
-	bUpdatedSuccessfully =
-		this->mClothNodeNetwork.EvaluateClothNodeNetworkForces(this->mExternalForceCollection);
+	// Advance the cloth network simulation by one update period.
+	bUpdatedSuccessfully = this->AdvanceClothNetwork();
 
 	return(bUpdatedSuccessfully);
 }
@@ -171,3 +177,9 @@ const CBaseClothScrollerSceneParamBlock
         CVector(0.0, 0.0, 1.0),						// Wind direction
 		0.02,										// Viscous drag coefficient
 		CFloatColor(0.0, 0.0, 0.8));				// Backdrop cylinder color.
+
+// Mean kinetic energy per node below which regions of the cloth are at rest.
+const ScalarType					CSceneScrollerTrampoline::mkSleepEnergyThreshold = 0.000001;
+
+// Number of steps at rest after which regions of the cloth are no longer evaluated.
+const QuantityType					CSceneScrollerTrampoline::mkSleepStepCount = 30;
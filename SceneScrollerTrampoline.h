@@ -34,6 +34,11 @@ protected:
 	// Rising cloth scene constants.
 	static const CBaseClothScrollerSceneParamBlock
 									mkTrampolineSceneConstants;
+
+	// Mean kinetic energy per node (J) below which regions of the cloth are at rest, and
+	// the number of steps at rest after which the regions are no longer evaluated.
+	static const ScalarType			mkSleepEnergyThreshold;
+	static const QuantityType		mkSleepStepCount;
 };
 
 
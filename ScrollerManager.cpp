@@ -43,6 +43,7 @@ bool CScrollerManager::InitializeScrollerManager(const std::string& messageFile,
 
 			// Add scroller lead-in spacing...
 			CScrollerManager::ApplyLeadInPixelOffset();
+			CScrollerManager::mScrollerImageRevision++;
 
 			// ...Indicate a success condition.
 			bManagerInitializedSuccessfully = true;
@@ -85,6 +86,8 @@ bool CScrollerManager::IncrementScroller()
 		// perform the incrementing as appropriate.
 		CScrollerManager::AdjustScrollerIndex();
 
+		CScrollerManager::mScrollerImageRevision++;
+
 		bIncrementedSuccessfully = true;
 	}
 
@@ -154,15 +157,31 @@ bool CScrollerManager::GetScrollerImageFormat(QuantityType& imageWidth,
 
 void CScrollerManager::SetScrollerTextColor(const CFloatColor& scrollerTextColor)
 {
-	// Set the scroller text color.
-	CScrollerManager::mScrollerTextColor = scrollerTextColor;
+	// Set the scroller text color (the image changes only if the color differs).
+	if (!CScrollerManager::AreColorsEqual(CScrollerManager::mScrollerTextColor,
+		scrollerTextColor))
+	{
+		CScrollerManager::mScrollerTextColor = scrollerTextColor;
+		CScrollerManager::mScrollerImageRevision++;
+	}
 }
 
 
 void CScrollerManager::SetScrollerBackgroundColor(const CFloatColor& backgroundColor)
 {
-	// Set the scroller background color.
-	CScrollerManager::mBackgroundColor = backgroundColor;
+	// Set the scroller background color (the image changes only if the color differs).
+	if (!CScrollerManager::AreColorsEqual(CScrollerManager::mBackgroundColor,
+		backgroundColor))
+	{
+		CScrollerManager::mBackgroundColor = backgroundColor;
+		CScrollerManager::mScrollerImageRevision++;
+	}
+}
+
+
+QuantityType CScrollerManager::GetScrollerImageRevision()
+{
+	return(CScrollerManager::mScrollerImageRevision);
 }
 
 bool CScrollerManager::IsValid()
@@ -174,6 +193,16 @@ bool CScrollerManager::IsValid()
 }
 
 
+bool CScrollerManager::AreColorsEqual(const CFloatColor& firstColor,
+									  const CFloatColor& secondColor)
+{
+	return((firstColor.GetRedValue() == secondColor.GetRedValue()) &&
+		(firstColor.GetGreenValue() == secondColor.GetGreenValue()) &&
+		(firstColor.GetBlueValue() == secondColor.GetBlueValue()) &&
+		(firstColor.GetAlphaValue() == secondColor.GetAlphaValue()));
+}
+
+
 void CScrollerManager::AdjustScrollerIndex()
 {
 	std::string						leadCharacterString;
@@ -266,4 +295,6 @@ CFloatColor							CScrollerManager::mScrollerTextColor = CFloatColor(0.0, 0.0, 0
 
 CFloatColor							CScrollerManager::mBackgroundColor = CFloatColor(0.0, 0.0, 0.0);
 
+QuantityType						CScrollerManager::mScrollerImageRevision = 0;
+
 const QuantityType					CScrollerManager::mTextLeadInPadding = 100;
\ No newline at end of file
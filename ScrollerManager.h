@@ -39,6 +39,11 @@ public:
 	// Sets the scroller background color.
 	static void						SetScrollerBackgroundColor(const CFloatColor& backgroundColor);
 
+	// Returns the revision of the scroller image - the revision changes whenever the
+	// scroller image changes (the scroller scrolls, or a color changes), permitting
+	// clients to determine if a previously retrieved image is current.
+	static QuantityType				GetScrollerImageRevision();
+
 protected:
 	// Protected constructor/destructor to enforce existence as a singleton class.
 	CScrollerManager();
@@ -47,6 +52,10 @@ protected:
 	// Verifies the validity of the class (including stream server instance pointer check).
 	static bool						IsValid();
 
+	// Determines if two colors are identical.
+	static bool						AreColorsEqual(const CFloatColor& firstColor,
+		const CFloatColor& secondColor);
+
 	// Adjusts the scroller index and pixel offset such that the proper character is
 	// referenced during scroller incrementing.
 	static void						AdjustScrollerIndex();
@@ -91,6 +100,9 @@ protected:
 	// Scroller background color.
 	static CFloatColor				mBackgroundColor;
 
+	// Revision of the scroller image.
+	static QuantityType				mScrollerImageRevision;
+
 	// "Padding" for "lead-in" (pixels - produces an additional delay before the text
 	// initially appears).
 	const static QuantityType		mTextLeadInPadding;
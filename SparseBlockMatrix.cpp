@@ -0,0 +1,211 @@
+// SparseBlockMatrix.cpp - Contains implementations for a sparse matrix composed of 3x3 blocks,
+//                         used by the implicit cloth integrator.
+
+#include "SparseBlockMatrix.h"
+#include <algorithm>
+
+
+/////
+// CSparseBlockMatrix class
+/////
+CSparseBlockMatrix::CSparseBlockMatrix()
+{
+
+}
+
+CSparseBlockMatrix::~CSparseBlockMatrix()
+{
+
+}
+
+
+bool CSparseBlockMatrix::BuildPattern(const QuantityType blockRowCount,
+									  const IndexType* pFirstLinkIndex,
+									  const IndexType* pSecondLinkIndex,
+									  const QuantityType linkCount)
+{
+	bool							bPatternBuiltSuccessfully = (blockRowCount > 0) &&
+		((linkCount == 0) || (pFirstLinkIndex && pSecondLinkIndex));
+
+	if (bPatternBuiltSuccessfully) {
+		// Count the blocks within each block row (one diagonal block, along with one
+		// block for each link - duplicate links are removed later)...
+		IndexArrayType				linkedBlockRowStart(blockRowCount + 1, 0);
+
+		for (IndexType linkLoop = 0; linkLoop < linkCount; linkLoop++) {
+			bPatternBuiltSuccessfully = (pFirstLinkIndex[linkLoop] < blockRowCount) &&
+				(pSecondLinkIndex[linkLoop] < blockRowCount) && bPatternBuiltSuccessfully;
+
+			if (bPatternBuiltSuccessfully) {
+				linkedBlockRowStart[pFirstLinkIndex[linkLoop] + 1]++;
+				linkedBlockRowStart[pSecondLinkIndex[linkLoop] + 1]++;
+			}
+		}
+
+		for (IndexType rowLoop = 0; bPatternBuiltSuccessfully && (rowLoop < blockRowCount);
+			rowLoop++)
+		{
+			linkedBlockRowStart[rowLoop + 1] += linkedBlockRowStart[rowLoop] + 1;
+		}
+
+		// ...Store the block columns of each block row...
+		IndexArrayType				linkedBlockColumn(bPatternBuiltSuccessfully ?
+			linkedBlockRowStart[blockRowCount] : 0);
+		IndexArrayType				blockInsertIndex(linkedBlockRowStart.begin(),
+			linkedBlockRowStart.end() - 1);
+
+		for (IndexType rowLoop = 0; bPatternBuiltSuccessfully && (rowLoop < blockRowCount);
+			rowLoop++)
+		{
+			linkedBlockColumn[blockInsertIndex[rowLoop]++] = rowLoop;
+		}
+
+		for (IndexType linkLoop = 0; bPatternBuiltSuccessfully && (linkLoop < linkCount);
+			linkLoop++)
+		{
+			const IndexType			firstIndex = pFirstLinkIndex[linkLoop];
+			const IndexType			secondIndex = pSecondLinkIndex[linkLoop];
+
+			linkedBlockColumn[blockInsertIndex[firstIndex]++] = secondIndex;
+			linkedBlockColumn[blockInsertIndex[secondIndex]++] = firstIndex;
+		}
+
+		// ...And sort the block columns within each block row, removing duplicate
+		// blocks.
+		if (bPatternBuiltSuccessfully) {
+			this->mBlockRowStart.assign(blockRowCount + 1, 0);
+			this->mBlockColumn.clear();
+			this->mBlockColumn.reserve(linkedBlockColumn.size());
+			this->mDiagonalBlockIndex.assign(blockRowCount, 0);
+
+			for (IndexType rowLoop = 0; rowLoop < blockRowCount; rowLoop++) {
+				IndexArrayType::iterator
+									rowBegin = linkedBlockColumn.begin() +
+					linkedBlockRowStart[rowLoop];
+				IndexArrayType::iterator
+									rowEnd = linkedBlockColumn.begin() +
+					linkedBlockRowStart[rowLoop + 1];
+
+				std::sort(rowBegin, rowEnd);
+				rowEnd = std::unique(rowBegin, rowEnd);
+
+				for (IndexArrayType::iterator columnLoop = rowBegin; columnLoop != rowEnd;
+					columnLoop++)
+				{
+					if (*columnLoop == rowLoop) {
+						this->mDiagonalBlockIndex[rowLoop] = this->mBlockColumn.size();
+					}
+
+					this->mBlockColumn.push_back(*columnLoop);
+				}
+
+				this->mBlockRowStart[rowLoop + 1] = this->mBlockColumn.size();
+			}
+
+			this->mBlockValues.assign(this->mBlockColumn.size() * mkBlockValueCount, 0.0);
+		}
+	}
+
+	return(bPatternBuiltSuccessfully);
+}
+
+
+QuantityType CSparseBlockMatrix::GetBlockRowCount() const
+{
+	return(this->mDiagonalBlockIndex.size());
+}
+
+
+QuantityType CSparseBlockMatrix::GetBlockCount() const
+{
+	return(this->mBlockColumn.size());
+}
+
+
+void CSparseBlockMatrix::ClearBlocks()
+{
+	std::fill(this->mBlockValues.begin(), this->mBlockValues.end(), 0.0);
+}
+
+
+IndexType CSparseBlockMatrix::GetDiagonalBlockIndex(const IndexType blockRow) const
+{
+	return((blockRow < this->GetBlockRowCount()) ? this->mDiagonalBlockIndex[blockRow] :
+		this->GetBlockCount());
+}
+
+
+IndexType CSparseBlockMatrix::FindBlockIndex(const IndexType blockRow,
+											 const IndexType blockColumn) const
+{
+	IndexType						blockIndex = this->GetBlockCount();
+
+	if (blockRow < this->GetBlockRowCount()) {
+		// Block columns are sorted within each block row.
+		const IndexArrayType::const_iterator
+									rowBegin = this->mBlockColumn.begin() +
+			this->mBlockRowStart[blockRow];
+		const IndexArrayType::const_iterator
+									rowEnd = this->mBlockColumn.begin() +
+			this->mBlockRowStart[blockRow + 1];
+		const IndexArrayType::const_iterator
+									columnIterator = std::lower_bound(rowBegin, rowEnd,
+			blockColumn);
+
+		if ((columnIterator != rowEnd) && (*columnIterator == blockColumn)) {
+			blockIndex = columnIterator - this->mBlockColumn.begin();
+		}
+	}
+
+	return(blockIndex);
+}
+
+
+ScalarType* CSparseBlockMatrix::GetBlock(const IndexType blockIndex)
+{
+	return((blockIndex < this->GetBlockCount()) ?
+		&this->mBlockValues[blockIndex * mkBlockValueCount] : NULL);
+}
+
+
+const ScalarType* CSparseBlockMatrix::GetBlock(const IndexType blockIndex) const
+{
+	return((blockIndex < this->GetBlockCount()) ?
+		&this->mBlockValues[blockIndex * mkBlockValueCount] : NULL);
+}
+
+
+void CSparseBlockMatrix::Multiply(const ScalarType* pVector, ScalarType* pResultVector) const
+{
+	const QuantityType				blockRowCount = this->GetBlockRowCount();
+
+	for (IndexType rowLoop = 0; rowLoop < blockRowCount; rowLoop++) {
+		ScalarType					resultX = 0.0;
+		ScalarType					resultY = 0.0;
+		ScalarType					resultZ = 0.0;
+
+		// Sum the product of each block within the row and the corresponding vector
+		// components.
+		for (IndexType blockLoop = this->mBlockRowStart[rowLoop];
+			blockLoop < this->mBlockRowStart[rowLoop + 1]; blockLoop++)
+		{
+			const ScalarType*		pBlock = &this->mBlockValues[blockLoop * mkBlockValueCount];
+			const ScalarType*		pVectorComponents = &pVector[this->mBlockColumn[blockLoop] * 3];
+
+			resultX += (pBlock[0] * pVectorComponents[0]) + (pBlock[1] * pVectorComponents[1]) +
+				(pBlock[2] * pVectorComponents[2]);
+			resultY += (pBlock[3] * pVectorComponents[0]) + (pBlock[4] * pVectorComponents[1]) +
+				(pBlock[5] * pVectorComponents[2]);
+			resultZ += (pBlock[6] * pVectorComponents[0]) + (pBlock[7] * pVectorComponents[1]) +
+				(pBlock[8] * pVectorComponents[2]);
+		}
+
+		pResultVector[(rowLoop * 3)] = resultX;
+		pResultVector[(rowLoop * 3) + 1] = resultY;
+		pResultVector[(rowLoop * 3) + 2] = resultZ;
+	}
+}
+
+
+// Number of scalar values within each (3x3) block.
+const QuantityType					CSparseBlockMatrix::mkBlockValueCount = 9;
@@ -0,0 +1,83 @@
+// SparseBlockMatrix.h - Contains declarations for a sparse matrix composed of 3x3 blocks, used by
+//                       the implicit cloth integrator.
+
+#ifndef _SPARSEBLOCKMATRIX_H
+#define _SPARSEBLOCKMATRIX_H		1
+
+
+#include "PrimaryHeaders.h"
+#include "PrimitiveSupport.h"
+
+
+// Square matrix of 3x3 blocks, stored in block compressed row format (each block row
+// contains a diagonal block, along with a block for each linked block column). The
+// sparsity pattern is constructed once, and block values may be cleared/re-assembled
+// without allocating memory. Vectors contain three interleaved components per block
+// row.
+class CSparseBlockMatrix
+{
+public:
+	CSparseBlockMatrix();
+	~CSparseBlockMatrix();
+
+	// Constructs the sparsity pattern - each block row contains a diagonal block, and
+	// each pair of linked block rows contains two symmetric off-diagonal blocks (all
+	// block values are cleared).
+	bool							BuildPattern(const QuantityType blockRowCount,
+		const IndexType* pFirstLinkIndex, const IndexType* pSecondLinkIndex,
+		const QuantityType linkCount);
+
+	// Returns the number of block rows (and block columns) within the matrix.
+	QuantityType					GetBlockRowCount() const;
+
+	// Returns the number of blocks within the sparsity pattern.
+	QuantityType					GetBlockCount() const;
+
+	// Sets all block values to zero (the sparsity pattern is retained).
+	void							ClearBlocks();
+
+	// Retrieves the index of the diagonal block within a block row.
+	IndexType						GetDiagonalBlockIndex(const IndexType blockRow) const;
+
+	// Retrieves the index of the block at the specified block row/column (the block
+	// count is returned if the block is not within the sparsity pattern).
+	IndexType						FindBlockIndex(const IndexType blockRow,
+		const IndexType blockColumn) const;
+
+	// Retrieves the nine values (row-major) of an indexed block.
+	ScalarType*						GetBlock(const IndexType blockIndex);
+	const ScalarType*				GetBlock(const IndexType blockIndex) const;
+
+	// Multiplies the matrix by a vector (the result vector must not be the source
+	// vector).
+	void							Multiply(const ScalarType* pVector,
+		ScalarType* pResultVector) const;
+
+	// Number of scalar values within each block.
+	static const QuantityType		mkBlockValueCount;
+
+protected:
+
+	// Type definition - contiguous array of indices.
+	typedef std::vector<IndexType>	IndexArrayType;
+
+	// Type definition - contiguous array of scalar values.
+	typedef std::vector<ScalarType>	ScalarArrayType;
+
+
+	// Index of the first block within each block row (the final entry contains the
+	// block count).
+	IndexArrayType					mBlockRowStart;
+
+	// Block column of each block (ascending within each block row).
+	IndexArrayType					mBlockColumn;
+
+	// Index of the diagonal block within each block row.
+	IndexArrayType					mDiagonalBlockIndex;
+
+	// Block values (nine values per block).
+	ScalarArrayType					mBlockValues;
+};
+
+
+#endif	// #ifndef _SPARSEBLOCKMATRIX_H
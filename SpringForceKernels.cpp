@@ -0,0 +1,764 @@
+// SpringForceKernels.cpp - Contains implementations for the spring force evaluation kernels
+//                          (scalar and SIMD) used by the spring-centric cloth solver.
+
+#include "SpringForceKernels.h"
+
+
+// SIMD kernels are only compiled for x86/x64 targets, using compilers that provide SSE2/AVX2
+// intrinsics (GCC-compatible compilers generate the kernels using per-function target
+// attributes, so that the remainder of the program does not require AVX2 support). The
+// kernel that is used is selected at run time.
+#if SIMD_SPRING_FORCE_KERNELS && (defined(_M_IX86) || defined(_M_X64) || \
+	defined(__i386__) || defined(__x86_64__))
+#if defined(_MSC_VER) && (_MSC_VER >= 1700)
+#include <intrin.h>
+#include <immintrin.h>
+#define SPRING_KERNELS_SIMD_AVAILABLE	1
+#define SPRING_KERNEL_TARGET_SSE2
+#define SPRING_KERNEL_TARGET_AVX2
+#elif defined(__GNUC__)
+#include <cpuid.h>
+#include <immintrin.h>
+#include <x86intrin.h>
+#define SPRING_KERNELS_SIMD_AVAILABLE	1
+#define SPRING_KERNEL_TARGET_SSE2		__attribute__((target("sse2")))
+#define SPRING_KERNEL_TARGET_AVX2		__attribute__((target("avx2")))
+#endif	// #if defined(_MSC_VER) && (_MSC_VER >= 1700)...#elif defined(__GNUC__)
+#endif	// #if SIMD_SPRING_FORCE_KERNELS...
+
+#ifndef SPRING_KERNELS_SIMD_AVAILABLE
+#define SPRING_KERNELS_SIMD_AVAILABLE	0
+#endif	// #ifndef SPRING_KERNELS_SIMD_AVAILABLE
+
+
+// Scalar kernel - evaluates all springs, starting at the specified spring (also used to
+// evaluate the springs that remain after SIMD kernel evaluation).
+template <class scalarType> static void EvaluateSpringForcesScalar(
+	const CSpringForceKernelBlock<scalarType>& kernelBlock, const IndexType firstSpringIndex)
+{
+	for (IndexType springLoop = firstSpringIndex; springLoop < kernelBlock.mSpringCount;
+		springLoop++)
+	{
+		const IndexType				headIndex = kernelBlock.mpSpringHeadIndex[springLoop];
+		const IndexType				tailIndex = kernelBlock.mpSpringTailIndex[springLoop];
+
+		// Determine the spring displacement vector (tail to head)...
+		const scalarType			deltaX = kernelBlock.mpNodeLocationX[headIndex] -
+			kernelBlock.mpNodeLocationX[tailIndex];
+		const scalarType			deltaY = kernelBlock.mpNodeLocationY[headIndex] -
+			kernelBlock.mpNodeLocationY[tailIndex];
+		const scalarType			deltaZ = kernelBlock.mpNodeLocationZ[headIndex] -
+			kernelBlock.mpNodeLocationZ[tailIndex];
+
+		const scalarType			lengthSquared = (deltaX * deltaX) + (deltaY * deltaY) +
+			(deltaZ * deltaZ);
+
+		// Spring force = - (Spring Constant x Spring displacement), directed along the
+		// spring - the displacement vector is scaled by (Spring Constant x ((Resting
+		// Length x (1 / Length)) - 1)), so that a single reciprocal square root replaces
+		// the square root and division. Zero-length springs do not produce a force.
+		scalarType					forceScale = 0;
+
+		if (lengthSquared > 0) {
+			const scalarType		inverseLength = (scalarType)(1.0 / ::sqrt(lengthSquared));
+
+			forceScale = kernelBlock.mpSpringConstant[springLoop] *
+				((kernelBlock.mpSpringRestingLength[springLoop] * inverseLength) - 1);
+		}
+
+		kernelBlock.mpSpringForceX[springLoop] = deltaX * forceScale;
+		kernelBlock.mpSpringForceY[springLoop] = deltaY * forceScale;
+		kernelBlock.mpSpringForceZ[springLoop] = deltaZ * forceScale;
+	}
+}
+
+
+#if SPRING_KERNELS_SIMD_AVAILABLE
+
+// Squared spring length below which the approximate reciprocal square root is not used
+// (shorter springs do not produce a force - the squared length must be representable as
+// a normalized single-precision value).
+static const double					kMinimumApproximateLengthSquared = 1.0e-30;
+
+
+// Determines the force scale of two springs - (Spring Constant x ((Resting Length x
+// (1 / Length)) - 1)) - using the approximate reciprocal square root of the squared
+// spring lengths, refined with two Newton-Raphson iterations (y' = y x (1.5 - (0.5 x
+// x x y^2))) to approach double precision.
+SPRING_KERNEL_TARGET_SSE2 static inline __m128d ApproximateForceScaleSSE2(
+	const __m128d lengthSquared, const __m128d springConstant, const __m128d restingLength)
+{
+	const __m128d					halfVector = _mm_set1_pd(0.5);
+	const __m128d					threeHalvesVector = _mm_set1_pd(1.5);
+	const __m128d					halfLengthSquared = _mm_mul_pd(lengthSquared, halfVector);
+
+	__m128d							inverseLength = _mm_cvtps_pd(_mm_rsqrt_ps(
+		_mm_cvtpd_ps(lengthSquared)));
+
+	inverseLength = _mm_mul_pd(inverseLength, _mm_sub_pd(threeHalvesVector,
+		_mm_mul_pd(halfLengthSquared, _mm_mul_pd(inverseLength, inverseLength))));
+	inverseLength = _mm_mul_pd(inverseLength, _mm_sub_pd(threeHalvesVector,
+		_mm_mul_pd(halfLengthSquared, _mm_mul_pd(inverseLength, inverseLength))));
+
+	const __m128d					forceScale = _mm_mul_pd(springConstant, _mm_sub_pd(
+		_mm_mul_pd(restingLength, inverseLength), _mm_set1_pd(1.0)));
+
+	return(_mm_and_pd(forceScale, _mm_cmpgt_pd(lengthSquared,
+		_mm_set1_pd(kMinimumApproximateLengthSquared))));
+}
+
+
+// Determines the force scale of four springs, using the approximate reciprocal square root
+// refined with a single Newton-Raphson iteration (see ApproximateForceScaleSSE2).
+SPRING_KERNEL_TARGET_SSE2 static inline __m128 ApproximateForceScaleSSE2(
+	const __m128 lengthSquared, const __m128 springConstant, const __m128 restingLength)
+{
+	__m128							inverseLength = _mm_rsqrt_ps(lengthSquared);
+
+	inverseLength = _mm_mul_ps(inverseLength, _mm_sub_ps(_mm_set1_ps(1.5f),
+		_mm_mul_ps(_mm_mul_ps(lengthSquared, _mm_set1_ps(0.5f)),
+		_mm_mul_ps(inverseLength, inverseLength))));
+
+	const __m128					forceScale = _mm_mul_ps(springConstant, _mm_sub_ps(
+		_mm_mul_ps(restingLength, inverseLength), _mm_set1_ps(1.0f)));
+
+	return(_mm_and_ps(forceScale, _mm_cmpgt_ps(lengthSquared,
+		_mm_set1_ps((float)kMinimumApproximateLengthSquared))));
+}
+
+
+// Determines the force scale of four springs, using the approximate reciprocal square root
+// refined with two Newton-Raphson iterations (see ApproximateForceScaleSSE2).
+SPRING_KERNEL_TARGET_AVX2 static inline __m256d ApproximateForceScaleAVX2(
+	const __m256d lengthSquared, const __m256d springConstant, const __m256d restingLength)
+{
+	const __m256d					halfVector = _mm256_set1_pd(0.5);
+	const __m256d					threeHalvesVector = _mm256_set1_pd(1.5);
+	const __m256d					halfLengthSquared = _mm256_mul_pd(lengthSquared,
+		halfVector);
+
+	__m256d							inverseLength = _mm256_cvtps_pd(_mm_rsqrt_ps(
+		_mm256_cvtpd_ps(lengthSquared)));
+
+	inverseLength = _mm256_mul_pd(inverseLength, _mm256_sub_pd(threeHalvesVector,
+		_mm256_mul_pd(halfLengthSquared, _mm256_mul_pd(inverseLength, inverseLength))));
+	inverseLength = _mm256_mul_pd(inverseLength, _mm256_sub_pd(threeHalvesVector,
+		_mm256_mul_pd(halfLengthSquared, _mm256_mul_pd(inverseLength, inverseLength))));
+
+	const __m256d					forceScale = _mm256_mul_pd(springConstant, _mm256_sub_pd(
+		_mm256_mul_pd(restingLength, inverseLength), _mm256_set1_pd(1.0)));
+
+	return(_mm256_and_pd(forceScale, _mm256_cmp_pd(lengthSquared,
+		_mm256_set1_pd(kMinimumApproximateLengthSquared), _CMP_GT_OQ)));
+}
+
+
+// Determines the force scale of eight springs, using the approximate reciprocal square root
+// refined with a single Newton-Raphson iteration (see ApproximateForceScaleSSE2).
+SPRING_KERNEL_TARGET_AVX2 static inline __m256 ApproximateForceScaleAVX2(
+	const __m256 lengthSquared, const __m256 springConstant, const __m256 restingLength)
+{
+	__m256							inverseLength = _mm256_rsqrt_ps(lengthSquared);
+
+	inverseLength = _mm256_mul_ps(inverseLength, _mm256_sub_ps(_mm256_set1_ps(1.5f),
+		_mm256_mul_ps(_mm256_mul_ps(lengthSquared, _mm256_set1_ps(0.5f)),
+		_mm256_mul_ps(inverseLength, inverseLength))));
+
+	const __m256					forceScale = _mm256_mul_ps(springConstant, _mm256_sub_ps(
+		_mm256_mul_ps(restingLength, inverseLength), _mm256_set1_ps(1.0f)));
+
+	return(_mm256_and_ps(forceScale, _mm256_cmp_ps(lengthSquared,
+		_mm256_set1_ps((float)kMinimumApproximateLengthSquared), _CMP_GT_OQ)));
+}
+
+
+// SSE2 kernel (double precision) - evaluates springs in groups of two, returning the number of
+// springs that were evaluated.
+SPRING_KERNEL_TARGET_SSE2 static IndexType EvaluateSpringForcesSSE2(
+	const CSpringForceKernelBlock<double>& kernelBlock)
+{
+	const QuantityType				kSpringsPerIteration = 2;
+	const QuantityType				vectorSpringCount = kernelBlock.mSpringCount -
+		(kernelBlock.mSpringCount % kSpringsPerIteration);
+
+	const double*					pNodeLocationX = kernelBlock.mpNodeLocationX;
+	const double*					pNodeLocationY = kernelBlock.mpNodeLocationY;
+	const double*					pNodeLocationZ = kernelBlock.mpNodeLocationZ;
+
+	const __m128d					zeroVector = _mm_setzero_pd();
+
+	for (IndexType springLoop = 0; springLoop < vectorSpringCount;
+		springLoop += kSpringsPerIteration)
+	{
+		const IndexType*			pHeadIndex = kernelBlock.mpSpringHeadIndex + springLoop;
+		const IndexType*			pTailIndex = kernelBlock.mpSpringTailIndex + springLoop;
+
+		// Gather the spring terminal locations, and determine the spring displacement
+		// vectors (tail to head).
+		const __m128d				deltaX = _mm_sub_pd(
+			_mm_set_pd(pNodeLocationX[pHeadIndex[1]], pNodeLocationX[pHeadIndex[0]]),
+			_mm_set_pd(pNodeLocationX[pTailIndex[1]], pNodeLocationX[pTailIndex[0]]));
+		const __m128d				deltaY = _mm_sub_pd(
+			_mm_set_pd(pNodeLocationY[pHeadIndex[1]], pNodeLocationY[pHeadIndex[0]]),
+			_mm_set_pd(pNodeLocationY[pTailIndex[1]], pNodeLocationY[pTailIndex[0]]));
+		const __m128d				deltaZ = _mm_sub_pd(
+			_mm_set_pd(pNodeLocationZ[pHeadIndex[1]], pNodeLocationZ[pHeadIndex[0]]),
+			_mm_set_pd(pNodeLocationZ[pTailIndex[1]], pNodeLocationZ[pTailIndex[0]]));
+
+		const __m128d				lengthSquared = _mm_add_pd(_mm_add_pd(
+			_mm_mul_pd(deltaX, deltaX), _mm_mul_pd(deltaY, deltaY)),
+			_mm_mul_pd(deltaZ, deltaZ));
+
+		// Determine the force scale (zero-length springs are masked, and do not produce
+		// a force).
+		__m128d						forceScale;
+
+		if (kernelBlock.mbApproximateReciprocalSqrt) {
+			forceScale = ApproximateForceScaleSSE2(lengthSquared,
+				_mm_loadu_pd(kernelBlock.mpSpringConstant + springLoop),
+				_mm_loadu_pd(kernelBlock.mpSpringRestingLength + springLoop));
+		}
+		else {
+			const __m128d			inverseLength = _mm_div_pd(_mm_set1_pd(1.0),
+				_mm_sqrt_pd(lengthSquared));
+
+			forceScale = _mm_mul_pd(_mm_loadu_pd(kernelBlock.mpSpringConstant + springLoop),
+				_mm_sub_pd(_mm_mul_pd(_mm_loadu_pd(kernelBlock.mpSpringRestingLength +
+				springLoop), inverseLength), _mm_set1_pd(1.0)));
+			forceScale = _mm_and_pd(forceScale, _mm_cmpgt_pd(lengthSquared, zeroVector));
+		}
+
+		_mm_storeu_pd(kernelBlock.mpSpringForceX + springLoop, _mm_mul_pd(deltaX, forceScale));
+		_mm_storeu_pd(kernelBlock.mpSpringForceY + springLoop, _mm_mul_pd(deltaY, forceScale));
+		_mm_storeu_pd(kernelBlock.mpSpringForceZ + springLoop, _mm_mul_pd(deltaZ, forceScale));
+	}
+
+	return(vectorSpringCount);
+}
+
+
+// SSE2 kernel (single precision) - evaluates springs in groups of four, returning the number
+// of springs that were evaluated.
+SPRING_KERNEL_TARGET_SSE2 static IndexType EvaluateSpringForcesSSE2(
+	const CSpringForceKernelBlock<float>& kernelBlock)
+{
+	const QuantityType				kSpringsPerIteration = 4;
+	const QuantityType				vectorSpringCount = kernelBlock.mSpringCount -
+		(kernelBlock.mSpringCount % kSpringsPerIteration);
+
+	const float*					pNodeLocationX = kernelBlock.mpNodeLocationX;
+	const float*					pNodeLocationY = kernelBlock.mpNodeLocationY;
+	const float*					pNodeLocationZ = kernelBlock.mpNodeLocationZ;
+
+	const __m128					zeroVector = _mm_setzero_ps();
+
+	for (IndexType springLoop = 0; springLoop < vectorSpringCount;
+		springLoop += kSpringsPerIteration)
+	{
+		const IndexType*			pHeadIndex = kernelBlock.mpSpringHeadIndex + springLoop;
+		const IndexType*			pTailIndex = kernelBlock.mpSpringTailIndex + springLoop;
+
+		// Gather the spring terminal locations, and determine the spring displacement
+		// vectors (tail to head).
+		const __m128				deltaX = _mm_sub_ps(
+			_mm_set_ps(pNodeLocationX[pHeadIndex[3]], pNodeLocationX[pHeadIndex[2]],
+			pNodeLocationX[pHeadIndex[1]], pNodeLocationX[pHeadIndex[0]]),
+			_mm_set_ps(pNodeLocationX[pTailIndex[3]], pNodeLocationX[pTailIndex[2]],
+			pNodeLocationX[pTailIndex[1]], pNodeLocationX[pTailIndex[0]]));
+		const __m128				deltaY = _mm_sub_ps(
+			_mm_set_ps(pNodeLocationY[pHeadIndex[3]], pNodeLocationY[pHeadIndex[2]],
+			pNodeLocationY[pHeadIndex[1]], pNodeLocationY[pHeadIndex[0]]),
+			_mm_set_ps(pNodeLocationY[pTailIndex[3]], pNodeLocationY[pTailIndex[2]],
+			pNodeLocationY[pTailIndex[1]], pNodeLocationY[pTailIndex[0]]));
+		const __m128				deltaZ = _mm_sub_ps(
+			_mm_set_ps(pNodeLocationZ[pHeadIndex[3]], pNodeLocationZ[pHeadIndex[2]],
+			pNodeLocationZ[pHeadIndex[1]], pNodeLocationZ[pHeadIndex[0]]),
+			_mm_set_ps(pNodeLocationZ[pTailIndex[3]], pNodeLocationZ[pTailIndex[2]],
+			pNodeLocationZ[pTailIndex[1]], pNodeLocationZ[pTailIndex[0]]));
+
+		const __m128				lengthSquared = _mm_add_ps(_mm_add_ps(
+			_mm_mul_ps(deltaX, deltaX), _mm_mul_ps(deltaY, deltaY)),
+			_mm_mul_ps(deltaZ, deltaZ));
+
+		// Determine the force scale (zero-length springs are masked, and do not produce
+		// a force).
+		__m128						forceScale;
+
+		if (kernelBlock.mbApproximateReciprocalSqrt) {
+			forceScale = ApproximateForceScaleSSE2(lengthSquared,
+				_mm_loadu_ps(kernelBlock.mpSpringConstant + springLoop),
+				_mm_loadu_ps(kernelBlock.mpSpringRestingLength + springLoop));
+		}
+		else {
+			const __m128			inverseLength = _mm_div_ps(_mm_set1_ps(1.0f),
+				_mm_sqrt_ps(lengthSquared));
+
+			forceScale = _mm_mul_ps(_mm_loadu_ps(kernelBlock.mpSpringConstant + springLoop),
+				_mm_sub_ps(_mm_mul_ps(_mm_loadu_ps(kernelBlock.mpSpringRestingLength +
+				springLoop), inverseLength), _mm_set1_ps(1.0f)));
+			forceScale = _mm_and_ps(forceScale, _mm_cmpgt_ps(lengthSquared, zeroVector));
+		}
+
+		_mm_storeu_ps(kernelBlock.mpSpringForceX + springLoop, _mm_mul_ps(deltaX, forceScale));
+		_mm_storeu_ps(kernelBlock.mpSpringForceY + springLoop, _mm_mul_ps(deltaY, forceScale));
+		_mm_storeu_ps(kernelBlock.mpSpringForceZ + springLoop, _mm_mul_ps(deltaZ, forceScale));
+	}
+
+	return(vectorSpringCount);
+}
+
+
+// AVX2 kernel (double precision) - evaluates springs in groups of four (spring terminal
+// locations are retrieved with gather instructions), returning the number of springs that
+// were evaluated.
+SPRING_KERNEL_TARGET_AVX2 static IndexType EvaluateSpringForcesAVX2(
+	const CSpringForceKernelBlock<double>& kernelBlock)
+{
+	const QuantityType				kSpringsPerIteration = 4;
+	const QuantityType				vectorSpringCount = kernelBlock.mSpringCount -
+		(kernelBlock.mSpringCount % kSpringsPerIteration);
+
+	const double*					pNodeLocationX = kernelBlock.mpNodeLocationX;
+	const double*					pNodeLocationY = kernelBlock.mpNodeLocationY;
+	const double*					pNodeLocationZ = kernelBlock.mpNodeLocationZ;
+
+	const __m256d					zeroVector = _mm256_setzero_pd();
+
+	for (IndexType springLoop = 0; springLoop < vectorSpringCount;
+		springLoop += kSpringsPerIteration)
+	{
+		const IndexType*			pHeadIndex = kernelBlock.mpSpringHeadIndex + springLoop;
+		const IndexType*			pTailIndex = kernelBlock.mpSpringTailIndex + springLoop;
+
+		// Spring terminal indices (gather offsets).
+		const __m128i				headIndices = _mm_set_epi32((int)pHeadIndex[3],
+			(int)pHeadIndex[2], (int)pHeadIndex[1], (int)pHeadIndex[0]);
+		const __m128i				tailIndices = _mm_set_epi32((int)pTailIndex[3],
+			(int)pTailIndex[2], (int)pTailIndex[1], (int)pTailIndex[0]);
+
+		// Gather the spring terminal locations, and determine the spring displacement
+		// vectors (tail to head).
+		const __m256d				deltaX = _mm256_sub_pd(
+			_mm256_i32gather_pd(pNodeLocationX, headIndices, sizeof(double)),
+			_mm256_i32gather_pd(pNodeLocationX, tailIndices, sizeof(double)));
+		const __m256d				deltaY = _mm256_sub_pd(
+			_mm256_i32gather_pd(pNodeLocationY, headIndices, sizeof(double)),
+			_mm256_i32gather_pd(pNodeLocationY, tailIndices, sizeof(double)));
+		const __m256d				deltaZ = _mm256_sub_pd(
+			_mm256_i32gather_pd(pNodeLocationZ, headIndices, sizeof(double)),
+			_mm256_i32gather_pd(pNodeLocationZ, tailIndices, sizeof(double)));
+
+		const __m256d				lengthSquared = _mm256_add_pd(
+			_mm256_add_pd(_mm256_mul_pd(deltaX, deltaX), _mm256_mul_pd(deltaY, deltaY)),
+			_mm256_mul_pd(deltaZ, deltaZ));
+
+		// Determine the force scale (zero-length springs are masked, and do not produce
+		// a force).
+		__m256d						forceScale;
+
+		if (kernelBlock.mbApproximateReciprocalSqrt) {
+			forceScale = ApproximateForceScaleAVX2(lengthSquared,
+				_mm256_loadu_pd(kernelBlock.mpSpringConstant + springLoop),
+				_mm256_loadu_pd(kernelBlock.mpSpringRestingLength + springLoop));
+		}
+		else {
+			const __m256d			inverseLength = _mm256_div_pd(_mm256_set1_pd(1.0),
+				_mm256_sqrt_pd(lengthSquared));
+
+			forceScale = _mm256_mul_pd(_mm256_loadu_pd(kernelBlock.mpSpringConstant +
+				springLoop), _mm256_sub_pd(_mm256_mul_pd(_mm256_loadu_pd(
+				kernelBlock.mpSpringRestingLength + springLoop), inverseLength),
+				_mm256_set1_pd(1.0)));
+			forceScale = _mm256_and_pd(forceScale,
+				_mm256_cmp_pd(lengthSquared, zeroVector, _CMP_GT_OQ));
+		}
+
+		_mm256_storeu_pd(kernelBlock.mpSpringForceX + springLoop,
+			_mm256_mul_pd(deltaX, forceScale));
+		_mm256_storeu_pd(kernelBlock.mpSpringForceY + springLoop,
+			_mm256_mul_pd(deltaY, forceScale));
+		_mm256_storeu_pd(kernelBlock.mpSpringForceZ + springLoop,
+			_mm256_mul_pd(deltaZ, forceScale));
+	}
+
+	return(vectorSpringCount);
+}
+
+
+// AVX2 kernel (single precision) - evaluates springs in groups of eight (spring terminal
+// locations are retrieved with gather instructions), returning the number of springs that
+// were evaluated.
+SPRING_KERNEL_TARGET_AVX2 static IndexType EvaluateSpringForcesAVX2(
+	const CSpringForceKernelBlock<float>& kernelBlock)
+{
+	const QuantityType				kSpringsPerIteration = 8;
+	const QuantityType				vectorSpringCount = kernelBlock.mSpringCount -
+		(kernelBlock.mSpringCount % kSpringsPerIteration);
+
+	const float*					pNodeLocationX = kernelBlock.mpNodeLocationX;
+	const float*					pNodeLocationY = kernelBlock.mpNodeLocationY;
+	const float*					pNodeLocationZ = kernelBlock.mpNodeLocationZ;
+
+	const __m256					zeroVector = _mm256_setzero_ps();
+
+	for (IndexType springLoop = 0; springLoop < vectorSpringCount;
+		springLoop += kSpringsPerIteration)
+	{
+		const IndexType*			pHeadIndex = kernelBlock.mpSpringHeadIndex + springLoop;
+		const IndexType*			pTailIndex = kernelBlock.mpSpringTailIndex + springLoop;
+
+		// Spring terminal indices (gather offsets).
+		const __m256i				headIndices = _mm256_set_epi32((int)pHeadIndex[7],
+			(int)pHeadIndex[6], (int)pHeadIndex[5], (int)pHeadIndex[4], (int)pHeadIndex[3],
+			(int)pHeadIndex[2], (int)pHeadIndex[1], (int)pHeadIndex[0]);
+		const __m256i				tailIndices = _mm256_set_epi32((int)pTailIndex[7],
+			(int)pTailIndex[6], (int)pTailIndex[5], (int)pTailIndex[4], (int)pTailIndex[3],
+			(int)pTailIndex[2], (int)pTailIndex[1], (int)pTailIndex[0]);
+
+		// Gather the spring terminal locations, and determine the spring displacement
+		// vectors (tail to head).
+		const __m256				deltaX = _mm256_sub_ps(
+			_mm256_i32gather_ps(pNodeLocationX, headIndices, sizeof(float)),
+			_mm256_i32gather_ps(pNodeLocationX, tailIndices, sizeof(float)));
+		const __m256				deltaY = _mm256_sub_ps(
+			_mm256_i32gather_ps(pNodeLocationY, headIndices, sizeof(float)),
+			_mm256_i32gather_ps(pNodeLocationY, tailIndices, sizeof(float)));
+		const __m256				deltaZ = _mm256_sub_ps(
+			_mm256_i32gather_ps(pNodeLocationZ, headIndices, sizeof(float)),
+			_mm256_i32gather_ps(pNodeLocationZ, tailIndices, sizeof(float)));
+
+		const __m256				lengthSquared = _mm256_add_ps(
+			_mm256_add_ps(_mm256_mul_ps(deltaX, deltaX), _mm256_mul_ps(deltaY, deltaY)),
+			_mm256_mul_ps(deltaZ, deltaZ));
+
+		// Determine the force scale (zero-length springs are masked, and do not produce
+		// a force).
+		__m256						forceScale;
+
+		if (kernelBlock.mbApproximateReciprocalSqrt) {
+			forceScale = ApproximateForceScaleAVX2(lengthSquared,
+				_mm256_loadu_ps(kernelBlock.mpSpringConstant + springLoop),
+				_mm256_loadu_ps(kernelBlock.mpSpringRestingLength + springLoop));
+		}
+		else {
+			const __m256			inverseLength = _mm256_div_ps(_mm256_set1_ps(1.0f),
+				_mm256_sqrt_ps(lengthSquared));
+
+			forceScale = _mm256_mul_ps(_mm256_loadu_ps(kernelBlock.mpSpringConstant +
+				springLoop), _mm256_sub_ps(_mm256_mul_ps(_mm256_loadu_ps(
+				kernelBlock.mpSpringRestingLength + springLoop), inverseLength),
+				_mm256_set1_ps(1.0f)));
+			forceScale = _mm256_and_ps(forceScale,
+				_mm256_cmp_ps(lengthSquared, zeroVector, _CMP_GT_OQ));
+		}
+
+		_mm256_storeu_ps(kernelBlock.mpSpringForceX + springLoop,
+			_mm256_mul_ps(deltaX, forceScale));
+		_mm256_storeu_ps(kernelBlock.mpSpringForceY + springLoop,
+			_mm256_mul_ps(deltaY, forceScale));
+		_mm256_storeu_ps(kernelBlock.mpSpringForceZ + springLoop,
+			_mm256_mul_ps(deltaZ, forceScale));
+	}
+
+	return(vectorSpringCount);
+}
+
+
+// Executes the CPUID instruction, storing the resulting register values (EAX, EBX, ECX and
+// EDX, respectively).
+static void QueryCPUID(const unsigned int functionID, const unsigned int subFunctionID,
+					   unsigned int cpuRegisters[4])
+{
+#if defined(_MSC_VER)
+	int								cpuInfo[4];
+
+	::__cpuidex(cpuInfo, (int)functionID, (int)subFunctionID);
+
+	for (IndexType registerLoop = 0; registerLoop < 4; registerLoop++) {
+		cpuRegisters[registerLoop] = (unsigned int)cpuInfo[registerLoop];
+	}
+#else	// #if defined(_MSC_VER)
+	__cpuid_count(functionID, subFunctionID, cpuRegisters[0], cpuRegisters[1],
+		cpuRegisters[2], cpuRegisters[3]);
+#endif	// #if defined(_MSC_VER)...#else
+}
+
+
+// Reads the low-order bits of extended control register 0 (indicates the register states
+// that are preserved by the operating system).
+static unsigned int ReadExtendedControlRegister()
+{
+#if defined(_MSC_VER)
+	return((unsigned int)::_xgetbv(0));
+#else	// #if defined(_MSC_VER)
+	unsigned int					registerLow = 0;
+	unsigned int					registerHigh = 0;
+
+	__asm__ __volatile__ ("xgetbv" : "=a" (registerLow), "=d" (registerHigh) : "c" (0));
+
+	return(registerLow);
+#endif	// #if defined(_MSC_VER)...#else
+}
+
+
+// Determines processor (and operating system) support for the SIMD instruction sets used by
+// the kernels.
+static void QueryProcessorFeatures(bool& bSSE2Supported, bool& bAVX2Supported)
+{
+	// CPUID feature flags.
+	const unsigned int				kSSE2FeatureFlag = (1 << 26);		// Function 1, EDX
+	const unsigned int				kOSXSaveFeatureFlag = (1 << 27);	// Function 1, ECX
+	const unsigned int				kAVXFeatureFlag = (1 << 28);		// Function 1, ECX
+	const unsigned int				kAVX2FeatureFlag = (1 << 5);		// Function 7, EBX
+
+	// Extended control register flags (XMM and YMM register state).
+	const unsigned int				kYMMStateFlags = 0x06;
+
+	unsigned int					cpuRegisters[4] = { 0, 0, 0, 0 };
+
+	bSSE2Supported = false;
+	bAVX2Supported = false;
+
+	// Determine the highest supported CPUID function.
+	QueryCPUID(0, 0, cpuRegisters);
+	const unsigned int				maxFunctionID = cpuRegisters[0];
+
+	if (maxFunctionID >= 1) {
+		QueryCPUID(1, 0, cpuRegisters);
+
+		bSSE2Supported = ((cpuRegisters[3] & kSSE2FeatureFlag) != 0);
+
+		// AVX2 requires that the operating system preserve the YMM registers.
+		const bool					bAVXStateSupported =
+			((cpuRegisters[2] & kOSXSaveFeatureFlag) != 0) &&
+			((cpuRegisters[2] & kAVXFeatureFlag) != 0) &&
+			((ReadExtendedControlRegister() & kYMMStateFlags) == kYMMStateFlags);
+
+		if (bAVXStateSupported && (maxFunctionID >= 7)) {
+			QueryCPUID(7, 0, cpuRegisters);
+
+			bAVX2Supported = ((cpuRegisters[1] & kAVX2FeatureFlag) != 0);
+		}
+	}
+}
+
+#endif	// #if SPRING_KERNELS_SIMD_AVAILABLE
+
+
+// Determines if a kernel block contains valid references.
+template <class scalarType> static bool IsKernelBlockValid(
+	const CSpringForceKernelBlock<scalarType>& kernelBlock)
+{
+	return(kernelBlock.mpNodeLocationX && kernelBlock.mpNodeLocationY &&
+		kernelBlock.mpNodeLocationZ && kernelBlock.mpSpringHeadIndex &&
+		kernelBlock.mpSpringTailIndex && kernelBlock.mpSpringConstant &&
+		kernelBlock.mpSpringRestingLength && kernelBlock.mpSpringForceX &&
+		kernelBlock.mpSpringForceY && kernelBlock.mpSpringForceZ &&
+		(kernelBlock.mSpringCount > 0));
+}
+
+
+// Evaluates the force of each spring within a kernel block, using the specified kernel.
+template <class scalarType> static bool DispatchSpringForceKernel(
+	const ESpringForceKernel kernel, const CSpringForceKernelBlock<scalarType>& kernelBlock)
+{
+	bool							bEvaluatedSuccessfully = false;
+
+	if (NSpringForceKernels::IsKernelSupported(kernel) && IsKernelBlockValid(kernelBlock)) {
+		IndexType					firstScalarSpringIndex = 0;
+
+#if SPRING_KERNELS_SIMD_AVAILABLE
+		if (kernel == eSpringKernelAVX2) {
+			firstScalarSpringIndex = EvaluateSpringForcesAVX2(kernelBlock);
+		}
+		else if (kernel == eSpringKernelSSE2) {
+			firstScalarSpringIndex = EvaluateSpringForcesSSE2(kernelBlock);
+		}
+#endif	// #if SPRING_KERNELS_SIMD_AVAILABLE
+
+		// Evaluate any springs that remain after SIMD evaluation.
+		EvaluateSpringForcesScalar(kernelBlock, firstScalarSpringIndex);
+
+		bEvaluatedSuccessfully = true;
+	}
+
+	return(bEvaluatedSuccessfully);
+}
+
+
+// Evaluates the force of each spring within a kernel block, comparing the results to those
+// produced by the scalar kernel.
+template <class scalarType> static bool VerifySpringForceKernel(
+	const ESpringForceKernel kernel, const CSpringForceKernelBlock<scalarType>& kernelBlock,
+	const scalarType tolerance)
+{
+	bool							bVerifiedSuccessfully = false;
+
+	if (DispatchSpringForceKernel(kernel, kernelBlock)) {
+		// Evaluate reference forces, using the scalar kernel.
+		std::vector<scalarType>		referenceForceX(kernelBlock.mSpringCount);
+		std::vector<scalarType>		referenceForceY(kernelBlock.mSpringCount);
+		std::vector<scalarType>		referenceForceZ(kernelBlock.mSpringCount);
+
+		CSpringForceKernelBlock<scalarType>
+									referenceKernelBlock = kernelBlock;
+
+		referenceKernelBlock.mpSpringForceX = &referenceForceX[0];
+		referenceKernelBlock.mpSpringForceY = &referenceForceY[0];
+		referenceKernelBlock.mpSpringForceZ = &referenceForceZ[0];
+
+		EvaluateSpringForcesScalar(referenceKernelBlock, 0);
+
+		bVerifiedSuccessfully = true;
+
+		// The force difference must be within the tolerance, relative to the reference
+		// force magnitude (small forces are compared absolutely).
+		for (IndexType springLoop = 0; springLoop < kernelBlock.mSpringCount; springLoop++) {
+			const scalarType		errorX = kernelBlock.mpSpringForceX[springLoop] -
+				referenceForceX[springLoop];
+			const scalarType		errorY = kernelBlock.mpSpringForceY[springLoop] -
+				referenceForceY[springLoop];
+			const scalarType		errorZ = kernelBlock.mpSpringForceZ[springLoop] -
+				referenceForceZ[springLoop];
+
+			const scalarType		referenceMagnitude = (scalarType)::sqrt(
+				(referenceForceX[springLoop] * referenceForceX[springLoop]) +
+				(referenceForceY[springLoop] * referenceForceY[springLoop]) +
+				(referenceForceZ[springLoop] * referenceForceZ[springLoop]));
+			const scalarType		errorMagnitude = (scalarType)::sqrt((errorX * errorX) +
+				(errorY * errorY) + (errorZ * errorZ));
+
+			if (!(errorMagnitude <= (tolerance * ((referenceMagnitude > 1) ?
+				referenceMagnitude : 1))))
+			{
+				bVerifiedSuccessfully = false;
+			}
+		}
+	}
+
+	return(bVerifiedSuccessfully);
+}
+
+
+// Measures the mean number of time stamp counter ticks used to evaluate each spring within a
+// kernel block.
+template <class scalarType> static double MeasureSpringForceKernel(
+	const ESpringForceKernel kernel, const CSpringForceKernelBlock<scalarType>& kernelBlock,
+	const QuantityType evaluationCount)
+{
+	double							cyclesPerSpring = 0.0;
+
+#if SPRING_KERNELS_SIMD_AVAILABLE
+	// The block is evaluated once beforehand, so that the spring and node data are
+	// resident within the cache.
+	if ((evaluationCount > 0) && DispatchSpringForceKernel(kernel, kernelBlock)) {
+		const unsigned long long	startCycleCount = __rdtsc();
+
+		for (IndexType evaluationLoop = 0; evaluationLoop < evaluationCount;
+			evaluationLoop++)
+		{
+			DispatchSpringForceKernel(kernel, kernelBlock);
+		}
+
+		const unsigned long long	elapsedCycleCount = __rdtsc() - startCycleCount;
+
+		cyclesPerSpring = (double)elapsedCycleCount /
+			((double)evaluationCount * (double)kernelBlock.mSpringCount);
+	}
+#endif	// #if SPRING_KERNELS_SIMD_AVAILABLE
+
+	return(cyclesPerSpring);
+}
+
+
+bool NSpringForceKernels::IsKernelSupported(const ESpringForceKernel kernel)
+{
+	// The scalar kernel is always available.
+	bool							bKernelSupported = (kernel == eSpringKernelScalar);
+
+#if SPRING_KERNELS_SIMD_AVAILABLE
+	// Processor features are determined once.
+	static bool						bProcessorFeaturesQueried = false;
+	static bool						bSSE2Supported = false;
+	static bool						bAVX2Supported = false;
+
+	if (!bProcessorFeaturesQueried) {
+		QueryProcessorFeatures(bSSE2Supported, bAVX2Supported);
+		bProcessorFeaturesQueried = true;
+	}
+
+	if (kernel == eSpringKernelSSE2) {
+		bKernelSupported = bSSE2Supported;
+	}
+	else if (kernel == eSpringKernelAVX2) {
+		bKernelSupported = bAVX2Supported;
+	}
+#endif	// #if SPRING_KERNELS_SIMD_AVAILABLE
+
+	return(bKernelSupported);
+}
+
+
+ESpringForceKernel NSpringForceKernels::GetPreferredKernel()
+{
+	ESpringForceKernel				preferredKernel = eSpringKernelScalar;
+
+	if (NSpringForceKernels::IsKernelSupported(eSpringKernelAVX2)) {
+		preferredKernel = eSpringKernelAVX2;
+	}
+	else if (NSpringForceKernels::IsKernelSupported(eSpringKernelSSE2)) {
+		preferredKernel = eSpringKernelSSE2;
+	}
+
+	return(preferredKernel);
+}
+
+
+bool NSpringForceKernels::EvaluateSpringForces(const ESpringForceKernel kernel,
+											   const CSpringForceKernelBlock<double>&
+											   kernelBlock)
+{
+	return(DispatchSpringForceKernel(kernel, kernelBlock));
+}
+
+
+bool NSpringForceKernels::EvaluateSpringForces(const ESpringForceKernel kernel,
+											   const CSpringForceKernelBlock<float>&
+											   kernelBlock)
+{
+	return(DispatchSpringForceKernel(kernel, kernelBlock));
+}
+
+
+bool NSpringForceKernels::VerifySpringForces(const ESpringForceKernel kernel,
+											 const CSpringForceKernelBlock<double>&
+											 kernelBlock, const double tolerance)
+{
+	return(VerifySpringForceKernel(kernel, kernelBlock, tolerance));
+}
+
+
+bool NSpringForceKernels::VerifySpringForces(const ESpringForceKernel kernel,
+											 const CSpringForceKernelBlock<float>&
+											 kernelBlock, const float tolerance)
+{
+	return(VerifySpringForceKernel(kernel, kernelBlock, tolerance));
+}
+
+
+double NSpringForceKernels::MeasureSpringForceCycles(const ESpringForceKernel kernel,
+													 const CSpringForceKernelBlock<double>&
+													 kernelBlock,
+													 const QuantityType evaluationCount)
+{
+	return(MeasureSpringForceKernel(kernel, kernelBlock, evaluationCount));
+}
+
+
+double NSpringForceKernels::MeasureSpringForceCycles(const ESpringForceKernel kernel,
+													 const CSpringForceKernelBlock<float>&
+													 kernelBlock,
+													 const QuantityType evaluationCount)
+{
+	return(MeasureSpringForceKernel(kernel, kernelBlock, evaluationCount));
+}
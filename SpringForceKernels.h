@@ -0,0 +1,102 @@
+// SpringForceKernels.h - Contains declarations for the spring force evaluation kernels (scalar and
+//                        SIMD) used by the spring-centric cloth solver.
+
+#ifndef _SPRINGFORCEKERNELS_H
+#define _SPRINGFORCEKERNELS_H		1
+
+
+#include "PrimaryHeaders.h"
+#include "PrimitiveSupport.h"
+
+
+// Spring force kernel designations.
+typedef enum
+{
+	eSpringKernelScalar = 0,		// Portable implementation (one spring at a time).
+	eSpringKernelSSE2,				// SSE2 implementation (2 double/4 float springs per iteration).
+	eSpringKernelAVX2				// AVX2 implementation (4 double/8 float springs per iteration).
+} ESpringForceKernel;
+
+
+// Describes the data operated upon by a spring force kernel - node locations are
+// indexed by node, and all other arrays are indexed by spring.
+template <class scalarType> class CSpringForceKernelBlock
+{
+public:
+	CSpringForceKernelBlock() : mpNodeLocationX(NULL), mpNodeLocationY(NULL),
+		mpNodeLocationZ(NULL), mpSpringHeadIndex(NULL), mpSpringTailIndex(NULL),
+		mpSpringConstant(NULL), mpSpringRestingLength(NULL), mpSpringForceX(NULL),
+		mpSpringForceY(NULL), mpSpringForceZ(NULL), mSpringCount(0),
+		mbApproximateReciprocalSqrt(false)
+	{
+
+	}
+
+	// Node locations.
+	const scalarType*				mpNodeLocationX;
+	const scalarType*				mpNodeLocationY;
+	const scalarType*				mpNodeLocationZ;
+
+	// Indices of the nodes attached to the "head" and "tail" of each spring.
+	const IndexType*				mpSpringHeadIndex;
+	const IndexType*				mpSpringTailIndex;
+
+	// Spring constants ("k") and resting lengths.
+	const scalarType*				mpSpringConstant;
+	const scalarType*				mpSpringRestingLength;
+
+	// Output - force applied to the head node of each spring (the tail node receives
+	// the equal and opposite force).
+	scalarType*						mpSpringForceX;
+	scalarType*						mpSpringForceY;
+	scalarType*						mpSpringForceZ;
+
+	// Number of springs to be evaluated.
+	QuantityType					mSpringCount;
+
+	// Indicates that SIMD kernels should determine the reciprocal of each spring length
+	// using the approximate reciprocal square root instruction, refined with
+	// Newton-Raphson iterations (the scalar kernel always uses an exact reciprocal square
+	// root).
+	bool							mbApproximateReciprocalSqrt;
+};
+
+
+namespace NSpringForceKernels
+{
+	// Determines if a kernel is available (the kernel must be compiled into the
+	// program, and be supported by the processor/operating system).
+	bool							IsKernelSupported(const ESpringForceKernel kernel);
+
+	// Returns the fastest kernel that is available.
+	ESpringForceKernel				GetPreferredKernel();
+
+	// Evaluates the force of each spring within a kernel block, using the specified
+	// kernel.
+	bool							EvaluateSpringForces(const ESpringForceKernel kernel,
+		const CSpringForceKernelBlock<double>& kernelBlock);
+	bool							EvaluateSpringForces(const ESpringForceKernel kernel,
+		const CSpringForceKernelBlock<float>& kernelBlock);
+
+	// Evaluates the force of each spring within a kernel block using the specified
+	// kernel, and determines if the results agree with the scalar kernel (relative
+	// to the force magnitude) within the specified tolerance.
+	bool							VerifySpringForces(const ESpringForceKernel kernel,
+		const CSpringForceKernelBlock<double>& kernelBlock, const double tolerance);
+	bool							VerifySpringForces(const ESpringForceKernel kernel,
+		const CSpringForceKernelBlock<float>& kernelBlock, const float tolerance);
+
+	// Measures the mean number of processor cycles (time stamp counter ticks) used to
+	// evaluate each spring within a kernel block with the specified kernel, over a number
+	// of successive evaluations - returns zero if the kernel (or the time stamp counter)
+	// is not available.
+	double							MeasureSpringForceCycles(const ESpringForceKernel
+		kernel, const CSpringForceKernelBlock<double>& kernelBlock,
+		const QuantityType evaluationCount);
+	double							MeasureSpringForceCycles(const ESpringForceKernel
+		kernel, const CSpringForceKernelBlock<float>& kernelBlock,
+		const QuantityType evaluationCount);
+};
+
+
+#endif	// #ifndef _SPRINGFORCEKERNELS_H
@@ -0,0 +1,197 @@
+// ClothNetworkAdvanceTests.cpp - Contains tests of cloth network advancement over periods of
+//                                time (stable time quantum estimation, step division and
+//                                simulation statistics), for the generic node network and
+//                                the compile-time grid cloth.
+
+#include "ClothScrollerTests.h"
+#include "ClothNodeNetwork.h"
+#include "FixedGridCloth.h"
+#include "ExternalNodeForces.h"
+
+
+// Test cloth dimensions (the compile-time grid cloth is instantiated with the same
+// dimensions).
+enum {
+	kTestNodesPerRow = 10,
+	kTestNodesPerColumn = 10,
+	kTestNodeCount = kTestNodesPerRow * kTestNodesPerColumn
+};
+
+// Test cloth parameters (physical size, node mass (kg), and spring constants - each spring
+// class uses a distinct constant, so that a representation that applies the constant of
+// another spring class does not follow the same trajectory).
+static const FloatCoord				mkTestClothWidth = 10.0;
+static const FloatCoord				mkTestClothHeight = 7.0;
+static const ScalarType				mkTestNodeMass = 0.03;
+static const ScalarType				mkTestStructSpringConstant = 10.0;
+static const ScalarType				mkTestShearSpringConstant = 1.0;
+static const ScalarType				mkTestFlexionSpringConstant = 3.0;
+static const ScalarType				mkTestTimeQuantum = 0.01;
+
+
+// Anchors the top row of a test cloth, and sets the configured time quantum.
+static bool PrepareTestCloth(CClothNetworkBase& clothNetwork)
+{
+	clothNetwork.SetForceTimeQuantum(mkTestTimeQuantum);
+
+	bool							bPreparedSuccessfully = clothNetwork.IsValid();
+
+	for (IndexType anchorLoop = 0; anchorLoop < kTestNodesPerRow; anchorLoop++) {
+		bPreparedSuccessfully = clothNetwork.SetAnchorNode(anchorLoop,
+			kTestNodesPerColumn - 1, true) && bPreparedSuccessfully;
+	}
+
+	return(bPreparedSuccessfully);
+}
+
+
+// Determines the largest difference between the node locations of two test cloths.
+static float GetLargestLocationDifference(const CClothNetworkBase& firstClothNetwork,
+										  const CClothNetworkBase& secondClothNetwork)
+{
+	float							firstNodeLocation[kTestNodeCount * 3];
+	float							firstNodeNormal[kTestNodeCount * 3];
+	float							secondNodeLocation[kTestNodeCount * 3];
+	float							secondNodeNormal[kTestNodeCount * 3];
+
+	float							largestDifference = 0.0f;
+
+	if (firstClothNetwork.GenerateNodeNetworkVertices(firstNodeLocation, firstNodeNormal) &&
+		secondClothNetwork.GenerateNodeNetworkVertices(secondNodeLocation, secondNodeNormal))
+	{
+		for (IndexType componentLoop = 0; componentLoop < (kTestNodeCount * 3);
+			componentLoop++)
+		{
+			const float				difference = (float)::fabs(firstNodeLocation[componentLoop] -
+				secondNodeLocation[componentLoop]);
+
+			if (difference > largestDifference) {
+				largestDifference = difference;
+			}
+		}
+	}
+	else {
+		largestDifference = FLT_MAX;
+	}
+
+	return(largestDifference);
+}
+
+
+bool NClothScrollerTests::RunClothNetworkAdvanceTests()
+{
+	bool							bTestsPassed = true;
+
+	CClothNodeNetwork				nodeNetwork(kTestNodesPerRow, kTestNodesPerColumn,
+		mkTestClothWidth, mkTestClothHeight, CFloatPoint(-4.5, -2.5, 0.0), mkTestNodeMass,
+		mkTestStructSpringConstant, mkTestShearSpringConstant, mkTestFlexionSpringConstant);
+	CFixedGridCloth<kTestNodesPerRow, kTestNodesPerColumn, ScalarType>
+									gridCloth(mkTestClothWidth, mkTestClothHeight,
+		CFloatPoint(-4.5, -2.5, 0.0), mkTestNodeMass, mkTestStructSpringConstant,
+		mkTestShearSpringConstant, mkTestFlexionSpringConstant);
+
+	CGravityNodeForce				gravityForce(9.8, CVector(0.0, -1.0, 0.0));
+	CViscousNodeForce				viscousForce(0.01);
+	CExternalNodeForceCollection	externalForceCollection;
+
+	externalForceCollection.AddExternalNodeForce(gravityForce);
+	externalForceCollection.AddExternalNodeForce(viscousForce);
+
+	nodeNetwork.SetSolverMode(eClothSolverSpringArray);
+
+	bTestsPassed = NClothScrollerTests::CheckCondition(PrepareTestCloth(nodeNetwork) &&
+		PrepareTestCloth(gridCloth), "Test cloths prepared") && bTestsPassed;
+
+	CClothSimulationCounters		nodeNetworkCounters;
+	CClothSimulationCounters		gridClothCounters;
+
+	nodeNetwork.SetSimulationObserver(&nodeNetworkCounters);
+	gridCloth.SetSimulationObserver(&gridClothCounters);
+
+	// Both representations contain the same springs, and thus have the same stable time
+	// quantum.
+	const ScalarType				stableTimeQuantum = nodeNetwork.EstimateStableTimeQuantum();
+
+	bTestsPassed = NClothScrollerTests::CheckCondition((stableTimeQuantum > 0.0) &&
+		(::fabs(gridCloth.EstimateStableTimeQuantum() - stableTimeQuantum) <=
+		(stableTimeQuantum * 1.0e-12)), "Stable time quantum estimates agree") &&
+		bTestsPassed;
+
+	// Periods that exceed the stable time quantum (including the safety factor) are
+	// divided into equal steps...
+	const ScalarType				longPeriod = stableTimeQuantum * 3.9;
+
+	nodeNetwork.AdvanceClothNodeNetwork(externalForceCollection, longPeriod);
+	gridCloth.AdvanceClothNodeNetwork(externalForceCollection, longPeriod);
+
+	bTestsPassed = NClothScrollerTests::CheckCondition((nodeNetworkCounters.mAdvanceCount == 1) &&
+		(nodeNetworkCounters.mStepCount == 8) && (gridClothCounters.mStepCount == 8),
+		"Long period divided into stable steps") && bTestsPassed;
+	bTestsPassed = NClothScrollerTests::CheckCondition(
+		(nodeNetworkCounters.mTimeQuantum <= nodeNetworkCounters.mStableTimeQuantum) &&
+		(nodeNetworkCounters.mStableTimeQuantum <= (stableTimeQuantum * 0.5)),
+		"Steps observe the stable time quantum") && bTestsPassed;
+
+	// ...The configured time quantum is restored...
+	bTestsPassed = NClothScrollerTests::CheckCondition(
+		(nodeNetwork.GetForceTimeQuantum() == mkTestTimeQuantum) &&
+		(gridCloth.GetForceTimeQuantum() == mkTestTimeQuantum),
+		"Configured time quantum restored") && bTestsPassed;
+
+	// ...And the maximum time quantum further limits the step size.
+	nodeNetwork.SetMaximumTimeQuantum(0.001);
+	gridCloth.SetMaximumTimeQuantum(0.001);
+
+	nodeNetwork.AdvanceClothNodeNetwork(externalForceCollection, 0.0035);
+	gridCloth.AdvanceClothNodeNetwork(externalForceCollection, 0.0035);
+
+	bTestsPassed = NClothScrollerTests::CheckCondition((nodeNetworkCounters.mStepCount == 12) &&
+		(gridClothCounters.mStepCount == 12) &&
+		(::fabs(gridClothCounters.mTimeQuantum - 0.000875) <= 1.0e-15),
+		"Maximum time quantum limits step size") && bTestsPassed;
+
+	// Periods that require more than the maximum number of steps are only partially
+	// simulated (the simulated period is accumulated, rather than the elapsed time).
+	const ScalarType				previousElapsedTime = nodeNetworkCounters.mElapsedTime;
+
+	nodeNetwork.AdvanceClothNodeNetwork(externalForceCollection, 1.0);
+	gridCloth.AdvanceClothNodeNetwork(externalForceCollection, 1.0);
+
+	bTestsPassed = NClothScrollerTests::CheckCondition((nodeNetworkCounters.mStepCount == 76) &&
+		(::fabs(nodeNetworkCounters.mElapsedTime - previousElapsedTime - 0.064) <= 1.0e-12),
+		"Step count limited, and simulated period accumulated") && bTestsPassed;
+
+	nodeNetwork.SetMaximumTimeQuantum(0.0);
+	gridCloth.SetMaximumTimeQuantum(0.0);
+
+	// Both representations follow the same trajectory.
+	for (IndexType advanceLoop = 0; advanceLoop < 200; advanceLoop++) {
+		nodeNetwork.AdvanceClothNodeNetwork(externalForceCollection, mkTestTimeQuantum);
+		gridCloth.AdvanceClothNodeNetwork(externalForceCollection, mkTestTimeQuantum);
+	}
+
+	bTestsPassed = NClothScrollerTests::CheckCondition(
+		GetLargestLocationDifference(nodeNetwork, gridCloth) <= 1.0e-4f,
+		"Node network and grid cloth trajectories agree") && bTestsPassed;
+
+	bTestsPassed = NClothScrollerTests::CheckCondition(
+		::fabs(nodeNetworkCounters.mElapsedTime - gridClothCounters.mElapsedTime) <= 1.0e-12,
+		"Elapsed time accumulated") && bTestsPassed;
+
+	// Position-based dynamics are unconditionally stable (periods are evaluated with a
+	// single step).
+	nodeNetwork.SetSolverMode(eClothSolverPositionBased);
+
+	const QuantityType				previousStepCount = nodeNetworkCounters.mStepCount;
+
+	nodeNetwork.AdvanceClothNodeNetwork(externalForceCollection, longPeriod);
+
+	bTestsPassed = NClothScrollerTests::CheckCondition(
+		((nodeNetworkCounters.mStepCount - previousStepCount) == 1) &&
+		(nodeNetworkCounters.mStableTimeQuantum == 0.0),
+		"Unconditionally stable solver uses a single step") && bTestsPassed;
+
+	::printf("  Cloth network advancement: %s\n", bTestsPassed ? "passed." : "FAILED.");
+
+	return(bTestsPassed);
+}
@@ -0,0 +1,207 @@
+// ClothNetworkSleepTests.cpp - Contains tests of sleeping cloth regions (regions that come to
+//                              rest are excluded from evaluation, and are woken when they are
+//                              disturbed), for the generic node network and the compile-time
+//                              grid cloth.
+
+#include "ClothScrollerTests.h"
+#include "ClothNodeNetwork.h"
+#include "FixedGridCloth.h"
+#include "ExternalNodeForces.h"
+
+
+// Test cloth dimensions (the compile-time grid cloth is instantiated with the same
+// dimensions).
+enum {
+	kTestNodesPerRow = 10,
+	kTestNodesPerColumn = 10,
+	kTestNodeCount = kTestNodesPerRow * kTestNodesPerColumn
+};
+
+// Test cloth parameters (physical size, node mass (kg), spring constants and time
+// quantum).
+static const FloatCoord				mkTestClothWidth = 10.0;
+static const FloatCoord				mkTestClothHeight = 7.0;
+static const ScalarType				mkTestNodeMass = 0.03;
+static const ScalarType				mkTestStructSpringConstant = 10.0;
+static const ScalarType				mkTestShearSpringConstant = 1.0;
+static const ScalarType				mkTestFlexionSpringConstant = 3.0;
+static const ScalarType				mkTestTimeQuantum = 0.01;
+
+// Mean kinetic energy per node (J) below which regions are at rest, and the number of
+// steps for which regions must remain at rest before they sleep.
+static const ScalarType				mkTestSleepEnergyThreshold = 0.000001;
+static const QuantityType			mkTestSleepStepCount = 30;
+
+// Number of steps over which the test cloths settle.
+static const QuantityType			mkTestSettleStepCount = 3000;
+
+
+// Anchors the top row of a test cloth, and sets the configured time quantum.
+static bool PrepareTestCloth(CClothNetworkBase& clothNetwork)
+{
+	clothNetwork.SetForceTimeQuantum(mkTestTimeQuantum);
+
+	bool							bPreparedSuccessfully = clothNetwork.IsValid();
+
+	for (IndexType anchorLoop = 0; anchorLoop < kTestNodesPerRow; anchorLoop++) {
+		bPreparedSuccessfully = clothNetwork.SetAnchorNode(anchorLoop,
+			kTestNodesPerColumn - 1, true) && bPreparedSuccessfully;
+	}
+
+	return(bPreparedSuccessfully);
+}
+
+
+// Determines the largest difference between the node locations of two test cloths.
+static float GetLargestLocationDifference(const CClothNetworkBase& firstClothNetwork,
+										  const CClothNetworkBase& secondClothNetwork)
+{
+	float							firstNodeLocation[kTestNodeCount * 3];
+	float							firstNodeNormal[kTestNodeCount * 3];
+	float							secondNodeLocation[kTestNodeCount * 3];
+	float							secondNodeNormal[kTestNodeCount * 3];
+
+	float							largestDifference = 0.0f;
+
+	if (firstClothNetwork.GenerateNodeNetworkVertices(firstNodeLocation, firstNodeNormal) &&
+		secondClothNetwork.GenerateNodeNetworkVertices(secondNodeLocation, secondNodeNormal))
+	{
+		for (IndexType componentLoop = 0; componentLoop < (kTestNodeCount * 3);
+			componentLoop++)
+		{
+			const float				difference = (float)::fabs(firstNodeLocation[componentLoop] -
+				secondNodeLocation[componentLoop]);
+
+			if (difference > largestDifference) {
+				largestDifference = difference;
+			}
+		}
+	}
+	else {
+		largestDifference = FLT_MAX;
+	}
+
+	return(largestDifference);
+}
+
+
+// Settles a sleeping test cloth alongside a cloth that evaluates every node, disturbs both
+// cloths with an additional external force, and verifies that the sleeping regions are
+// woken (the sleeping cloth must follow the trajectory of the reference cloth).
+static bool TestSleepingCloth(CClothNetworkBase& sleepingClothNetwork,
+							  CClothNetworkBase& referenceClothNetwork,
+							  const char* pClothDescription)
+{
+	bool							bTestsPassed = true;
+
+	CGravityNodeForce				gravityForce(9.8, CVector(0.0, -1.0, 0.0));
+	CViscousNodeForce				viscousForce(0.05);
+	CGravityNodeForce				disturbanceForce(2.0, CVector(0.0, 0.0, 1.0));
+	CExternalNodeForceCollection	externalForceCollection;
+
+	externalForceCollection.AddExternalNodeForce(gravityForce);
+	externalForceCollection.AddExternalNodeForce(viscousForce);
+
+	bTestsPassed = NClothScrollerTests::CheckCondition(
+		PrepareTestCloth(sleepingClothNetwork) && PrepareTestCloth(referenceClothNetwork) &&
+		sleepingClothNetwork.SetSleepThreshold(mkTestSleepEnergyThreshold,
+		mkTestSleepStepCount), "Sleep threshold set") && bTestsPassed;
+
+	// Regions sleep once the cloth has come to rest...
+	for (IndexType settleLoop = 0; settleLoop < mkTestSettleStepCount; settleLoop++) {
+		sleepingClothNetwork.AdvanceClothNodeNetwork(externalForceCollection,
+			mkTestTimeQuantum);
+		referenceClothNetwork.AdvanceClothNodeNetwork(externalForceCollection,
+			mkTestTimeQuantum);
+	}
+
+	const QuantityType				settledSleepingNodeCount =
+		sleepingClothNetwork.GetSleepingNodeCount();
+	const float						settledDifference = GetLargestLocationDifference(
+		sleepingClothNetwork, referenceClothNetwork);
+
+	::printf("  %s: %lu of %lu nodes sleeping (largest location difference %g).\n",
+		pClothDescription, (unsigned long)settledSleepingNodeCount,
+		(unsigned long)kTestNodeCount, settledDifference);
+
+	bTestsPassed = NClothScrollerTests::CheckCondition(settledSleepingNodeCount > 0,
+		"Resting regions sleep") && bTestsPassed;
+
+	// (Regions sleep at the threshold energy, slightly before the reference cloth comes
+	// to rest.)
+	bTestsPassed = NClothScrollerTests::CheckCondition(settledDifference <= 1.0e-2f,
+		"Settled cloth matches the reference cloth") && bTestsPassed;
+
+	// ...Are woken when the external forces change...
+	externalForceCollection.AddExternalNodeForce(disturbanceForce);
+
+	sleepingClothNetwork.AdvanceClothNodeNetwork(externalForceCollection, mkTestTimeQuantum);
+	referenceClothNetwork.AdvanceClothNodeNetwork(externalForceCollection, mkTestTimeQuantum);
+
+	bTestsPassed = NClothScrollerTests::CheckCondition(
+		sleepingClothNetwork.GetSleepingNodeCount() == 0,
+		"Disturbed regions woken") && bTestsPassed;
+
+	// ...And the disturbed cloth follows the trajectory of the reference cloth.
+	for (IndexType disturbLoop = 0; disturbLoop < 200; disturbLoop++) {
+		sleepingClothNetwork.AdvanceClothNodeNetwork(externalForceCollection,
+			mkTestTimeQuantum);
+		referenceClothNetwork.AdvanceClothNodeNetwork(externalForceCollection,
+			mkTestTimeQuantum);
+	}
+
+	bTestsPassed = NClothScrollerTests::CheckCondition(
+		GetLargestLocationDifference(sleepingClothNetwork, referenceClothNetwork) <= 1.0e-3f,
+		"Disturbed cloth matches the reference cloth") && bTestsPassed;
+
+	// Sleeping is disabled with a threshold of zero.
+	bTestsPassed = NClothScrollerTests::CheckCondition(
+		sleepingClothNetwork.SetSleepThreshold(0.0, 0) &&
+		(sleepingClothNetwork.GetSleepingNodeCount() == 0),
+		"Sleeping disabled") && bTestsPassed;
+
+	return(bTestsPassed);
+}
+
+
+bool NClothScrollerTests::RunClothNetworkSleepTests()
+{
+	bool							bTestsPassed = true;
+
+	// Generic node network (spring array solver)...
+	CClothNodeNetwork				nodeNetwork(kTestNodesPerRow, kTestNodesPerColumn,
+		mkTestClothWidth, mkTestClothHeight, CFloatPoint(-4.5, -2.5, 0.0), mkTestNodeMass,
+		mkTestStructSpringConstant, mkTestShearSpringConstant, mkTestFlexionSpringConstant);
+	CClothNodeNetwork				referenceNodeNetwork(kTestNodesPerRow,
+		kTestNodesPerColumn, mkTestClothWidth, mkTestClothHeight,
+		CFloatPoint(-4.5, -2.5, 0.0), mkTestNodeMass, mkTestStructSpringConstant,
+		mkTestShearSpringConstant, mkTestFlexionSpringConstant);
+
+	// (The node-linked solver evaluates every node.)
+	bTestsPassed = NClothScrollerTests::CheckCondition(
+		!nodeNetwork.SetSleepThreshold(mkTestSleepEnergyThreshold, mkTestSleepStepCount),
+		"Node-linked solver does not sleep") && bTestsPassed;
+
+	nodeNetwork.SetSolverMode(eClothSolverSpringArray);
+	referenceNodeNetwork.SetSolverMode(eClothSolverSpringArray);
+
+	bTestsPassed = TestSleepingCloth(nodeNetwork, referenceNodeNetwork, "Node network") &&
+		bTestsPassed;
+
+	// ...And the compile-time grid cloth.
+	CFixedGridCloth<kTestNodesPerRow, kTestNodesPerColumn, ScalarType>
+									gridCloth(mkTestClothWidth, mkTestClothHeight,
+		CFloatPoint(-4.5, -2.5, 0.0), mkTestNodeMass, mkTestStructSpringConstant,
+		mkTestShearSpringConstant, mkTestFlexionSpringConstant);
+	CFixedGridCloth<kTestNodesPerRow, kTestNodesPerColumn, ScalarType>
+									referenceGridCloth(mkTestClothWidth, mkTestClothHeight,
+		CFloatPoint(-4.5, -2.5, 0.0), mkTestNodeMass, mkTestStructSpringConstant,
+		mkTestShearSpringConstant, mkTestFlexionSpringConstant);
+
+	bTestsPassed = TestSleepingCloth(gridCloth, referenceGridCloth, "Grid cloth") &&
+		bTestsPassed;
+
+	::printf("  Cloth network sleeping: %s\n", bTestsPassed ? "passed." : "FAILED.");
+
+	return(bTestsPassed);
+}
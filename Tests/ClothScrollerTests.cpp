@@ -0,0 +1,54 @@
+// ClothScrollerTests.cpp - Contains the entry point for the ClothScroller test program, which
+//                          runs each test suite and reports the results to the console (the
+//                          program exit code is non-zero if any test fails). Benchmarks
+//                          are run in place of the tests when "benchmark" is specified on
+//                          the command line.
+
+#include "ClothScrollerTests.h"
+#include <string.h>
+
+
+bool NClothScrollerTests::CheckCondition(const bool bCondition,
+										 const char* pConditionDescription)
+{
+	if (!bCondition) {
+		::printf("    FAILED: %s\n", pConditionDescription);
+	}
+
+	return(bCondition);
+}
+
+
+int main(int argc, char* argv[])
+{
+	bool							bTestsPassed = true;
+
+	if ((argc > 1) && (::strcmp(argv[1], "benchmark") == 0)) {
+		::printf("Spring force kernel benchmark...\n");
+		NClothScrollerTests::RunSpringForceBenchmark();
+
+		return(0);
+	}
+
+	::printf("Spring force kernel tests...\n");
+	bTestsPassed = NClothScrollerTests::RunSpringForceKernelTests() && bTestsPassed;
+
+	::printf("Cloth network advancement tests...\n");
+	bTestsPassed = NClothScrollerTests::RunClothNetworkAdvanceTests() && bTestsPassed;
+
+	::printf("Cloth network sleeping tests...\n");
+	bTestsPassed = NClothScrollerTests::RunClothNetworkSleepTests() && bTestsPassed;
+
+	::printf("Cloth solver tests...\n");
+	bTestsPassed = NClothScrollerTests::RunClothSolverTests() && bTestsPassed;
+
+	::printf("Grid mesh rendering tests...\n");
+	bTestsPassed = NClothScrollerTests::RunGridMeshRenderTests() && bTestsPassed;
+
+	::printf("Mesh allocation tests...\n");
+	bTestsPassed = NClothScrollerTests::RunMeshAllocationTests() && bTestsPassed;
+
+	::printf(bTestsPassed ? "All tests passed.\n" : "One or more tests failed.\n");
+
+	return(bTestsPassed ? 0 : 1);
+}
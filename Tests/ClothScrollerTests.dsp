@@ -0,0 +1,215 @@
+# Microsoft Developer Studio Project File - Name="ClothScrollerTests" - Package Owner=<4>
+# Microsoft Developer Studio Generated Build File, Format Version 6.00
+# ** DO NOT EDIT **
+
+# TARGTYPE "Win32 (x86) Console Application" 0x0103
+
+CFG=ClothScroller - Win32 Debug
+!MESSAGE This is not a valid makefile. To build this project using NMAKE,
+!MESSAGE use the Export Makefile command and run
+!MESSAGE 
+!MESSAGE NMAKE /f "ClothScrollerTests.mak".
+!MESSAGE 
+!MESSAGE You can specify a configuration when running NMAKE
+!MESSAGE by defining the macro CFG on the command line. For example:
+!MESSAGE 
+!MESSAGE NMAKE /f "ClothScrollerTests.mak" CFG="ClothScrollerTests - Win32 Debug"
+!MESSAGE 
+!MESSAGE Possible choices for configuration are:
+!MESSAGE 
+!MESSAGE "ClothScrollerTests - Win32 Release" (based on "Win32 (x86) Console Application")
+!MESSAGE "ClothScrollerTests - Win32 Debug" (based on "Win32 (x86) Console Application")
+!MESSAGE 
+
+# Begin Project
+# PROP AllowPerConfigDependencies 0
+# PROP Scc_ProjName ""
+# PROP Scc_LocalPath ""
+CPP=cl.exe
+MTL=midl.exe
+RSC=rc.exe
+
+!IF  "$(CFG)" == "ClothScrollerTests - Win32 Release"
+
+# PROP BASE Use_MFC 0
+# PROP BASE Use_Debug_Libraries 0
+# PROP BASE Output_Dir "Release"
+# PROP BASE Intermediate_Dir "Release"
+# PROP BASE Target_Dir ""
+# PROP Use_MFC 0
+# PROP Use_Debug_Libraries 0
+# PROP Output_Dir "Release"
+# PROP Intermediate_Dir "Release"
+# PROP Ignore_Export_Lib 0
+# PROP Target_Dir ""
+# ADD BASE CPP /nologo /W3 /GX /O2 /D "WIN32" /D "NDEBUG" /D "_CONSOLE" /D "_MBCS" /YX /FD /c
+# ADD CPP /nologo /GR /GX /O2 /I ".." /I "D:\Application Data\Work\Development Projects\Visual Studio Additional Libraries\GLUT\Include" /D "WIN32" /D "NDEBUG" /D "_CONSOLE" /D "_MBCS" /YX /FD /c
+# ADD BASE MTL /nologo /D "NDEBUG" /mktyplib203 /win32
+# ADD MTL /nologo /D "NDEBUG" /mktyplib203 /win32
+# ADD BASE RSC /l 0x409 /d "NDEBUG"
+# ADD RSC /l 0x409 /d "NDEBUG"
+BSC32=bscmake.exe
+# ADD BASE BSC32 /nologo
+# ADD BSC32 /nologo
+LINK32=link.exe
+# ADD BASE LINK32 kernel32.lib user32.lib gdi32.lib winspool.lib comdlg32.lib advapi32.lib shell32.lib ole32.lib oleaut32.lib uuid.lib odbc32.lib odbccp32.lib /nologo /subsystem:console /machine:I386
+# ADD LINK32 kernel32.lib user32.lib gdi32.lib winspool.lib comdlg32.lib advapi32.lib shell32.lib ole32.lib oleaut32.lib uuid.lib odbc32.lib odbccp32.lib opengl32.lib glu32.lib glut32.lib /nologo /subsystem:console /machine:I386 /libpath:"D:\Application Data\Work\Development Projects\Visual Studio Additional Libraries\GLUT\LIB"
+
+!ELSEIF  "$(CFG)" == "ClothScrollerTests - Win32 Debug"
+
+# PROP BASE Use_MFC 0
+# PROP BASE Use_Debug_Libraries 1
+# PROP BASE Output_Dir "Debug"
+# PROP BASE Intermediate_Dir "Debug"
+# PROP BASE Target_Dir ""
+# PROP Use_MFC 0
+# PROP Use_Debug_Libraries 1
+# PROP Output_Dir "Debug"
+# PROP Intermediate_Dir "Debug"
+# PROP Ignore_Export_Lib 0
+# PROP Target_Dir ""
+# ADD BASE CPP /nologo /W3 /Gm /GX /ZI /Od /D "WIN32" /D "_DEBUG" /D "_CONSOLE" /D "_MBCS" /YX /FD /GZ /c
+# ADD CPP /nologo /W3 /Gm /GR /GX /ZI /Od /I ".." /I "D:\Application Data\Work\Development Projects\Visual Studio Additional Libraries\GLUT\Include" /D "WIN32" /D "_DEBUG" /D "_CONSOLE" /D "_MBCS" /YX /FD /GZ /c
+# ADD BASE MTL /nologo /D "_DEBUG" /mktyplib203 /win32
+# ADD MTL /nologo /D "_DEBUG" /mktyplib203 /win32
+# ADD BASE RSC /l 0x409 /d "_DEBUG"
+# ADD RSC /l 0x409 /d "_DEBUG"
+BSC32=bscmake.exe
+# ADD BASE BSC32 /nologo
+# ADD BSC32 /nologo
+LINK32=link.exe
+# ADD BASE LINK32 kernel32.lib user32.lib gdi32.lib winspool.lib comdlg32.lib advapi32.lib shell32.lib ole32.lib oleaut32.lib uuid.lib odbc32.lib odbccp32.lib /nologo /subsystem:console /debug /machine:I386 /pdbtype:sept
+# ADD LINK32 kernel32.lib user32.lib gdi32.lib winspool.lib comdlg32.lib advapi32.lib shell32.lib ole32.lib oleaut32.lib uuid.lib odbc32.lib odbccp32.lib opengl32.lib glu32.lib glut32.lib /nologo /subsystem:console /debug /machine:I386 /pdbtype:sept /libpath:"D:\Application Data\Work\Development Projects\Visual Studio Additional Libraries\GLUT\LIB"
+
+!ENDIF 
+
+# Begin Target
+
+# Name "ClothScrollerTests - Win32 Release"
+# Name "ClothScrollerTests - Win32 Debug"
+# Begin Group "Source Files"
+
+# PROP Default_Filter "cpp;c;cxx;rc;def;r;odl;idl;hpj;bat"
+# Begin Group "ClothScrollerTests"
+
+# PROP Default_Filter ""
+# Begin Source File
+
+SOURCE=.\ClothNetworkAdvanceTests.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\ClothNetworkSleepTests.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\ClothScrollerTests.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\ClothSolverTests.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\GridMeshRenderTests.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\MeshAllocationTests.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\SpringForceBenchmark.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\SpringForceKernelTests.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\TestRenderingContext.cpp
+# End Source File
+# End Group
+# Begin Group "ClothScroller (Tested Sources)"
+
+# PROP Default_Filter ""
+# Begin Source File
+
+SOURCE=..\ClothNetworkBase.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\ClothNodeNetwork.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\ClothSpringArraySolver.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\ExternalNodeForces.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\MemoryUtility.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\ModelGeometry.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\ModelGeometryOpenGL.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\OpenGLExtensions.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\PhysicalNode.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\PrimitiveSupport.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\SparseBlockMatrix.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\SpringForceKernels.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\SystemSupport.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\WindFieldProducer.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\WindNoiseField.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\WorkerThreadPool.cpp
+# End Source File
+# End Group
+# End Group
+# Begin Group "Header Files"
+
+# PROP Default_Filter "h;hpp;hxx;hm;inl"
+# Begin Source File
+
+SOURCE=.\ClothScrollerTests.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\TestRenderingContext.h
+# End Source File
+# End Group
+# End Target
+# End Project
@@ -0,0 +1,33 @@
+// ClothScrollerTests.h - Contains declarations for the ClothScroller test program (deterministic
+//                        tests of the simulation/rendering modules, run from the console).
+
+#ifndef _CLOTHSCROLLERTESTS_H
+#define _CLOTHSCROLLERTESTS_H		1
+
+
+#include "PrimaryHeaders.h"
+#include "PrimitiveSupport.h"
+
+
+namespace NClothScrollerTests
+{
+	// Reports the outcome of a single test condition (failures are written to the
+	// console) - returns the condition.
+	bool							CheckCondition(const bool bCondition,
+		const char* pConditionDescription);
+
+	// Test suites - each suite returns true if all of its tests passed.
+	bool							RunSpringForceKernelTests();
+	bool							RunClothNetworkAdvanceTests();
+	bool							RunClothNetworkSleepTests();
+	bool							RunClothSolverTests();
+	bool							RunGridMeshRenderTests();
+	bool							RunMeshAllocationTests();
+
+	// Benchmarks (run when requested on the command line - results are written to the
+	// console).
+	void							RunSpringForceBenchmark();
+};
+
+
+#endif	// #ifndef _CLOTHSCROLLERTESTS_H
@@ -0,0 +1,461 @@
+// ClothSolverTests.cpp - Contains tests of the solver configurations of the generic node
+//                        network, each evaluated against the default configuration (or
+//                        against the expected bounds of the cloth motion).
+
+#include "ClothScrollerTests.h"
+#include "ClothNodeNetwork.h"
+#include "ExternalNodeForces.h"
+
+
+// Test cloth dimensions.
+static const QuantityType			mkTestNodesPerRow = 10;
+static const QuantityType			mkTestNodesPerColumn = 10;
+
+// Test cloth parameters (physical size, node mass (kg), and spring constants).
+static const FloatCoord				mkTestClothWidth = 10.0;
+static const FloatCoord				mkTestClothHeight = 7.0;
+static const ScalarType				mkTestNodeMass = 0.03;
+static const ScalarType				mkTestStructSpringConstant = 10.0;
+static const ScalarType				mkTestShearSpringConstant = 1.0;
+static const ScalarType				mkTestFlexionSpringConstant = 3.0;
+
+// Structural spring constant of the stiff test cloth, and the time quantum with which the
+// stiff cloth is evaluated (more than ten times the stable time quantum of explicit
+// integration).
+static const ScalarType				mkStiffStructSpringConstant = 1000.0;
+static const ScalarType				mkStiffTimeQuantum = 0.05;
+
+// Distance from the origin beyond which a test cloth is considered to be unbounded (the
+// cloth spans 10 x 7 units).
+static const float					mkBoundedClothExtent = 100.0f;
+
+// Maximum spring elongation permitted by the strain limit (fraction of the resting
+// length).
+static const ScalarType				mkMaximumSpringElongation = 0.1;
+
+// Dimensions of the cloth evaluated with multiple threads (large enough for springs and
+// nodes to be divided among the threads).
+static const QuantityType			mkThreadedNodesPerRow = 64;
+static const QuantityType			mkThreadedNodesPerColumn = 64;
+
+
+// Creates a test cloth evaluated by the spring array solver, with the top row anchored.
+static CClothNodeNetwork* CreateTestCloth(const QuantityType nodesPerRow,
+										  const QuantityType nodesPerColumn,
+										  const ScalarType structSpringConstant,
+										  const ScalarType timeQuantum)
+{
+	CClothNodeNetwork*				pClothNetwork = new CClothNodeNetwork(nodesPerRow,
+		nodesPerColumn, mkTestClothWidth, mkTestClothHeight, CFloatPoint(-4.5, -2.5, 0.0),
+		mkTestNodeMass, structSpringConstant, mkTestShearSpringConstant,
+		mkTestFlexionSpringConstant);
+
+	pClothNetwork->SetSolverMode(eClothSolverSpringArray);
+	pClothNetwork->SetForceTimeQuantum(timeQuantum);
+
+	for (IndexType anchorLoop = 0; anchorLoop < nodesPerRow; anchorLoop++) {
+		pClothNetwork->SetAnchorNode(anchorLoop, nodesPerColumn - 1, true);
+	}
+
+	return(pClothNetwork);
+}
+
+
+// Retrieves the node locations of a cloth (three interleaved coordinates per node).
+static bool GetClothNodeLocations(const CClothNetworkBase& clothNetwork,
+								  std::vector<float>& nodeLocation)
+{
+	QuantityType					nodesPerRow = 0;
+	QuantityType					nodesPerColumn = 0;
+
+	clothNetwork.GetNodeGridDimensions(nodesPerRow, nodesPerColumn);
+
+	std::vector<float>				nodeNormal(nodesPerRow * nodesPerColumn * 3);
+
+	nodeLocation.resize(nodeNormal.size());
+
+	return(!nodeLocation.empty() && clothNetwork.GenerateNodeNetworkVertices(
+		&nodeLocation[0], &nodeNormal[0]));
+}
+
+
+// Determines the largest distance of a cloth node coordinate from the origin (FLT_MAX if
+// the cloth contains invalid coordinates).
+static float GetLargestClothExtent(const CClothNetworkBase& clothNetwork)
+{
+	std::vector<float>				nodeLocation;
+
+	float							largestExtent = FLT_MAX;
+
+	if (GetClothNodeLocations(clothNetwork, nodeLocation)) {
+		largestExtent = 0.0f;
+
+		for (IndexType componentLoop = 0; componentLoop < nodeLocation.size();
+			componentLoop++)
+		{
+			const float				extent = (float)::fabs(nodeLocation[componentLoop]);
+
+			// (Comparisons with NaN coordinates fail.)
+			if (!(extent <= largestExtent)) {
+				largestExtent = (extent <= FLT_MAX) ? extent : FLT_MAX;
+			}
+		}
+	}
+
+	return(largestExtent);
+}
+
+
+// Determines the largest difference between the node locations of two cloths with the
+// same dimensions.
+static float GetLargestLocationDifference(const CClothNetworkBase& firstClothNetwork,
+										  const CClothNetworkBase& secondClothNetwork)
+{
+	std::vector<float>				firstNodeLocation;
+	std::vector<float>				secondNodeLocation;
+
+	float							largestDifference = FLT_MAX;
+
+	if (GetClothNodeLocations(firstClothNetwork, firstNodeLocation) &&
+		GetClothNodeLocations(secondClothNetwork, secondNodeLocation) &&
+		(firstNodeLocation.size() == secondNodeLocation.size()))
+	{
+		largestDifference = 0.0f;
+
+		for (IndexType componentLoop = 0; componentLoop < firstNodeLocation.size();
+			componentLoop++)
+		{
+			const float				difference = (float)::fabs(firstNodeLocation[componentLoop] -
+				secondNodeLocation[componentLoop]);
+
+			if (!(difference <= largestDifference)) {
+				largestDifference = (difference <= FLT_MAX) ? difference : FLT_MAX;
+			}
+		}
+	}
+
+	return(largestDifference);
+}
+
+
+// Determines the largest elongation of the structural springs of a cloth, relative to the
+// resting length (grid nodes are initially spaced evenly across the cloth width and
+// height).
+static float GetLargestStructuralElongation(const CClothNetworkBase& clothNetwork)
+{
+	std::vector<float>				nodeLocation;
+
+	QuantityType					nodesPerRow = 0;
+	QuantityType					nodesPerColumn = 0;
+
+	float							largestElongation = FLT_MAX;
+
+	clothNetwork.GetNodeGridDimensions(nodesPerRow, nodesPerColumn);
+
+	if (GetClothNodeLocations(clothNetwork, nodeLocation)) {
+		const float					restingLength[] = { (float)(mkTestClothWidth / nodesPerRow),
+			(float)(mkTestClothHeight / nodesPerColumn) };
+		const QuantityType			neighborOffset[] = { 1, nodesPerRow };
+
+		largestElongation = 0.0f;
+
+		for (IndexType yLoop = 0; yLoop < nodesPerColumn; yLoop++) {
+			for (IndexType xLoop = 0; xLoop < nodesPerRow; xLoop++) {
+				const IndexType		nodeIndex = (yLoop * nodesPerRow) + xLoop;
+				const bool			bHasNeighbor[] = { (xLoop + 1) < nodesPerRow,
+					(yLoop + 1) < nodesPerColumn };
+
+				// Springs along the x-axis and the y-axis.
+				for (IndexType axisLoop = 0; axisLoop < 2; axisLoop++) {
+					if (bHasNeighbor[axisLoop]) {
+						const float*	pHeadLocation = &nodeLocation[nodeIndex * 3];
+						const float*	pTailLocation = &nodeLocation[(nodeIndex +
+							neighborOffset[axisLoop]) * 3];
+						const float	springLength = (float)::sqrt(
+							((pHeadLocation[0] - pTailLocation[0]) *
+							(pHeadLocation[0] - pTailLocation[0])) +
+							((pHeadLocation[1] - pTailLocation[1]) *
+							(pHeadLocation[1] - pTailLocation[1])) +
+							((pHeadLocation[2] - pTailLocation[2]) *
+							(pHeadLocation[2] - pTailLocation[2])));
+						const float	elongation = (springLength / restingLength[axisLoop]) -
+							1.0f;
+
+						if (!(elongation <= largestElongation)) {
+							largestElongation = (elongation <= FLT_MAX) ? elongation :
+								FLT_MAX;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	return(largestElongation);
+}
+
+
+// Implicit (backward Euler) integration remains stable when a stiff cloth is evaluated
+// with a time quantum that exceeds the stable time quantum of explicit integration, and
+// follows the explicit trajectory when both are evaluated with a small time quantum.
+static bool TestImplicitIntegration(const CExternalNodeForceCollection& externalForceCollection)
+{
+	bool							bTestsPassed = true;
+
+	// Stiff cloth (each step is evaluated with the specified time quantum)...
+	CClothNodeNetwork*				pImplicitCloth = CreateTestCloth(mkTestNodesPerRow,
+		mkTestNodesPerColumn, mkStiffStructSpringConstant, mkStiffTimeQuantum);
+	CClothNodeNetwork*				pExplicitCloth = CreateTestCloth(mkTestNodesPerRow,
+		mkTestNodesPerColumn, mkStiffStructSpringConstant, mkStiffTimeQuantum);
+
+	bTestsPassed = NClothScrollerTests::CheckCondition(
+		pImplicitCloth->SetNodeIntegrator(eNodeIntegratorImplicitEuler, 0.0) &&
+		((pImplicitCloth->EstimateStableTimeQuantum() * 10.0) < mkStiffTimeQuantum),
+		"Stiff cloth exceeds the explicit stable time quantum") && bTestsPassed;
+
+	for (IndexType stepLoop = 0; stepLoop < 100; stepLoop++) {
+		pImplicitCloth->EvaluateClothNodeNetworkForces(externalForceCollection);
+		pExplicitCloth->EvaluateClothNodeNetworkForces(externalForceCollection);
+	}
+
+	const float						implicitExtent = GetLargestClothExtent(*pImplicitCloth);
+	const float						explicitExtent = GetLargestClothExtent(*pExplicitCloth);
+
+	::printf("  Stiff cloth extent: %g (implicit), %g (explicit).\n", implicitExtent,
+		explicitExtent);
+
+	bTestsPassed = NClothScrollerTests::CheckCondition(implicitExtent < mkBoundedClothExtent,
+		"Implicit integration of a stiff cloth remains bounded") && bTestsPassed;
+	bTestsPassed = NClothScrollerTests::CheckCondition(explicitExtent > mkBoundedClothExtent,
+		"Explicit integration of a stiff cloth diverges") && bTestsPassed;
+
+	delete(pImplicitCloth);
+	delete(pExplicitCloth);
+
+	// ...And a small time quantum (one second of motion).
+	const ScalarType				smallTimeQuantum = 0.0001;
+
+	pImplicitCloth = CreateTestCloth(mkTestNodesPerRow, mkTestNodesPerColumn,
+		mkTestStructSpringConstant, smallTimeQuantum);
+	pExplicitCloth = CreateTestCloth(mkTestNodesPerRow, mkTestNodesPerColumn,
+		mkTestStructSpringConstant, smallTimeQuantum);
+
+	pImplicitCloth->SetNodeIntegrator(eNodeIntegratorImplicitEuler, 0.0);
+
+	for (IndexType stepLoop = 0; stepLoop < 10000; stepLoop++) {
+		pImplicitCloth->EvaluateClothNodeNetworkForces(externalForceCollection);
+		pExplicitCloth->EvaluateClothNodeNetworkForces(externalForceCollection);
+	}
+
+	const float						integratorDifference = GetLargestLocationDifference(
+		*pImplicitCloth, *pExplicitCloth);
+
+	::printf("  Implicit/explicit location difference: %g.\n", integratorDifference);
+
+	bTestsPassed = NClothScrollerTests::CheckCondition(integratorDifference <= 1.0e-3f,
+		"Implicit and explicit trajectories agree") && bTestsPassed;
+
+	delete(pImplicitCloth);
+	delete(pExplicitCloth);
+
+	return(bTestsPassed);
+}
+
+
+// Cloths evaluated with multiple threads follow exactly the same trajectory as a cloth
+// evaluated with a single thread.
+static bool TestWorkerThreadCounts(const CExternalNodeForceCollection& externalForceCollection)
+{
+	bool							bTestsPassed = true;
+
+	const QuantityType				threadCounts[] = { 2, 3, 4 };
+	const QuantityType				threadCountCount = sizeof(threadCounts) /
+		sizeof(threadCounts[0]);
+
+	CClothNodeNetwork*				pSingleThreadCloth = CreateTestCloth(
+		mkThreadedNodesPerRow, mkThreadedNodesPerColumn, mkTestStructSpringConstant, 0.001);
+
+	for (IndexType stepLoop = 0; stepLoop < 100; stepLoop++) {
+		pSingleThreadCloth->EvaluateClothNodeNetworkForces(externalForceCollection);
+	}
+
+	for (IndexType threadLoop = 0; threadLoop < threadCountCount; threadLoop++) {
+		CClothNodeNetwork*			pThreadedCloth = CreateTestCloth(mkThreadedNodesPerRow,
+			mkThreadedNodesPerColumn, mkTestStructSpringConstant, 0.001);
+
+		bTestsPassed = NClothScrollerTests::CheckCondition(
+			pThreadedCloth->SetWorkerThreadCount(threadCounts[threadLoop]) &&
+			(pThreadedCloth->GetWorkerThreadCount() == threadCounts[threadLoop]),
+			"Worker threads created") && bTestsPassed;
+
+		for (IndexType stepLoop = 0; stepLoop < 100; stepLoop++) {
+			pThreadedCloth->EvaluateClothNodeNetworkForces(externalForceCollection);
+		}
+
+		bTestsPassed = NClothScrollerTests::CheckCondition(
+			GetLargestLocationDifference(*pThreadedCloth, *pSingleThreadCloth) == 0.0f,
+			"Threaded and single-threaded trajectories match") && bTestsPassed;
+
+		delete(pThreadedCloth);
+	}
+
+	delete(pSingleThreadCloth);
+
+	return(bTestsPassed);
+}
+
+
+// Strain limiting constrains the elongation of the cloth springs (the unconstrained cloth
+// stretches beyond the limit).
+static bool TestStrainLimit(const CExternalNodeForceCollection& externalForceCollection)
+{
+	bool							bTestsPassed = true;
+
+	CClothNodeNetwork*				pLimitedCloth = CreateTestCloth(mkTestNodesPerRow,
+		mkTestNodesPerColumn, mkTestStructSpringConstant, 0.01);
+	CClothNodeNetwork*				pUnlimitedCloth = CreateTestCloth(mkTestNodesPerRow,
+		mkTestNodesPerColumn, mkTestStructSpringConstant, 0.01);
+
+	bTestsPassed = NClothScrollerTests::CheckCondition(
+		pLimitedCloth->SetStrainLimit(mkMaximumSpringElongation, 20),
+		"Strain limit set") && bTestsPassed;
+
+	// The largest elongation is determined over the entire motion.
+	float							limitedElongation = 0.0f;
+	float							unlimitedElongation = 0.0f;
+
+	for (IndexType advanceLoop = 0; advanceLoop < 300; advanceLoop++) {
+		pLimitedCloth->AdvanceClothNodeNetwork(externalForceCollection, 0.01);
+		pUnlimitedCloth->AdvanceClothNodeNetwork(externalForceCollection, 0.01);
+
+		const float					currentLimitedElongation =
+			GetLargestStructuralElongation(*pLimitedCloth);
+		const float					currentUnlimitedElongation =
+			GetLargestStructuralElongation(*pUnlimitedCloth);
+
+		if (!(currentLimitedElongation <= limitedElongation)) {
+			limitedElongation = currentLimitedElongation;
+		}
+
+		if (!(currentUnlimitedElongation <= unlimitedElongation)) {
+			unlimitedElongation = currentUnlimitedElongation;
+		}
+	}
+
+	::printf("  Largest spring elongation: %g (strain limited), %g (unconstrained).\n",
+		limitedElongation, unlimitedElongation);
+
+	bTestsPassed = NClothScrollerTests::CheckCondition(
+		unlimitedElongation > (float)mkMaximumSpringElongation,
+		"Unconstrained cloth exceeds the strain limit") && bTestsPassed;
+	bTestsPassed = NClothScrollerTests::CheckCondition(
+		limitedElongation <= (float)(mkMaximumSpringElongation + 1.0e-3),
+		"Strain limit constrains spring elongation") && bTestsPassed;
+
+	delete(pLimitedCloth);
+	delete(pUnlimitedCloth);
+
+	return(bTestsPassed);
+}
+
+
+// Position-based dynamics remain stable when a stiff cloth is evaluated with a large time
+// quantum, using either constraint solver method.
+static bool TestPositionBasedSolvers(const CExternalNodeForceCollection&
+									 externalForceCollection)
+{
+	bool							bTestsPassed = true;
+
+	const EConstraintSolverMethod	constraintSolverMethods[] = {
+		eConstraintSolverGaussSeidel, eConstraintSolverJacobi };
+	const char*						pConstraintSolverNames[] = { "Gauss-Seidel", "Jacobi" };
+
+	for (IndexType methodLoop = 0; methodLoop < 2; methodLoop++) {
+		CClothNodeNetwork*			pClothNetwork = CreateTestCloth(mkTestNodesPerRow,
+			mkTestNodesPerColumn, mkStiffStructSpringConstant, mkStiffTimeQuantum);
+
+		bTestsPassed = NClothScrollerTests::CheckCondition(
+			pClothNetwork->SetSolverMode(eClothSolverPositionBased) &&
+			pClothNetwork->SetConstraintSolver(constraintSolverMethods[methodLoop], 10),
+			"Position-based solver selected") && bTestsPassed;
+
+		for (IndexType stepLoop = 0; stepLoop < 400; stepLoop++) {
+			pClothNetwork->EvaluateClothNodeNetworkForces(externalForceCollection);
+		}
+
+		const float					clothExtent = GetLargestClothExtent(*pClothNetwork);
+		const float					springElongation = GetLargestStructuralElongation(
+			*pClothNetwork);
+
+		::printf("  Position-based stiff cloth (%s): extent %g, spring elongation %g.\n",
+			pConstraintSolverNames[methodLoop], clothExtent, springElongation);
+
+		bTestsPassed = NClothScrollerTests::CheckCondition(
+			(clothExtent < mkBoundedClothExtent) && (springElongation < 0.25f),
+			"Position-based stiff cloth remains bounded") && bTestsPassed;
+
+		delete(pClothNetwork);
+	}
+
+	return(bTestsPassed);
+}
+
+
+// Single-precision node state follows the double-precision trajectory closely (the test
+// forces do not include wind, which is sensitive to small differences in the node normals).
+static bool TestSinglePrecision(const CExternalNodeForceCollection& externalForceCollection)
+{
+	bool							bTestsPassed = true;
+
+	CClothNodeNetwork*				pSingleCloth = CreateTestCloth(mkTestNodesPerRow,
+		mkTestNodesPerColumn, mkTestStructSpringConstant, 0.01);
+	CClothNodeNetwork*				pDoubleCloth = CreateTestCloth(mkTestNodesPerRow,
+		mkTestNodesPerColumn, mkTestStructSpringConstant, 0.01);
+
+	bTestsPassed = NClothScrollerTests::CheckCondition(
+		pSingleCloth->SetSolverPrecision(eSolverPrecisionSingle) &&
+		(pSingleCloth->GetSolverPrecision() == eSolverPrecisionSingle),
+		"Single precision selected") && bTestsPassed;
+
+	for (IndexType advanceLoop = 0; advanceLoop < 300; advanceLoop++) {
+		pSingleCloth->AdvanceClothNodeNetwork(externalForceCollection, 0.01);
+		pDoubleCloth->AdvanceClothNodeNetwork(externalForceCollection, 0.01);
+	}
+
+	const float						precisionDifference = GetLargestLocationDifference(
+		*pSingleCloth, *pDoubleCloth);
+
+	::printf("  Single/double precision location difference: %g.\n", precisionDifference);
+
+	bTestsPassed = NClothScrollerTests::CheckCondition(precisionDifference <= 1.0e-4f,
+		"Single precision follows the double-precision trajectory") && bTestsPassed;
+
+	delete(pSingleCloth);
+	delete(pDoubleCloth);
+
+	return(bTestsPassed);
+}
+
+
+bool NClothScrollerTests::RunClothSolverTests()
+{
+	bool							bTestsPassed = true;
+
+	// (Wind is not applied - the tests compare deterministic trajectories.)
+	CGravityNodeForce				gravityForce(9.8, CVector(0.0, -1.0, 0.0));
+	CViscousNodeForce				viscousForce(0.01);
+	CExternalNodeForceCollection	externalForceCollection;
+
+	externalForceCollection.AddExternalNodeForce(gravityForce);
+	externalForceCollection.AddExternalNodeForce(viscousForce);
+
+	bTestsPassed = TestImplicitIntegration(externalForceCollection) && bTestsPassed;
+	bTestsPassed = TestWorkerThreadCounts(externalForceCollection) && bTestsPassed;
+	bTestsPassed = TestStrainLimit(externalForceCollection) && bTestsPassed;
+	bTestsPassed = TestPositionBasedSolvers(externalForceCollection) && bTestsPassed;
+	bTestsPassed = TestSinglePrecision(externalForceCollection) && bTestsPassed;
+
+	::printf("  Cloth solvers: %s\n", bTestsPassed ? "passed." : "FAILED.");
+
+	return(bTestsPassed);
+}
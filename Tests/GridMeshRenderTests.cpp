@@ -0,0 +1,219 @@
+// GridMeshRenderTests.cpp - Contains tests that render a grid mesh using buffer objects, and
+//                           using client-side arrays (the fallback used when buffer objects
+//                           are unavailable), and compare the rendered images.
+
+#include "ClothScrollerTests.h"
+#include "ModelGeometryOpenGL.h"
+#include "OpenGLExtensions.h"
+#include "TestRenderingContext.h"
+#include <stdlib.h>
+#include <algorithm>
+
+
+// Dimensions of the rendered image (pixels).
+static const GLsizei				mkTestImageWidth = 128;
+static const GLsizei				mkTestImageHeight = 128;
+
+// Dimensions of the test mesh (vertices), and of its texture image (texels).
+static const QuantityType			mkTestVerticesPerRow = 12;
+static const QuantityType			mkTestVerticesPerColumn = 9;
+static const QuantityType			mkTestTextureWidth = 32;
+static const QuantityType			mkTestTextureHeight = 32;
+
+// Permitted difference between corresponding color components of the rendered images, and
+// the minimum fraction of the image that the mesh must cover.
+static const int					mkMaxComponentDifference = 1;
+static const double					mkMinimumCoveredFraction = 0.25;
+
+
+// Renders a lit, textured test mesh (a surface with a fixed ripple), and stores the rendered
+// image (RGBA). Returns true if the mesh was rendered without errors, and the mesh used
+// buffer objects as expected.
+static bool RenderTestMesh(const bool bExpectBufferObjects,
+						   std::vector<unsigned char>& renderedImage)
+{
+	COpenGLGridMesh					gridMesh(mkTestVerticesPerRow, mkTestVerticesPerColumn);
+
+	GLfloat*						pVertexLocation = gridMesh.GetVertexLocationArray();
+	GLfloat*						pVertexNormal = gridMesh.GetVertexNormalArray();
+
+	// Vertex locations span [-1, 1] along the x and y axes (z = a sin(x) cos(y) ripple),
+	// with normals determined from the surface derivatives.
+	for (IndexType yLoop = 0; yLoop < mkTestVerticesPerColumn; yLoop++) {
+		for (IndexType xLoop = 0; xLoop < mkTestVerticesPerRow; xLoop++) {
+			const IndexType			vertexIndex = (yLoop * mkTestVerticesPerRow) + xLoop;
+			const double			xCoord = ((2.0 * xLoop) / (mkTestVerticesPerRow - 1)) -
+				1.0;
+			const double			yCoord = ((2.0 * yLoop) / (mkTestVerticesPerColumn - 1)) -
+				1.0;
+			const double			rippleAmplitude = 0.3;
+
+			const double			slopeX = rippleAmplitude * 3.0 * ::cos(3.0 * xCoord) *
+				::cos(2.0 * yCoord);
+			const double			slopeY = -rippleAmplitude * 2.0 * ::sin(3.0 * xCoord) *
+				::sin(2.0 * yCoord);
+			const double			normalLength = ::sqrt((slopeX * slopeX) +
+				(slopeY * slopeY) + 1.0);
+
+			pVertexLocation[(vertexIndex * 3)] = (GLfloat)(0.9 * xCoord);
+			pVertexLocation[(vertexIndex * 3) + 1] = (GLfloat)(0.9 * yCoord);
+			pVertexLocation[(vertexIndex * 3) + 2] = (GLfloat)(rippleAmplitude *
+				::sin(3.0 * xCoord) * ::cos(2.0 * yCoord));
+
+			pVertexNormal[(vertexIndex * 3)] = (GLfloat)(-slopeX / normalLength);
+			pVertexNormal[(vertexIndex * 3) + 1] = (GLfloat)(-slopeY / normalLength);
+			pVertexNormal[(vertexIndex * 3) + 2] = (GLfloat)(1.0 / normalLength);
+		}
+	}
+
+	// The texture image is a checkerboard, with a gradient in each color component.
+	std::vector<unsigned char>		textureImage(mkTestTextureWidth * mkTestTextureHeight * 4);
+
+	for (IndexType texelLoop = 0; texelLoop < (mkTestTextureWidth * mkTestTextureHeight);
+		texelLoop++)
+	{
+		const IndexType				texelX = texelLoop % mkTestTextureWidth;
+		const IndexType				texelY = texelLoop / mkTestTextureWidth;
+		const bool					bLightSquare = (((texelX / 4) + (texelY / 4)) % 2) == 0;
+
+		textureImage[(texelLoop * 4)] = (unsigned char)(bLightSquare ? 255 : (texelX * 6));
+		textureImage[(texelLoop * 4) + 1] = (unsigned char)(bLightSquare ? 255 : (texelY * 6));
+		textureImage[(texelLoop * 4) + 2] = (unsigned char)(bLightSquare ? 192 : 64);
+		textureImage[(texelLoop * 4) + 3] = 255;
+	}
+
+	gridMesh.SetMeshMaterial(CFloatColor(0.8, 0.7, 0.6), 0.5);
+
+	bool							bRenderedSuccessfully = gridMesh.SetTextureImage(
+		mkTestTextureWidth, mkTestTextureHeight, &textureImage[0], 1);
+
+	// Render the mesh with a single directional light.
+	const GLfloat					lightDirection[] = { 0.3f, 0.4f, 1.0f, 0.0f };
+
+	::glViewport(0, 0, mkTestImageWidth, mkTestImageHeight);
+	::glMatrixMode(GL_PROJECTION);
+	::glLoadIdentity();
+	::glOrtho(-1.0, 1.0, -1.0, 1.0, -2.0, 2.0);
+	::glMatrixMode(GL_MODELVIEW);
+	::glLoadIdentity();
+	::glRotated(-30.0, 1.0, 0.0, 0.0);
+
+	::glLightfv(GL_LIGHT0, GL_POSITION, lightDirection);
+	::glEnable(GL_LIGHTING);
+	::glEnable(GL_LIGHT0);
+	::glEnable(GL_TEXTURE_2D);
+	::glEnable(GL_DEPTH_TEST);
+
+	::glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+	::glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+	bRenderedSuccessfully = gridMesh.RenderMesh() && bRenderedSuccessfully;
+
+	renderedImage.assign(mkTestImageWidth * mkTestImageHeight * 4, 0);
+
+	::glPixelStorei(GL_PACK_ALIGNMENT, 1);
+	::glReadPixels(0, 0, mkTestImageWidth, mkTestImageHeight, GL_RGBA, GL_UNSIGNED_BYTE,
+		&renderedImage[0]);
+	::glFinish();
+
+	bRenderedSuccessfully = NClothScrollerTests::CheckCondition(::glGetError() ==
+		GL_NO_ERROR, "Mesh rendered without OpenGL errors") && bRenderedSuccessfully;
+	bRenderedSuccessfully = NClothScrollerTests::CheckCondition(
+		gridMesh.UsesBufferObjects() == bExpectBufferObjects,
+		bExpectBufferObjects ? "Mesh uses buffer objects" : "Mesh uses client-side arrays") &&
+		bRenderedSuccessfully;
+
+	return(bRenderedSuccessfully);
+}
+
+
+// Determines the fraction of the rendered image that is not the background color.
+static double DetermineCoveredFraction(const std::vector<unsigned char>& renderedImage)
+{
+	const QuantityType				pixelCount = renderedImage.size() / 4;
+	QuantityType					coveredPixelCount = 0;
+
+	for (IndexType pixelLoop = 0; pixelLoop < pixelCount; pixelLoop++) {
+		if (renderedImage[(pixelLoop * 4)] || renderedImage[(pixelLoop * 4) + 1] ||
+			renderedImage[(pixelLoop * 4) + 2])
+		{
+			coveredPixelCount++;
+		}
+	}
+
+	return((double)coveredPixelCount / (double)pixelCount);
+}
+
+
+// Determines the largest difference between corresponding color components of two rendered
+// images.
+static int DetermineMaxComponentDifference(const std::vector<unsigned char>& firstImage,
+										   const std::vector<unsigned char>& secondImage)
+{
+	int								maxComponentDifference = 0;
+
+	for (IndexType componentLoop = 0; componentLoop < firstImage.size(); componentLoop++) {
+		const int					componentDifference = ::abs((int)firstImage[componentLoop] -
+			(int)secondImage[componentLoop]);
+
+		maxComponentDifference = std::max(maxComponentDifference, componentDifference);
+	}
+
+	return(maxComponentDifference);
+}
+
+
+bool NClothScrollerTests::RunGridMeshRenderTests()
+{
+	CTestRenderingContext			renderingContext(mkTestImageWidth, mkTestImageHeight);
+
+	bool							bTestsPassed = true;
+
+	if (!renderingContext.IsValid()) {
+		::printf("  Grid mesh rendering: no rendering context (skipped).\n");
+	}
+	else {
+		::printf("  Renderer: %s (OpenGL %s).\n", (const char*)::glGetString(GL_RENDERER),
+			(const char*)::glGetString(GL_VERSION));
+
+		std::vector<unsigned char>	bufferObjectImage;
+		std::vector<unsigned char>	clientArrayImage;
+
+		// Render the mesh using buffer objects (where available)...
+		NOpenGLExtensions::SetBufferObjectsEnabled(true);
+
+		const bool					bBufferObjectsAvailable =
+			NOpenGLExtensions::LoadBufferObjectFunctions();
+
+		if (!bBufferObjectsAvailable) {
+			::printf("  Buffer objects are not supported (client-side arrays only).\n");
+		}
+
+		bTestsPassed = RenderTestMesh(bBufferObjectsAvailable, bufferObjectImage) &&
+			bTestsPassed;
+
+		// ...And using client-side arrays.
+		NOpenGLExtensions::SetBufferObjectsEnabled(false);
+
+		bTestsPassed = RenderTestMesh(false, clientArrayImage) && bTestsPassed;
+
+		NOpenGLExtensions::SetBufferObjectsEnabled(true);
+
+		const double				coveredFraction = DetermineCoveredFraction(clientArrayImage);
+		const int					maxComponentDifference =
+			DetermineMaxComponentDifference(bufferObjectImage, clientArrayImage);
+
+		::printf("  Covered fraction: %.3f, maximum component difference: %d.\n",
+			coveredFraction, maxComponentDifference);
+
+		bTestsPassed = NClothScrollerTests::CheckCondition(coveredFraction >=
+			mkMinimumCoveredFraction, "Mesh covers the rendered image") && bTestsPassed;
+		bTestsPassed = NClothScrollerTests::CheckCondition(maxComponentDifference <=
+			mkMaxComponentDifference, "Buffer object and client-side array images agree") &&
+			bTestsPassed;
+
+		::printf("  Grid mesh rendering: %s\n", bTestsPassed ? "passed." : "FAILED.");
+	}
+
+	return(bTestsPassed);
+}
@@ -0,0 +1,183 @@
+// MeshAllocationTests.cpp - Contains tests that count the memory allocations performed while
+//                           cloth meshes are generated, traversed and compiled into display
+//                           lists (polygon and vertex lists must not be copied).
+
+#include "ClothScrollerTests.h"
+#include "ClothNodeNetwork.h"
+#include "ModelGeometryOpenGL.h"
+#include "TestRenderingContext.h"
+#include <stdlib.h>
+#include <new>
+
+
+// Dimensions of the test cloth (nodes).
+static const QuantityType			mkTestNodesPerRow = 12;
+static const QuantityType			mkTestNodesPerColumn = 9;
+
+// Number of times that the mesh polygons and vertices are traversed.
+static const QuantityType			mkTraversalCount = 10;
+
+
+// Returns the number of allocations performed by the global operator new (the counting
+// operators below replace those of the standard library for the entire test program).
+static unsigned long& GetAllocationCount()
+{
+	static unsigned long			allocationCount = 0;
+
+	return(allocationCount);
+}
+
+
+void* operator new(size_t allocationSize) throw(std::bad_alloc)
+{
+	void*							pAllocation = ::malloc((allocationSize > 0) ?
+		allocationSize : 1);
+
+	if (!pAllocation) {
+		throw std::bad_alloc();
+	}
+
+	GetAllocationCount()++;
+
+	return(pAllocation);
+}
+
+
+void operator delete(void* pAllocation) throw()
+{
+	::free(pAllocation);
+}
+
+
+// Builds the polygons of a cloth mesh in the manner of CClothNetworkBase::
+// GenerateNodeNetworkMesh (two triangles per grid cell), returning the number of
+// allocations required - mesh generation must not require additional allocations.
+static unsigned long CountMeshPolygonAllocations(const QuantityType nodesPerRow,
+												 const QuantityType nodesPerColumn)
+{
+	const unsigned long				initialAllocationCount = GetAllocationCount();
+
+	PolygonList						meshPolygons;
+
+	for (IndexType xLoop = 0; xLoop < (nodesPerRow - 1); xLoop++) {
+		for (IndexType yLoop = 0; yLoop < (nodesPerColumn - 1); yLoop++) {
+			CFloatPolygon			firstHalfPolygon;
+			CFloatPolygon			secondHalfPolygon;
+
+			for (IndexType vertexLoop = 0; vertexLoop < 3; vertexLoop++) {
+				firstHalfPolygon.AddVertex(CPolygonVertex());
+				secondHalfPolygon.AddVertex(CPolygonVertex());
+			}
+
+			meshPolygons.push_back(firstHalfPolygon);
+			meshPolygons.push_back(secondHalfPolygon);
+		}
+	}
+
+	return(GetAllocationCount() - initialAllocationCount);
+}
+
+
+// Traverses every vertex of every mesh polygon (using the list accessors and the read-only
+// views), returning the number of allocations performed.
+static unsigned long CountMeshTraversalAllocations(const CStaticMeshBase& staticMesh,
+												   QuantityType& vertexCount)
+{
+	const unsigned long				initialAllocationCount = GetAllocationCount();
+
+	vertexCount = 0;
+
+	for (IndexType traversalLoop = 0; traversalLoop < mkTraversalCount; traversalLoop++) {
+		for (IndexType polygonLoop = 0; polygonLoop < staticMesh.GetPolygonList().size();
+			polygonLoop++)
+		{
+			vertexCount += staticMesh.GetPolygonList()[polygonLoop].GetVertexList().size();
+		}
+
+		const CStaticMeshBase::PolygonView
+									polygonView = staticMesh.GetPolygonView();
+
+		for (IndexType viewLoop = 0; viewLoop < polygonView.size(); viewLoop++) {
+			vertexCount += polygonView[viewLoop].GetVertexView().size();
+		}
+	}
+
+	return(GetAllocationCount() - initialAllocationCount);
+}
+
+
+bool NClothScrollerTests::RunMeshAllocationTests()
+{
+	bool							bTestsPassed = true;
+
+	CClothNodeNetwork				nodeNetwork(mkTestNodesPerRow, mkTestNodesPerColumn, 10.0,
+		5.0, CFloatPoint(-4.5, -1.0, 0.0), 0.02, 10.0, 3.5, 1.0);
+	CStaticMeshBase					clothMesh;
+
+	// (A time quantum is required for the cloth network to be valid.)
+	nodeNetwork.SetForceTimeQuantum(0.01);
+
+	// Generate the cloth mesh (the generated polygons are adopted by the mesh)...
+	const unsigned long				expectedAllocationCount =
+		CountMeshPolygonAllocations(mkTestNodesPerRow, mkTestNodesPerColumn);
+	const unsigned long				initialAllocationCount = GetAllocationCount();
+
+	bTestsPassed = NClothScrollerTests::CheckCondition(
+		nodeNetwork.GenerateNodeNetworkMesh(clothMesh), "Cloth mesh generated") &&
+		bTestsPassed;
+
+	const unsigned long				generationAllocationCount = GetAllocationCount() -
+		initialAllocationCount;
+	const QuantityType				polygonCount = clothMesh.GetPolygonList().size();
+
+	::printf("  Mesh generation: %lu allocations (%lu to build %lu polygons).\n",
+		generationAllocationCount, expectedAllocationCount, polygonCount);
+
+	bTestsPassed = NClothScrollerTests::CheckCondition(polygonCount ==
+		((mkTestNodesPerRow - 1) * (mkTestNodesPerColumn - 1) * 2),
+		"Two polygons per cloth grid cell") && bTestsPassed;
+	bTestsPassed = NClothScrollerTests::CheckCondition(generationAllocationCount <=
+		expectedAllocationCount, "Mesh generation does not copy the polygon list") &&
+		bTestsPassed;
+
+	// ...Traverse the mesh polygons and vertices...
+	QuantityType					vertexCount = 0;
+	const unsigned long				traversalAllocationCount =
+		CountMeshTraversalAllocations(clothMesh, vertexCount);
+
+	::printf("  Mesh traversal: %lu allocations (%lu vertices).\n", traversalAllocationCount,
+		vertexCount);
+
+	bTestsPassed = NClothScrollerTests::CheckCondition(vertexCount ==
+		(polygonCount * 3 * 2 * mkTraversalCount), "All mesh vertices traversed") &&
+		bTestsPassed;
+	bTestsPassed = NClothScrollerTests::CheckCondition(traversalAllocationCount == 0,
+		"Mesh traversal does not copy the polygon or vertex lists") && bTestsPassed;
+
+	// ...And compile the mesh into a display list (requires a rendering context) - copying
+	// the polygon list would require at least one allocation for each polygon.
+	CTestRenderingContext			renderingContext(1, 1);
+
+	if (!renderingContext.IsValid()) {
+		::printf("  Display list generation: no rendering context (skipped).\n");
+	}
+	else {
+		const unsigned long			displayListInitialAllocationCount = GetAllocationCount();
+
+		const COpenGLStaticMesh		openGLMesh(clothMesh);
+
+		const unsigned long			displayListAllocationCount = GetAllocationCount() -
+			displayListInitialAllocationCount;
+
+		::printf("  Display list generation: %lu allocations.\n",
+			displayListAllocationCount);
+
+		bTestsPassed = NClothScrollerTests::CheckCondition(displayListAllocationCount <
+			polygonCount, "Display list generation does not copy the polygon list") &&
+			bTestsPassed;
+	}
+
+	::printf("  Mesh allocation: %s\n", bTestsPassed ? "passed." : "FAILED.");
+
+	return(bTestsPassed);
+}
@@ -0,0 +1,166 @@
+// SpringForceBenchmark.cpp - Contains a benchmark that measures the number of processor cycles
+//                            used by each spring force kernel to evaluate the springs of a
+//                            cloth lattice (run on request - timing results are not
+//                            deterministic).
+
+#include "ClothScrollerTests.h"
+#include "SpringForceKernels.h"
+
+
+// Number of nodes along each edge of the benchmark cloth lattice (the node locations and
+// springs of the lattice occupy the level 2 cache of most processors).
+static const QuantityType			mkBenchmarkNodesPerRow = 64;
+
+// Number of successive evaluations of the lattice springs that are timed.
+static const QuantityType			mkBenchmarkEvaluationCount = 200;
+
+// Maximum displacement of each lattice node from its resting location, relative to the
+// node spacing (springs remain near their resting lengths, as they do within a cloth).
+static const double					mkBenchmarkNodeDisplacement = 0.02;
+
+
+// Spring/node data of a square cloth lattice (structural, shear and flexion springs), along
+// with a kernel block that refers to the data.
+template <class scalarType> class CSpringForceBenchmarkData
+{
+public:
+	CSpringForceBenchmarkData(const QuantityType nodesPerRow);
+
+	CSpringForceKernelBlock<scalarType>
+									mKernelBlock;
+
+private:
+	// The kernel block refers to the arrays of this object.
+	CSpringForceBenchmarkData(const CSpringForceBenchmarkData& sourceBenchmarkData);
+	CSpringForceBenchmarkData& operator=(const CSpringForceBenchmarkData&
+		sourceBenchmarkData);
+
+	// Adds a spring between two lattice nodes (if both nodes lie within the lattice).
+	void							AddLatticeSpring(const QuantityType nodesPerRow,
+		const IndexType xIndex, const IndexType yIndex, const IndexType xOffset,
+		const IndexType yOffset, const scalarType springConstant);
+
+	std::vector<scalarType>			mNodeLocationX;
+	std::vector<scalarType>			mNodeLocationY;
+	std::vector<scalarType>			mNodeLocationZ;
+
+	std::vector<IndexType>			mSpringHeadIndex;
+	std::vector<IndexType>			mSpringTailIndex;
+
+	std::vector<scalarType>			mSpringConstant;
+	std::vector<scalarType>			mSpringRestingLength;
+
+	std::vector<scalarType>			mSpringForceX;
+	std::vector<scalarType>			mSpringForceY;
+	std::vector<scalarType>			mSpringForceZ;
+};
+
+
+template <class scalarType> CSpringForceBenchmarkData<scalarType>::CSpringForceBenchmarkData(
+	const QuantityType nodesPerRow) : mNodeLocationX(nodesPerRow * nodesPerRow),
+	mNodeLocationY(nodesPerRow * nodesPerRow), mNodeLocationZ(nodesPerRow * nodesPerRow)
+{
+	// Nodes are displaced from a unit lattice by a fixed pattern.
+	for (IndexType yLoop = 0; yLoop < nodesPerRow; yLoop++) {
+		for (IndexType xLoop = 0; xLoop < nodesPerRow; xLoop++) {
+			const IndexType			nodeIndex = (yLoop * nodesPerRow) + xLoop;
+
+			this->mNodeLocationX[nodeIndex] = (scalarType)(xLoop +
+				(mkBenchmarkNodeDisplacement * ::sin((double)nodeIndex)));
+			this->mNodeLocationY[nodeIndex] = (scalarType)(yLoop +
+				(mkBenchmarkNodeDisplacement * ::cos((double)nodeIndex)));
+			this->mNodeLocationZ[nodeIndex] = (scalarType)(mkBenchmarkNodeDisplacement *
+				::sin((double)(xLoop + yLoop)));
+		}
+	}
+
+	// Springs are ordered as they are by the generic node network.
+	for (IndexType yLoop = 0; yLoop < nodesPerRow; yLoop++) {
+		for (IndexType xLoop = 0; xLoop < nodesPerRow; xLoop++) {
+			this->AddLatticeSpring(nodesPerRow, xLoop, yLoop, 1, 0, 100);
+			this->AddLatticeSpring(nodesPerRow, xLoop, yLoop, 0, 1, 100);
+			this->AddLatticeSpring(nodesPerRow, xLoop, yLoop, 1, 1, 10);
+			this->AddLatticeSpring(nodesPerRow, xLoop, yLoop, 2, 0, 100);
+			this->AddLatticeSpring(nodesPerRow, xLoop, yLoop, 0, 2, 100);
+		}
+	}
+
+	this->mSpringForceX.assign(this->mSpringHeadIndex.size(), 0);
+	this->mSpringForceY.assign(this->mSpringHeadIndex.size(), 0);
+	this->mSpringForceZ.assign(this->mSpringHeadIndex.size(), 0);
+
+	this->mKernelBlock.mpNodeLocationX = &this->mNodeLocationX[0];
+	this->mKernelBlock.mpNodeLocationY = &this->mNodeLocationY[0];
+	this->mKernelBlock.mpNodeLocationZ = &this->mNodeLocationZ[0];
+	this->mKernelBlock.mpSpringHeadIndex = &this->mSpringHeadIndex[0];
+	this->mKernelBlock.mpSpringTailIndex = &this->mSpringTailIndex[0];
+	this->mKernelBlock.mpSpringConstant = &this->mSpringConstant[0];
+	this->mKernelBlock.mpSpringRestingLength = &this->mSpringRestingLength[0];
+	this->mKernelBlock.mpSpringForceX = &this->mSpringForceX[0];
+	this->mKernelBlock.mpSpringForceY = &this->mSpringForceY[0];
+	this->mKernelBlock.mpSpringForceZ = &this->mSpringForceZ[0];
+	this->mKernelBlock.mSpringCount = this->mSpringHeadIndex.size();
+}
+
+
+template <class scalarType> void CSpringForceBenchmarkData<scalarType>::AddLatticeSpring(
+	const QuantityType nodesPerRow, const IndexType xIndex, const IndexType yIndex,
+	const IndexType xOffset, const IndexType yOffset, const scalarType springConstant)
+{
+	if (((xIndex + xOffset) < nodesPerRow) && ((yIndex + yOffset) < nodesPerRow)) {
+		this->mSpringHeadIndex.push_back((yIndex * nodesPerRow) + xIndex);
+		this->mSpringTailIndex.push_back(((yIndex + yOffset) * nodesPerRow) + xIndex +
+			xOffset);
+		this->mSpringConstant.push_back(springConstant);
+
+		// Resting lengths are determined from the undisplaced lattice.
+		this->mSpringRestingLength.push_back((scalarType)::sqrt((double)((xOffset *
+			xOffset) + (yOffset * yOffset))));
+	}
+}
+
+
+// Measures each kernel with the specified lattice, using exact and approximate spring
+// lengths.
+template <class scalarType> static void MeasureSpringForceKernels(
+	CSpringForceBenchmarkData<scalarType>& benchmarkData, const char* pPrecisionName)
+{
+	const ESpringForceKernel		kernels[] = { eSpringKernelScalar, eSpringKernelSSE2,
+		eSpringKernelAVX2 };
+	const char*						kernelNames[] = { "Scalar", "SSE2", "AVX2" };
+
+	for (IndexType kernelLoop = 0; kernelLoop < (sizeof(kernels) / sizeof(kernels[0]));
+		kernelLoop++)
+	{
+		if (NSpringForceKernels::IsKernelSupported(kernels[kernelLoop])) {
+			benchmarkData.mKernelBlock.mbApproximateReciprocalSqrt = false;
+			const double			exactCycles = NSpringForceKernels::MeasureSpringForceCycles(
+				kernels[kernelLoop], benchmarkData.mKernelBlock, mkBenchmarkEvaluationCount);
+
+			benchmarkData.mKernelBlock.mbApproximateReciprocalSqrt = true;
+			const double			approximateCycles =
+				NSpringForceKernels::MeasureSpringForceCycles(kernels[kernelLoop],
+				benchmarkData.mKernelBlock, mkBenchmarkEvaluationCount);
+
+			::printf("  %s kernel (%s): %.2f cycles/spring, %.2f cycles/spring with "
+				"approximate lengths.\n", kernelNames[kernelLoop], pPrecisionName,
+				exactCycles, approximateCycles);
+		}
+	}
+}
+
+
+void NClothScrollerTests::RunSpringForceBenchmark()
+{
+	CSpringForceBenchmarkData<double>
+									doubleBenchmarkData(mkBenchmarkNodesPerRow);
+	CSpringForceBenchmarkData<float>
+									floatBenchmarkData(mkBenchmarkNodesPerRow);
+
+	::printf("  %lu springs, %lu evaluations (cycles are zero where the time stamp "
+		"counter is not available).\n", doubleBenchmarkData.mKernelBlock.mSpringCount,
+		mkBenchmarkEvaluationCount);
+
+	MeasureSpringForceKernels(doubleBenchmarkData, "double");
+	MeasureSpringForceKernels(floatBenchmarkData, "float");
+}
@@ -0,0 +1,269 @@
+// SpringForceKernelTests.cpp - Contains tests that compare the results of each spring force
+//                              kernel to the results of the scalar kernel, using fixed
+//                              (deterministic) spring configurations.
+
+#include "ClothScrollerTests.h"
+#include "SpringForceKernels.h"
+
+
+// Spring counts that are evaluated - chosen so that each SIMD kernel evaluates blocks that
+// are smaller than, equal to, and not a multiple of, its width.
+static const QuantityType			mkTestSpringCounts[] = { 1, 2, 3, 4, 7, 8, 9, 31, 257 };
+
+// Every n-th spring connects a node to itself (zero-length springs must not produce a force),
+// and every n-th spring is at its resting length.
+static const QuantityType			mkZeroLengthSpringInterval = 13;
+static const QuantityType			mkRestingSpringInterval = 5;
+
+// Permitted force differences, relative to the scalar kernel force magnitude (single
+// precision approximate reciprocal square roots receive one Newton-Raphson iteration, so
+// that the difference approaches 1e-6 of the spring constant for springs near rest).
+static const double					mkExactDoubleTolerance = 1.0e-12;
+static const float					mkExactFloatTolerance = 1.0e-5f;
+static const double					mkApproximateDoubleTolerance = 1.0e-10;
+static const float					mkApproximateFloatTolerance = 2.0e-3f;
+
+
+// Generates a fixed sequence of pseudo-random values in the range [0, 1) (the sequence is
+// identical on all platforms).
+class CTestValueSequence
+{
+public:
+	CTestValueSequence() : mSeed(0x2F6B3A1DUL)
+	{
+
+	}
+
+	double							GetNextValue()
+	{
+		this->mSeed = ((this->mSeed * 1664525UL) + 1013904223UL) & 0xFFFFFFFFUL;
+
+		return((double)(this->mSeed >> 8) / (double)0x01000000UL);
+	}
+
+private:
+	unsigned long					mSeed;
+};
+
+
+// Spring/node data evaluated by a kernel test, along with a kernel block that refers to the
+// data.
+template <class scalarType> class CSpringForceTestData
+{
+public:
+	CSpringForceTestData(const QuantityType springCount);
+
+	CSpringForceKernelBlock<scalarType>
+									mKernelBlock;
+
+private:
+	// The kernel block refers to the arrays of this object.
+	CSpringForceTestData(const CSpringForceTestData& sourceTestData);
+	CSpringForceTestData& operator=(const CSpringForceTestData& sourceTestData);
+
+	std::vector<scalarType>			mNodeLocationX;
+	std::vector<scalarType>			mNodeLocationY;
+	std::vector<scalarType>			mNodeLocationZ;
+
+	std::vector<IndexType>			mSpringHeadIndex;
+	std::vector<IndexType>			mSpringTailIndex;
+
+	std::vector<scalarType>			mSpringConstant;
+	std::vector<scalarType>			mSpringRestingLength;
+
+	std::vector<scalarType>			mSpringForceX;
+	std::vector<scalarType>			mSpringForceY;
+	std::vector<scalarType>			mSpringForceZ;
+};
+
+
+template <class scalarType> CSpringForceTestData<scalarType>::CSpringForceTestData(
+	const QuantityType springCount) : mNodeLocationX(springCount + 1),
+	mNodeLocationY(springCount + 1), mNodeLocationZ(springCount + 1),
+	mSpringHeadIndex(springCount), mSpringTailIndex(springCount),
+	mSpringConstant(springCount), mSpringRestingLength(springCount),
+	mSpringForceX(springCount), mSpringForceY(springCount), mSpringForceZ(springCount)
+{
+	CTestValueSequence				valueSequence;
+	const QuantityType				nodeCount = springCount + 1;
+
+	// Nodes are placed on a perturbed lattice...
+	for (IndexType nodeLoop = 0; nodeLoop < nodeCount; nodeLoop++) {
+		this->mNodeLocationX[nodeLoop] = (scalarType)((nodeLoop % 4) +
+			valueSequence.GetNextValue() - 0.5);
+		this->mNodeLocationY[nodeLoop] = (scalarType)(((nodeLoop / 4) % 4) +
+			valueSequence.GetNextValue() - 0.5);
+		this->mNodeLocationZ[nodeLoop] = (scalarType)((nodeLoop / 16) +
+			valueSequence.GetNextValue() - 0.5);
+	}
+
+	// ...and springs connect neighbouring and distant nodes, with resting lengths that
+	// are both shorter and longer than the spring length.
+	for (IndexType springLoop = 0; springLoop < springCount; springLoop++) {
+		const IndexType				headIndex = springLoop;
+		const IndexType				tailIndex = ((springLoop % mkZeroLengthSpringInterval) ==
+			(mkZeroLengthSpringInterval - 1)) ? headIndex : ((springLoop * 7) + 3) % nodeCount;
+
+		const scalarType			deltaX = this->mNodeLocationX[headIndex] -
+			this->mNodeLocationX[tailIndex];
+		const scalarType			deltaY = this->mNodeLocationY[headIndex] -
+			this->mNodeLocationY[tailIndex];
+		const scalarType			deltaZ = this->mNodeLocationZ[headIndex] -
+			this->mNodeLocationZ[tailIndex];
+
+		const scalarType			springLength = (scalarType)::sqrt((deltaX * deltaX) +
+			(deltaY * deltaY) + (deltaZ * deltaZ));
+
+		this->mSpringHeadIndex[springLoop] = headIndex;
+		this->mSpringTailIndex[springLoop] = tailIndex;
+
+		this->mSpringConstant[springLoop] = (scalarType)(10.0 +
+			(990.0 * valueSequence.GetNextValue()));
+		this->mSpringRestingLength[springLoop] = ((springLoop % mkRestingSpringInterval) == 0) ?
+			springLength : (scalarType)(springLength * (0.5 + valueSequence.GetNextValue()));
+	}
+
+	this->mKernelBlock.mpNodeLocationX = &this->mNodeLocationX[0];
+	this->mKernelBlock.mpNodeLocationY = &this->mNodeLocationY[0];
+	this->mKernelBlock.mpNodeLocationZ = &this->mNodeLocationZ[0];
+	this->mKernelBlock.mpSpringHeadIndex = &this->mSpringHeadIndex[0];
+	this->mKernelBlock.mpSpringTailIndex = &this->mSpringTailIndex[0];
+	this->mKernelBlock.mpSpringConstant = &this->mSpringConstant[0];
+	this->mKernelBlock.mpSpringRestingLength = &this->mSpringRestingLength[0];
+	this->mKernelBlock.mpSpringForceX = &this->mSpringForceX[0];
+	this->mKernelBlock.mpSpringForceY = &this->mSpringForceY[0];
+	this->mKernelBlock.mpSpringForceZ = &this->mSpringForceZ[0];
+	this->mKernelBlock.mSpringCount = springCount;
+}
+
+
+// Evaluates a single spring (3-4-5 triangle, stretched by one unit) with the specified kernel,
+// and compares the result to the known force.
+template <class scalarType> static bool TestKnownSpringForce(const ESpringForceKernel kernel,
+															 const scalarType tolerance)
+{
+	const scalarType				nodeLocationX[] = { 3, 0 };
+	const scalarType				nodeLocationY[] = { 4, 0 };
+	const scalarType				nodeLocationZ[] = { 0, 0 };
+	const IndexType					springHeadIndex[] = { 0 };
+	const IndexType					springTailIndex[] = { 1 };
+	const scalarType				springConstant[] = { 2 };
+	const scalarType				springRestingLength[] = { 4 };
+
+	scalarType						springForceX = 0;
+	scalarType						springForceY = 0;
+	scalarType						springForceZ = 0;
+
+	CSpringForceKernelBlock<scalarType>
+									kernelBlock;
+
+	kernelBlock.mpNodeLocationX = nodeLocationX;
+	kernelBlock.mpNodeLocationY = nodeLocationY;
+	kernelBlock.mpNodeLocationZ = nodeLocationZ;
+	kernelBlock.mpSpringHeadIndex = springHeadIndex;
+	kernelBlock.mpSpringTailIndex = springTailIndex;
+	kernelBlock.mpSpringConstant = springConstant;
+	kernelBlock.mpSpringRestingLength = springRestingLength;
+	kernelBlock.mpSpringForceX = &springForceX;
+	kernelBlock.mpSpringForceY = &springForceY;
+	kernelBlock.mpSpringForceZ = &springForceZ;
+	kernelBlock.mSpringCount = 1;
+
+	// Force = -2 x (5 - 4) x (3, 4, 0) / 5.
+	return(NSpringForceKernels::EvaluateSpringForces(kernel, kernelBlock) &&
+		(::fabs(springForceX - (scalarType)-1.2) <= tolerance) &&
+		(::fabs(springForceY - (scalarType)-1.6) <= tolerance) &&
+		(springForceZ == 0));
+}
+
+
+// Evaluates each test spring configuration with the specified kernel, and compares the
+// results to those of the scalar kernel.
+template <class scalarType> static bool TestSpringForceKernel(const ESpringForceKernel kernel,
+															  const bool bApproximateReciprocalSqrt,
+															  const scalarType tolerance)
+{
+	bool							bKernelTestsPassed = true;
+
+	for (IndexType countLoop = 0; countLoop < (sizeof(mkTestSpringCounts) /
+		sizeof(mkTestSpringCounts[0])); countLoop++)
+	{
+		CSpringForceTestData<scalarType>
+									testData(mkTestSpringCounts[countLoop]);
+
+		testData.mKernelBlock.mbApproximateReciprocalSqrt = bApproximateReciprocalSqrt;
+
+		if (!NSpringForceKernels::VerifySpringForces(kernel, testData.mKernelBlock,
+			tolerance))
+		{
+			::printf("    Kernel results differ from the scalar kernel (%lu springs).\n",
+				mkTestSpringCounts[countLoop]);
+			bKernelTestsPassed = false;
+		}
+		else {
+			// Zero-length springs must produce no force (rather than a non-finite force).
+			for (IndexType springLoop = mkZeroLengthSpringInterval - 1; springLoop <
+				testData.mKernelBlock.mSpringCount; springLoop += mkZeroLengthSpringInterval)
+			{
+				bKernelTestsPassed = NClothScrollerTests::CheckCondition(
+					(testData.mKernelBlock.mpSpringForceX[springLoop] == 0) &&
+					(testData.mKernelBlock.mpSpringForceY[springLoop] == 0) &&
+					(testData.mKernelBlock.mpSpringForceZ[springLoop] == 0),
+					"Zero-length spring produces no force") && bKernelTestsPassed;
+			}
+		}
+	}
+
+	return(bKernelTestsPassed);
+}
+
+
+bool NClothScrollerTests::RunSpringForceKernelTests()
+{
+	const ESpringForceKernel		kernels[] = { eSpringKernelScalar, eSpringKernelSSE2,
+		eSpringKernelAVX2 };
+	const char*						kernelNames[] = { "Scalar", "SSE2", "AVX2" };
+
+	bool							bTestsPassed = true;
+
+	for (IndexType kernelLoop = 0; kernelLoop < (sizeof(kernels) / sizeof(kernels[0]));
+		kernelLoop++)
+	{
+		const ESpringForceKernel	kernel = kernels[kernelLoop];
+
+		if (!NSpringForceKernels::IsKernelSupported(kernel)) {
+			::printf("  %s kernel: not supported (skipped).\n", kernelNames[kernelLoop]);
+		}
+		else {
+			bool					bKernelTestsPassed = true;
+
+			bKernelTestsPassed = NClothScrollerTests::CheckCondition(
+				TestKnownSpringForce<double>(kernel, mkExactDoubleTolerance),
+				"Known spring force (double)") && bKernelTestsPassed;
+			bKernelTestsPassed = NClothScrollerTests::CheckCondition(
+				TestKnownSpringForce<float>(kernel, mkExactFloatTolerance),
+				"Known spring force (float)") && bKernelTestsPassed;
+
+			// Exact, and approximate (reciprocal square root), spring lengths.
+			bKernelTestsPassed = NClothScrollerTests::CheckCondition(
+				TestSpringForceKernel<double>(kernel, false, mkExactDoubleTolerance),
+				"Spring forces (double)") && bKernelTestsPassed;
+			bKernelTestsPassed = NClothScrollerTests::CheckCondition(
+				TestSpringForceKernel<float>(kernel, false, mkExactFloatTolerance),
+				"Spring forces (float)") && bKernelTestsPassed;
+			bKernelTestsPassed = NClothScrollerTests::CheckCondition(
+				TestSpringForceKernel<double>(kernel, true, mkApproximateDoubleTolerance),
+				"Spring forces, approximate lengths (double)") && bKernelTestsPassed;
+			bKernelTestsPassed = NClothScrollerTests::CheckCondition(
+				TestSpringForceKernel<float>(kernel, true, mkApproximateFloatTolerance),
+				"Spring forces, approximate lengths (float)") && bKernelTestsPassed;
+
+			::printf("  %s kernel: %s\n", kernelNames[kernelLoop], bKernelTestsPassed ?
+				"passed." : "FAILED.");
+
+			bTestsPassed = bKernelTestsPassed && bTestsPassed;
+		}
+	}
+
+	return(bTestsPassed);
+}
@@ -0,0 +1,80 @@
+// TestRenderingContext.cpp - Contains implementations for the off-screen OpenGL rendering
+//                            context used by tests that render (or compile) geometry.
+
+#include "TestRenderingContext.h"
+
+
+CTestRenderingContext::CTestRenderingContext(const GLsizei surfaceWidth,
+											 const GLsizei surfaceHeight) :
+	mbContextCurrent(false)
+{
+#if defined(_WIN32)
+	int								argumentCount = 1;
+	char*							argumentList[] = { (char*)"ClothScrollerTests", NULL };
+
+	::glutInit(&argumentCount, argumentList);
+	::glutInitDisplayMode(GLUT_RGBA | GLUT_DOUBLE | GLUT_DEPTH);
+	::glutInitWindowSize(surfaceWidth, surfaceHeight);
+	::glutInitWindowPosition(0, 0);
+
+	this->mGLUTWindow = ::glutCreateWindow("ClothScrollerTests");
+	this->mbContextCurrent = (this->mGLUTWindow != 0);
+#else	// #if defined(_WIN32)
+	const EGLint					configAttributes[] = { EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+		EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8,
+		EGL_BLUE_SIZE, 8, EGL_DEPTH_SIZE, 16, EGL_NONE };
+	const EGLint					surfaceAttributes[] = { EGL_WIDTH, surfaceWidth,
+		EGL_HEIGHT, surfaceHeight, EGL_NONE };
+
+	EGLConfig						surfaceConfig = NULL;
+	EGLint							configCount = 0;
+
+	this->mSurface = EGL_NO_SURFACE;
+	this->mContext = EGL_NO_CONTEXT;
+	this->mDisplay = ::eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+	if ((this->mDisplay != EGL_NO_DISPLAY) && ::eglInitialize(this->mDisplay, NULL, NULL) &&
+		::eglChooseConfig(this->mDisplay, configAttributes, &surfaceConfig, 1,
+		&configCount) && (configCount > 0) && ::eglBindAPI(EGL_OPENGL_API))
+	{
+		this->mSurface = ::eglCreatePbufferSurface(this->mDisplay, surfaceConfig,
+			surfaceAttributes);
+		this->mContext = ::eglCreateContext(this->mDisplay, surfaceConfig, EGL_NO_CONTEXT,
+			NULL);
+
+		this->mbContextCurrent = (this->mSurface != EGL_NO_SURFACE) &&
+			(this->mContext != EGL_NO_CONTEXT) && ::eglMakeCurrent(this->mDisplay,
+			this->mSurface, this->mSurface, this->mContext);
+	}
+#endif	// #if defined(_WIN32)...#else
+}
+
+
+CTestRenderingContext::~CTestRenderingContext()
+{
+#if defined(_WIN32)
+	if (this->mGLUTWindow != 0) {
+		::glutDestroyWindow(this->mGLUTWindow);
+	}
+#else	// #if defined(_WIN32)
+	if (this->mDisplay != EGL_NO_DISPLAY) {
+		::eglMakeCurrent(this->mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+		if (this->mContext != EGL_NO_CONTEXT) {
+			::eglDestroyContext(this->mDisplay, this->mContext);
+		}
+
+		if (this->mSurface != EGL_NO_SURFACE) {
+			::eglDestroySurface(this->mDisplay, this->mSurface);
+		}
+
+		::eglTerminate(this->mDisplay);
+	}
+#endif	// #if defined(_WIN32)...#else
+}
+
+
+bool CTestRenderingContext::IsValid() const
+{
+	return(this->mbContextCurrent);
+}
@@ -0,0 +1,40 @@
+// TestRenderingContext.h - Contains declarations for the off-screen OpenGL rendering context
+//                          used by tests that render (or compile) geometry.
+
+#ifndef _TESTRENDERINGCONTEXT_H
+#define _TESTRENDERINGCONTEXT_H		1
+
+
+#include "PrimaryHeaders.h"
+
+#if !defined(_WIN32)
+#include <EGL/egl.h>
+#endif	// #if !defined(_WIN32)
+
+
+// Off-screen rendering context (a GLUT window on Windows, or an EGL pixel buffer surface
+// elsewhere - headless Mesa drivers, such as llvmpipe, provide EGL surfaces without a
+// display). The context is current while the object exists.
+class CTestRenderingContext
+{
+public:
+	CTestRenderingContext(const GLsizei surfaceWidth, const GLsizei surfaceHeight);
+	~CTestRenderingContext();
+
+	// Determines if the rendering context was created, and is current.
+	bool							IsValid() const;
+
+private:
+	bool							mbContextCurrent;
+
+#if defined(_WIN32)
+	int								mGLUTWindow;
+#else	// #if defined(_WIN32)
+	EGLDisplay						mDisplay;
+	EGLSurface						mSurface;
+	EGLContext						mContext;
+#endif	// #if defined(_WIN32)...#else
+};
+
+
+#endif	// #ifndef _TESTRENDERINGCONTEXT_H
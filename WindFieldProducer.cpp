@@ -0,0 +1,230 @@
+// WindFieldProducer.cpp - Contains implementations for the wind field producer, which computes
+//                         frames of wind force vectors on a background thread.
+
+#include "WindFieldProducer.h"
+#include <algorithm>
+
+
+/////
+// CWindFieldProducer class
+/////
+CWindFieldProducer::CWindForceFrame::CWindForceFrame() : mAlterationConstant(0)
+{
+
+}
+
+
+CWindFieldProducer::CWindFieldProducer(const CVector directionVector,
+									   const ScalarType maxMagnitude,
+									   const CWindNoiseField& noiseField) :
+	mWindForce(directionVector, maxMagnitude), mNoiseField(noiseField),
+	mCurrentFrameIndex(0), mbFrameRequestPending(false), mRequestedAlterationConstant(0),
+	mCompletedFrameIndex(-1), mFrameRequestEvent(NULL), mProducerThreadHandle(NULL),
+	mbTerminateThread(false)
+{
+	this->mWindForce.SetNoiseField(&this->mNoiseField);
+
+	// Store the lattice point locations.
+	const QuantityType				latticePointCount = this->mNoiseField.GetLatticePointCount();
+
+	this->mLatticePointX.resize(latticePointCount);
+	this->mLatticePointY.resize(latticePointCount);
+	this->mLatticePointZ.resize(latticePointCount);
+	this->mLatticePointZeroValue.resize(latticePointCount, 0.0);
+	this->mLatticePointForceX.resize(latticePointCount);
+	this->mLatticePointForceY.resize(latticePointCount);
+	this->mLatticePointForceZ.resize(latticePointCount);
+
+	for (IndexType pointLoop = 0; pointLoop < latticePointCount; pointLoop++) {
+		const CFloatPoint			pointLocation =
+			this->mNoiseField.GetLatticePointLocation(pointLoop);
+
+		this->mLatticePointX[pointLoop] = pointLocation.GetXCoord();
+		this->mLatticePointY[pointLoop] = pointLocation.GetYCoord();
+		this->mLatticePointZ[pointLoop] = pointLocation.GetZCoord();
+	}
+
+	// The first frame is computed synchronously (the simulation thread always has a
+	// frame available).
+	this->ProduceFrame(this->mWindForceFrame[0], 0);
+
+	if (latticePointCount > 0) {
+		this->CreateProducerThread();
+	}
+}
+
+CWindFieldProducer::~CWindFieldProducer()
+{
+	this->DestroyProducerThread();
+}
+
+
+bool CWindFieldProducer::IsValid() const
+{
+	return(this->mProducerThreadHandle != NULL);
+}
+
+
+void CWindFieldProducer::AdvanceFrame(const QuantityType alterationConstant)
+{
+	if (this->IsValid()) {
+		// Adopt the completed frame, if one is available (the exchange also ensures
+		// that the frame contents written by the producer thread are visible)...
+		const LONG					completedFrameIndex = ::InterlockedExchange(
+			&this->mCompletedFrameIndex, -1);
+
+		if (completedFrameIndex >= 0) {
+			this->mCurrentFrameIndex = (IndexType)completedFrameIndex;
+			this->mbFrameRequestPending = false;
+		}
+
+		// ...And request the next frame, which is computed within the buffer that is not
+		// being read.
+		if (!this->mbFrameRequestPending) {
+			this->mRequestedAlterationConstant = alterationConstant;
+			this->mbFrameRequestPending = true;
+
+			::SetEvent(this->mFrameRequestEvent);
+		}
+	}
+}
+
+
+QuantityType CWindFieldProducer::GetFrameAlterationConstant() const
+{
+	return(this->mWindForceFrame[this->mCurrentFrameIndex].mAlterationConstant);
+}
+
+
+void CWindFieldProducer::AccumulateWindForces(const QuantityType locationCount,
+											  const ScalarType* pLocationX,
+											  const ScalarType* pLocationY,
+											  const ScalarType* pLocationZ,
+											  ScalarType* pForceX, ScalarType* pForceY,
+											  ScalarType* pForceZ) const
+{
+	const CWindForceFrame&			windForceFrame =
+		this->mWindForceFrame[this->mCurrentFrameIndex];
+
+	if (!windForceFrame.mForceX.empty()) {
+		for (IndexType locationLoop = 0; locationLoop < locationCount; locationLoop++) {
+			IndexType				cornerIndex[8];
+			float					cellFraction[3];
+
+			this->mNoiseField.GetLatticeCell(pLocationX[locationLoop],
+				pLocationY[locationLoop], pLocationZ[locationLoop], cornerIndex, cellFraction);
+
+			pForceX[locationLoop] += CWindNoiseField::InterpolateLatticeCell(
+				&windForceFrame.mForceX[0], cornerIndex, cellFraction);
+			pForceY[locationLoop] += CWindNoiseField::InterpolateLatticeCell(
+				&windForceFrame.mForceY[0], cornerIndex, cellFraction);
+			pForceZ[locationLoop] += CWindNoiseField::InterpolateLatticeCell(
+				&windForceFrame.mForceZ[0], cornerIndex, cellFraction);
+		}
+	}
+}
+
+
+DWORD WINAPI CWindFieldProducer::ProducerThreadProc(LPVOID pThreadParameter)
+{
+	CWindFieldProducer*				pWindFieldProducer = (CWindFieldProducer*)pThreadParameter;
+
+	while (::WaitForSingleObject(pWindFieldProducer->mFrameRequestEvent, INFINITE) ==
+		WAIT_OBJECT_0)
+	{
+		if (pWindFieldProducer->mbTerminateThread) {
+			break;
+		}
+
+		// The simulation thread does not read the other buffer until the frame has been
+		// published.
+		const IndexType				frameIndex = 1 - pWindFieldProducer->mCurrentFrameIndex;
+
+		pWindFieldProducer->ProduceFrame(pWindFieldProducer->mWindForceFrame[frameIndex],
+			pWindFieldProducer->mRequestedAlterationConstant);
+
+		// Publish the completed frame.
+		::InterlockedExchange(&pWindFieldProducer->mCompletedFrameIndex, (LONG)frameIndex);
+	}
+
+	return(0);
+}
+
+
+void CWindFieldProducer::ProduceFrame(CWindForceFrame& windForceFrame,
+									  const QuantityType alterationConstant)
+{
+	const QuantityType				latticePointCount = this->mLatticePointX.size();
+
+	if (latticePointCount > 0) {
+		std::fill(this->mLatticePointForceX.begin(), this->mLatticePointForceX.end(), 0.0);
+		std::fill(this->mLatticePointForceY.begin(), this->mLatticePointForceY.end(), 0.0);
+		std::fill(this->mLatticePointForceZ.begin(), this->mLatticePointForceZ.end(), 0.0);
+
+		const CExternalForceNodeBatch
+									latticeBatch(latticePointCount, &this->mLatticePointX[0],
+			&this->mLatticePointY[0], &this->mLatticePointZ[0],
+			&this->mLatticePointZeroValue[0], &this->mLatticePointZeroValue[0],
+			&this->mLatticePointZeroValue[0], &this->mLatticePointZeroValue[0],
+			&this->mLatticePointForceX[0], &this->mLatticePointForceY[0],
+			&this->mLatticePointForceZ[0]);
+
+		this->mWindForce.SetAlterationConstant(alterationConstant);
+		this->mWindForce.AccumulateExternalForceVectors(latticeBatch);
+
+		// Store the forces in the frame (frames are allocated once).
+		windForceFrame.mForceX.assign(this->mLatticePointForceX.begin(),
+			this->mLatticePointForceX.end());
+		windForceFrame.mForceY.assign(this->mLatticePointForceY.begin(),
+			this->mLatticePointForceY.end());
+		windForceFrame.mForceZ.assign(this->mLatticePointForceZ.begin(),
+			this->mLatticePointForceZ.end());
+	}
+
+	windForceFrame.mAlterationConstant = alterationConstant;
+}
+
+
+bool CWindFieldProducer::CreateProducerThread()
+{
+	bool							bThreadCreatedSuccessfully = false;
+
+	// Auto-reset event, signalled by the simulation thread when a frame is requested.
+	this->mFrameRequestEvent = ::CreateEvent(NULL, FALSE, FALSE, NULL);
+
+	if (this->mFrameRequestEvent) {
+		DWORD						threadID = 0;
+
+		this->mProducerThreadHandle = ::CreateThread(NULL, 0, ProducerThreadProc, this, 0,
+			&threadID);
+
+		bThreadCreatedSuccessfully = (this->mProducerThreadHandle != NULL);
+
+		if (!bThreadCreatedSuccessfully) {
+			this->DestroyProducerThread();
+		}
+	}
+
+	return(bThreadCreatedSuccessfully);
+}
+
+
+void CWindFieldProducer::DestroyProducerThread()
+{
+	// Release the producer thread, indicating that it should terminate.
+	this->mbTerminateThread = true;
+
+	if (this->mProducerThreadHandle) {
+		::SetEvent(this->mFrameRequestEvent);
+		::WaitForSingleObject(this->mProducerThreadHandle, INFINITE);
+		::CloseHandle(this->mProducerThreadHandle);
+		this->mProducerThreadHandle = NULL;
+	}
+
+	if (this->mFrameRequestEvent) {
+		::CloseHandle(this->mFrameRequestEvent);
+		this->mFrameRequestEvent = NULL;
+	}
+
+	this->mbTerminateThread = false;
+}
@@ -0,0 +1,136 @@
+// WindFieldProducer.h - Contains declarations for the wind field producer, which computes frames
+//                       of wind force vectors on a background thread.
+
+#ifndef _WINDFIELDPRODUCER_H
+#define _WINDFIELDPRODUCER_H		1
+
+
+#include "PrimaryHeaders.h"
+#include "PrimitiveSupport.h"
+#include "ExternalNodeForces.h"
+#include "WindNoiseField.h"
+
+
+// Computes frames of wind force vectors at the points of a wind noise field lattice,
+// using a background thread. Frames are exchanged through a double buffer - the
+// simulation thread reads the most recently completed frame, while the producer thread
+// computes the next frame into the other buffer (the simulation thread never waits for
+// the producer thread).
+class CWindFieldProducer
+{
+public:
+	// The wind is described as for CWindNodeForce - the noise field provides the frame
+	// lattice, and must remain valid for the lifetime of the producer.
+	CWindFieldProducer(const CVector directionVector, const ScalarType maxMagnitude,
+		const CWindNoiseField& noiseField);
+	~CWindFieldProducer();
+
+	// Determines if the producer thread was created successfully.
+	bool							IsValid() const;
+
+	// Adopts the most recently completed frame (if a frame has been completed since the
+	// previous call), and requests a frame for the specified alteration constant if the
+	// producer thread is idle - frames therefore trail the requested alteration constant
+	// by at least one call. Must only be called by the simulation thread.
+	void							AdvanceFrame(const QuantityType alterationConstant);
+
+	// Returns the alteration constant of the current frame.
+	QuantityType					GetFrameAlterationConstant() const;
+
+	// Adds the wind forces (interpolated from the current frame) at a number of
+	// locations to the specified force arrays.
+	void							AccumulateWindForces(const QuantityType locationCount,
+		const ScalarType* pLocationX, const ScalarType* pLocationY,
+		const ScalarType* pLocationZ, ScalarType* pForceX, ScalarType* pForceY,
+		ScalarType* pForceZ) const;
+
+protected:
+
+	// Type definition - lattice point values.
+	typedef std::vector<float>		LatticeArrayType;
+
+	// Wind force vectors for each lattice point.
+	class CWindForceFrame
+	{
+	public:
+		CWindForceFrame();
+
+		LatticeArrayType			mForceX;
+		LatticeArrayType			mForceY;
+		LatticeArrayType			mForceZ;
+
+		// Alteration constant for which the frame was computed.
+		QuantityType				mAlterationConstant;
+	};
+
+
+	// Producer thread entry point.
+	static DWORD WINAPI				ProducerThreadProc(LPVOID pThreadParameter);
+
+	// Computes the wind force vectors of a frame.
+	void							ProduceFrame(CWindForceFrame& windForceFrame,
+		const QuantityType alterationConstant);
+
+	// Creates the producer thread.
+	bool							CreateProducerThread();
+
+	// Terminates and releases the producer thread.
+	void							DestroyProducerThread();
+
+
+	// Wind force evaluated at the lattice points (used only by the producer thread,
+	// once the thread has been created).
+	CWindNodeForce					mWindForce;
+
+	// Lattice upon which frames are computed.
+	const CWindNoiseField&			mNoiseField;
+
+	// Type definition - per-lattice point values used during frame computation.
+	typedef std::vector<ScalarType>	ScalarArrayType;
+
+	// Lattice point locations.
+	ScalarArrayType					mLatticePointX;
+	ScalarArrayType					mLatticePointY;
+	ScalarArrayType					mLatticePointZ;
+
+	// Lattice point velocities and masses (lattice points are stationary, and have no
+	// mass - the wind force does not depend upon either quantity).
+	ScalarArrayType					mLatticePointZeroValue;
+
+	// Forces evaluated for the lattice points (used only by the producer thread, once
+	// the thread has been created).
+	ScalarArrayType					mLatticePointForceX;
+	ScalarArrayType					mLatticePointForceY;
+	ScalarArrayType					mLatticePointForceZ;
+
+	// Frame buffers.
+	CWindForceFrame					mWindForceFrame[2];
+
+	// Index of the frame read by the simulation thread (owned by the simulation
+	// thread).
+	IndexType						mCurrentFrameIndex;
+
+	// Indicates that a frame has been requested, and has not yet been adopted (owned by
+	// the simulation thread).
+	bool							mbFrameRequestPending;
+
+	// Alteration constant of the requested frame (written before the request is
+	// signalled).
+	QuantityType					mRequestedAlterationConstant;
+
+	// Index of the most recently completed frame, or -1 if the frame has been adopted
+	// (exchanged atomically by both threads).
+	volatile LONG					mCompletedFrameIndex;
+
+	// Signalled when a frame has been requested.
+	HANDLE							mFrameRequestEvent;
+
+	// Producer thread handle.
+	HANDLE							mProducerThreadHandle;
+
+	// Indicates that the producer thread should terminate.
+	volatile bool					mbTerminateThread;
+};
+
+
+#endif	// #ifndef _WINDFIELDPRODUCER_H
@@ -0,0 +1,343 @@
+// WindNoiseField.cpp - Contains implementations for the precomputed wind noise field (wind noise
+//                      values baked into a lattice, for use by wind force generators).
+
+#include "WindNoiseField.h"
+#include "ExternalNodeForces.h"
+#include "SpringForceKernels.h"
+#include <algorithm>
+
+
+// The SIMD interpolation path is compiled alongside the SIMD spring force kernels (SSE2
+// support is determined at run time by the spring force kernel module).
+#if SIMD_SPRING_FORCE_KERNELS && (defined(_M_IX86) || defined(_M_X64) || \
+	defined(__i386__) || defined(__x86_64__))
+#if defined(_MSC_VER) && (_MSC_VER >= 1700)
+#include <emmintrin.h>
+#define WIND_FIELD_SIMD_AVAILABLE		1
+#define WIND_FIELD_TARGET_SSE2
+#elif defined(__GNUC__)
+#include <emmintrin.h>
+#define WIND_FIELD_SIMD_AVAILABLE		1
+#define WIND_FIELD_TARGET_SSE2			__attribute__((target("sse2")))
+#endif	// #if defined(_MSC_VER) && (_MSC_VER >= 1700)...#elif defined(__GNUC__)
+#endif	// #if SIMD_SPRING_FORCE_KERNELS...
+
+#ifndef WIND_FIELD_SIMD_AVAILABLE
+#define WIND_FIELD_SIMD_AVAILABLE		0
+#endif	// #ifndef WIND_FIELD_SIMD_AVAILABLE
+
+
+// Trilinearly interpolates the values of the eight lattice points that surround a location
+// (corners are ordered with y varying fastest, followed by z, then x).
+static float InterpolateLatticeScalar(const float* pLatticeValue, const IndexType cornerIndex[8],
+									  const float cellFraction[3])
+{
+	float							edgeValue[4];
+
+	// Interpolate along the x-axis...
+	for (IndexType edgeLoop = 0; edgeLoop < 4; edgeLoop++) {
+		const float					lowerValue = pLatticeValue[cornerIndex[edgeLoop]];
+
+		edgeValue[edgeLoop] = lowerValue + ((pLatticeValue[cornerIndex[edgeLoop + 4]] -
+			lowerValue) * cellFraction[0]);
+	}
+
+	// ...Then along the y-axis, and finally along the z-axis.
+	const float						lowerFaceValue = edgeValue[0] +
+		((edgeValue[1] - edgeValue[0]) * cellFraction[1]);
+	const float						upperFaceValue = edgeValue[2] +
+		((edgeValue[3] - edgeValue[2]) * cellFraction[1]);
+
+	return(lowerFaceValue + ((upperFaceValue - lowerFaceValue) * cellFraction[2]));
+}
+
+
+#if WIND_FIELD_SIMD_AVAILABLE
+
+// SSE2 interpolation - the four x-axis edges of the cell are interpolated concurrently,
+// followed by both y-axis edges.
+WIND_FIELD_TARGET_SSE2 static float InterpolateLatticeSSE2(const float* pLatticeValue,
+														   const IndexType cornerIndex[8],
+														   const float cellFraction[3])
+{
+	const __m128					lowerCorners = _mm_set_ps(pLatticeValue[cornerIndex[3]],
+		pLatticeValue[cornerIndex[2]], pLatticeValue[cornerIndex[1]],
+		pLatticeValue[cornerIndex[0]]);
+	const __m128					upperCorners = _mm_set_ps(pLatticeValue[cornerIndex[7]],
+		pLatticeValue[cornerIndex[6]], pLatticeValue[cornerIndex[5]],
+		pLatticeValue[cornerIndex[4]]);
+
+	const __m128					edgeValues = _mm_add_ps(lowerCorners, _mm_mul_ps(
+		_mm_sub_ps(upperCorners, lowerCorners), _mm_set1_ps(cellFraction[0])));
+
+	// Separate the lower-y and upper-y edges (both z planes in each).
+	const __m128					lowerEdges = _mm_shuffle_ps(edgeValues, edgeValues,
+		_MM_SHUFFLE(2, 0, 2, 0));
+	const __m128					upperEdges = _mm_shuffle_ps(edgeValues, edgeValues,
+		_MM_SHUFFLE(3, 1, 3, 1));
+
+	const __m128					faceValues = _mm_add_ps(lowerEdges, _mm_mul_ps(
+		_mm_sub_ps(upperEdges, lowerEdges), _mm_set1_ps(cellFraction[1])));
+
+	const float						lowerFaceValue = _mm_cvtss_f32(faceValues);
+	const float						upperFaceValue = _mm_cvtss_f32(_mm_shuffle_ps(faceValues,
+		faceValues, _MM_SHUFFLE(1, 1, 1, 1)));
+
+	return(lowerFaceValue + ((upperFaceValue - lowerFaceValue) * cellFraction[2]));
+}
+
+#endif	// #if WIND_FIELD_SIMD_AVAILABLE
+
+
+// Interpolates a lattice value, using SIMD instructions if specified.
+static float InterpolateLattice(const float* pLatticeValue, const IndexType cornerIndex[8],
+								const float cellFraction[3], const bool bUseSIMD)
+{
+#if WIND_FIELD_SIMD_AVAILABLE
+	if (bUseSIMD) {
+		return(InterpolateLatticeSSE2(pLatticeValue, cornerIndex, cellFraction));
+	}
+#endif	// #if WIND_FIELD_SIMD_AVAILABLE
+
+	return(InterpolateLatticeScalar(pLatticeValue, cornerIndex, cellFraction));
+}
+
+
+// Determines if SIMD interpolation is supported by the processor.
+static bool IsSIMDInterpolationSupported()
+{
+#if WIND_FIELD_SIMD_AVAILABLE
+	// Processor support is determined once.
+	static const bool				bSSE2Supported =
+		NSpringForceKernels::IsKernelSupported(eSpringKernelSSE2);
+
+	return(bSSE2Supported);
+#else
+	return(false);
+#endif	// #if WIND_FIELD_SIMD_AVAILABLE
+}
+
+
+/////
+// CWindNoiseField class
+/////
+CWindNoiseField::CWindNoiseField() : mLatticeSize(0), mLatticeSpacing(0.0),
+	mInverseLatticeSpacing(0.0), mTimeSliceCount(0)
+{
+
+}
+
+CWindNoiseField::~CWindNoiseField()
+{
+
+}
+
+
+bool CWindNoiseField::GenerateField(const QuantityType latticeSize,
+									const ScalarType latticeSpacing,
+									const QuantityType timeSliceCount)
+{
+	bool							bGeneratedSuccessfully = false;
+
+	// Discard the existing field.
+	this->mLatticeSize = 0;
+	this->mLatticeSpacing = 0.0;
+	this->mInverseLatticeSpacing = 0.0;
+	this->mTimeSliceCount = 0;
+	this->mNoiseValue.clear();
+	this->mGustFactor.clear();
+
+	if ((latticeSize > 1) && ((latticeSize & (latticeSize - 1)) == 0) &&
+		(latticeSpacing > 0.0))
+	{
+		const QuantityType			latticePointCount = latticeSize * latticeSize * latticeSize;
+
+		this->mNoiseValue.resize(latticePointCount);
+		this->mGustFactor.resize(latticePointCount * timeSliceCount);
+
+		IndexType					pointIndex = 0;
+
+		for (IndexType zLoop = 0; zLoop < latticeSize; zLoop++) {
+			for (IndexType yLoop = 0; yLoop < latticeSize; yLoop++) {
+				for (IndexType xLoop = 0; xLoop < latticeSize; xLoop++) {
+					const double	noiseValue = CWindNodeForce::NoiseFunction(
+						(ScalarType)xLoop * latticeSpacing, (ScalarType)yLoop * latticeSpacing,
+						(ScalarType)zLoop * latticeSpacing);
+
+					this->mNoiseValue[pointIndex] = (float)noiseValue;
+
+					// Gust factor = (cos(Noise x Alteration constant) + 1) / 2
+					for (IndexType sliceLoop = 0; sliceLoop < timeSliceCount; sliceLoop++) {
+						this->mGustFactor[(sliceLoop * latticePointCount) + pointIndex] =
+							(float)((::cos(noiseValue * (double)sliceLoop) + 1.0) / 2.0);
+					}
+
+					pointIndex++;
+				}
+			}
+		}
+
+		this->mLatticeSize = latticeSize;
+		this->mLatticeSpacing = latticeSpacing;
+		this->mInverseLatticeSpacing = 1.0 / latticeSpacing;
+		this->mTimeSliceCount = timeSliceCount;
+
+		bGeneratedSuccessfully = true;
+	}
+
+	return(bGeneratedSuccessfully);
+}
+
+
+bool CWindNoiseField::IsValid() const
+{
+	return(this->mLatticeSize > 0);
+}
+
+
+bool CWindNoiseField::IsTimeTiled() const
+{
+	return(this->mTimeSliceCount > 0);
+}
+
+
+void CWindNoiseField::SampleField(const ScalarType locationX, const ScalarType locationY,
+								  const ScalarType locationZ,
+								  const QuantityType alterationConstant,
+								  ScalarType& noiseValue, ScalarType& gustFactor) const
+{
+	this->SampleField(1, &locationX, &locationY, &locationZ, alterationConstant,
+		&noiseValue, &gustFactor);
+}
+
+
+void CWindNoiseField::SampleField(const QuantityType locationCount,
+								  const ScalarType* pLocationX, const ScalarType* pLocationY,
+								  const ScalarType* pLocationZ,
+								  const QuantityType alterationConstant,
+								  ScalarType* pNoiseValue, ScalarType* pGustFactor) const
+{
+	if (this->IsValid()) {
+		const bool					bUseSIMD = IsSIMDInterpolationSupported();
+		const float*				pNoiseLattice = &this->mNoiseValue[0];
+
+		// The alteration constant selects the gust factor time slice.
+		const float*				pGustLattice = this->IsTimeTiled() ?
+			&this->mGustFactor[(alterationConstant % this->mTimeSliceCount) *
+			this->mNoiseValue.size()] : NULL;
+
+		for (IndexType locationLoop = 0; locationLoop < locationCount; locationLoop++) {
+			IndexType				cornerIndex[8];
+			float					cellFraction[3];
+
+			this->GetLatticeCell(pLocationX[locationLoop], pLocationY[locationLoop],
+				pLocationZ[locationLoop], cornerIndex, cellFraction);
+
+			pNoiseValue[locationLoop] = InterpolateLattice(pNoiseLattice, cornerIndex,
+				cellFraction, bUseSIMD);
+
+			if (pGustLattice) {
+				pGustFactor[locationLoop] = InterpolateLattice(pGustLattice, cornerIndex,
+					cellFraction, bUseSIMD);
+			}
+			else {
+				// Gust factor = (cos(Noise x Alteration constant) + 1) / 2
+				pGustFactor[locationLoop] = (::cos(pNoiseValue[locationLoop] *
+					alterationConstant) + 1.0) / 2.0;
+			}
+		}
+	}
+	else {
+		// An empty field produces unperturbed wind.
+		std::fill(pNoiseValue, pNoiseValue + locationCount, 0.0);
+		std::fill(pGustFactor, pGustFactor + locationCount, 1.0);
+	}
+}
+
+
+QuantityType CWindNoiseField::GetLatticePointCount() const
+{
+	return(this->mNoiseValue.size());
+}
+
+
+CFloatPoint CWindNoiseField::GetLatticePointLocation(const IndexType pointIndex) const
+{
+	CFloatPoint						pointLocation(0.0, 0.0, 0.0);
+
+	if (pointIndex < this->GetLatticePointCount()) {
+		const IndexType				xIndex = pointIndex % this->mLatticeSize;
+		const IndexType				yIndex = (pointIndex / this->mLatticeSize) %
+			this->mLatticeSize;
+		const IndexType				zIndex = pointIndex / (this->mLatticeSize *
+			this->mLatticeSize);
+
+		pointLocation = CFloatPoint((ScalarType)xIndex * this->mLatticeSpacing,
+			(ScalarType)yIndex * this->mLatticeSpacing,
+			(ScalarType)zIndex * this->mLatticeSpacing);
+	}
+
+	return(pointLocation);
+}
+
+
+void CWindNoiseField::GetLatticeCell(const ScalarType locationX, const ScalarType locationY,
+									 const ScalarType locationZ, IndexType cornerIndex[8],
+									 float cellFraction[3]) const
+{
+	const IndexType					lowerX = this->WrapLatticeCoordinate(
+		locationX * this->mInverseLatticeSpacing, cellFraction[0]);
+	const IndexType					lowerY = this->WrapLatticeCoordinate(
+		locationY * this->mInverseLatticeSpacing, cellFraction[1]);
+	const IndexType					lowerZ = this->WrapLatticeCoordinate(
+		locationZ * this->mInverseLatticeSpacing, cellFraction[2]);
+
+	// The lattice is tiled, so the upper points of the last cell wrap to the first
+	// points.
+	const IndexType					upperX = ((lowerX + 1) < this->mLatticeSize) ?
+		(lowerX + 1) : 0;
+	const IndexType					upperY = ((lowerY + 1) < this->mLatticeSize) ?
+		(lowerY + 1) : 0;
+	const IndexType					upperZ = ((lowerZ + 1) < this->mLatticeSize) ?
+		(lowerZ + 1) : 0;
+
+	const QuantityType				rowStride = this->mLatticeSize;
+	const QuantityType				planeStride = this->mLatticeSize * this->mLatticeSize;
+
+	cornerIndex[0] = (lowerZ * planeStride) + (lowerY * rowStride) + lowerX;
+	cornerIndex[1] = (lowerZ * planeStride) + (upperY * rowStride) + lowerX;
+	cornerIndex[2] = (upperZ * planeStride) + (lowerY * rowStride) + lowerX;
+	cornerIndex[3] = (upperZ * planeStride) + (upperY * rowStride) + lowerX;
+	cornerIndex[4] = (lowerZ * planeStride) + (lowerY * rowStride) + upperX;
+	cornerIndex[5] = (lowerZ * planeStride) + (upperY * rowStride) + upperX;
+	cornerIndex[6] = (upperZ * planeStride) + (lowerY * rowStride) + upperX;
+	cornerIndex[7] = (upperZ * planeStride) + (upperY * rowStride) + upperX;
+}
+
+
+IndexType CWindNoiseField::WrapLatticeCoordinate(const ScalarType latticeCoordinate,
+												 float& cellFraction) const
+{
+	// Conversion truncates towards zero - adjust negative coordinates to the next
+	// lower lattice point.
+	RelativeIndexType				lowerIndex = (RelativeIndexType)latticeCoordinate;
+
+	if ((ScalarType)lowerIndex > latticeCoordinate) {
+		lowerIndex--;
+	}
+
+	cellFraction = (float)(latticeCoordinate - (ScalarType)lowerIndex);
+
+	// Reduce the index to the lattice extent (the two's complement mask also wraps
+	// negative indices).
+	return((IndexType)lowerIndex & (this->mLatticeSize - 1));
+}
+
+
+float CWindNoiseField::InterpolateLatticeCell(const float* pLatticeValue,
+											  const IndexType cornerIndex[8],
+											  const float cellFraction[3])
+{
+	return(InterpolateLattice(pLatticeValue, cornerIndex, cellFraction,
+		IsSIMDInterpolationSupported()));
+}
@@ -0,0 +1,97 @@
+// WindNoiseField.h - Contains declarations for the precomputed wind noise field (wind noise values
+//                    baked into a lattice, for use by wind force generators).
+
+#ifndef _WINDNOISEFIELD_H
+#define _WINDNOISEFIELD_H		1
+
+
+#include "PrimaryHeaders.h"
+#include "PrimitiveSupport.h"
+
+
+// Stores the wind noise function sampled at the points of a cubic lattice, which is
+// tiled periodically throughout space (noise values between the lattice points are
+// trilinearly interpolated). The lattice may also store a number of time slices of the
+// wind gust factor, which are tiled periodically in time. A single field may be shared
+// by any number of wind force generators.
+class CWindNoiseField
+{
+public:
+	CWindNoiseField();
+	~CWindNoiseField();
+
+	// Samples the wind noise function at each lattice point - the lattice contains
+	// latticeSize points along each axis (a power of two, permitting coordinates to be
+	// wrapped with a mask), separated by latticeSpacing (m). When the time
+	// slice count is non-zero, the gust factor is also sampled for alteration constants
+	// 0 through (timeSliceCount - 1). Any existing field contents are discarded.
+	bool							GenerateField(const QuantityType latticeSize,
+		const ScalarType latticeSpacing, const QuantityType timeSliceCount);
+
+	// Determines if the field has been generated.
+	bool							IsValid() const;
+
+	// Determines if the field contains time slices of the gust factor.
+	bool							IsTimeTiled() const;
+
+	// Determines the wind noise value (-1.0 - 1.0) and the gust factor (0.0 - 1.0) at a
+	// location, for the specified alteration constant.
+	void							SampleField(const ScalarType locationX,
+		const ScalarType locationY, const ScalarType locationZ,
+		const QuantityType alterationConstant, ScalarType& noiseValue,
+		ScalarType& gustFactor) const;
+
+	// Determines the wind noise values and gust factors at a number of locations (the
+	// lattice cells of all locations are interpolated in sequence).
+	void							SampleField(const QuantityType locationCount,
+		const ScalarType* pLocationX, const ScalarType* pLocationY,
+		const ScalarType* pLocationZ, const QuantityType alterationConstant,
+		ScalarType* pNoiseValue, ScalarType* pGustFactor) const;
+
+	// Returns the number of points within the lattice.
+	QuantityType					GetLatticePointCount() const;
+
+	// Retrieves the location of an indexed lattice point (x varies fastest, followed
+	// by y, then z).
+	CFloatPoint						GetLatticePointLocation(const IndexType pointIndex) const;
+
+	// Determines the lattice indices of the eight points that surround a location, and
+	// the fractional position of the location within the enclosing lattice cell.
+	void							GetLatticeCell(const ScalarType locationX,
+		const ScalarType locationY, const ScalarType locationZ, IndexType cornerIndex[8],
+		float cellFraction[3]) const;
+
+	// Trilinearly interpolates values stored for each lattice point (in lattice point
+	// order) within a lattice cell, using SIMD instructions when they are supported.
+	static float					InterpolateLatticeCell(const float* pLatticeValue,
+		const IndexType cornerIndex[8], const float cellFraction[3]);
+
+protected:
+
+	// Type definition - lattice point values.
+	typedef std::vector<float>		LatticeArrayType;
+
+	// Wraps a (scaled) coordinate into the lattice, returning the index of the lower
+	// lattice point, and the fractional position between the lower and upper points.
+	IndexType						WrapLatticeCoordinate(const ScalarType latticeCoordinate,
+		float& cellFraction) const;
+
+	// Number of lattice points along each axis, and the distance between points (the
+	// reciprocal of the distance is used to locate lattice cells).
+	QuantityType					mLatticeSize;
+	ScalarType						mLatticeSpacing;
+	ScalarType						mInverseLatticeSpacing;
+
+	// Number of time slices of the gust factor (zero if the field is not tiled in
+	// time).
+	QuantityType					mTimeSliceCount;
+
+	// Noise values (x varies fastest, followed by y, then z).
+	LatticeArrayType				mNoiseValue;
+
+	// Gust factors - one lattice for each time slice, in slice order.
+	LatticeArrayType				mGustFactor;
+};
+
+
+#endif	// #ifndef _WINDNOISEFIELD_H
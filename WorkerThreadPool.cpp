@@ -0,0 +1,229 @@
+// WorkerThreadPool.cpp - Contains implementations for a pool of worker threads, used to
+//                        distribute simulation work across multiple processors.
+
+#include "WorkerThreadPool.h"
+
+
+/////
+// CParallelTask class
+/////
+CParallelTask::~CParallelTask()
+{
+
+}
+
+
+/////
+// CWorkerThreadPool class
+/////
+CWorkerThreadPool::CWorkerThreadInfo::CWorkerThreadInfo() : mpThreadPool(NULL),
+	mBlockIndex(0), mThreadHandle(NULL), mTaskReadyEvent(NULL)
+{
+
+}
+
+
+CWorkerThreadPool::CWorkerThreadPool(const QuantityType threadCount) :
+	mTaskCompleteEvent(NULL), mPendingBlockCount(0), mbTerminateThreads(false),
+	mpCurrentTask(NULL), mCurrentItemCount(0), mCurrentBlockCount(0)
+{
+	// The calling thread participates in task execution - create the remaining
+	// threads.
+	if (threadCount > 1) {
+		this->CreateWorkerThreads(threadCount - 1);
+	}
+}
+
+CWorkerThreadPool::~CWorkerThreadPool()
+{
+	this->DestroyWorkerThreads();
+}
+
+
+bool CWorkerThreadPool::IsValid() const
+{
+	// The completion event is created along with the worker threads.
+	return(this->mTaskCompleteEvent != NULL);
+}
+
+
+QuantityType CWorkerThreadPool::GetThreadCount() const
+{
+	// Worker threads, along with the calling thread.
+	return(this->mWorkerThreadInfo.size() + 1);
+}
+
+
+bool CWorkerThreadPool::ExecuteTask(CParallelTask& parallelTask,
+									const QuantityType itemCount,
+									const QuantityType minimumItemsPerBlock)
+{
+	bool							bTaskExecutedSuccessfully = false;
+
+	if (itemCount > 0) {
+		// Determine the number of blocks into which the task will be partitioned.
+		const QuantityType			itemsPerBlock = (minimumItemsPerBlock > 0) ?
+			minimumItemsPerBlock : 1;
+		QuantityType				blockCount = (itemCount + itemsPerBlock - 1) /
+			itemsPerBlock;
+
+		if (!this->IsValid() || (blockCount < 1)) {
+			blockCount = 1;
+		}
+		else if (blockCount > this->GetThreadCount()) {
+			blockCount = this->GetThreadCount();
+		}
+
+		this->mpCurrentTask = &parallelTask;
+		this->mCurrentItemCount = itemCount;
+		this->mCurrentBlockCount = blockCount;
+
+		if (blockCount > 1) {
+			// Release the worker threads required to process the remaining blocks.
+			this->mPendingBlockCount = (LONG)(blockCount - 1);
+
+			for (IndexType threadLoop = 0; threadLoop < (blockCount - 1); threadLoop++) {
+				::SetEvent(this->mWorkerThreadInfo[threadLoop].mTaskReadyEvent);
+			}
+		}
+
+		// Execute the first block on the calling thread...
+		this->ExecuteTaskBlock(0);
+
+		// ...And wait for the worker threads to complete the remaining blocks.
+		if (blockCount > 1) {
+			::WaitForSingleObject(this->mTaskCompleteEvent, INFINITE);
+		}
+
+		this->mpCurrentTask = NULL;
+
+		bTaskExecutedSuccessfully = true;
+	}
+
+	return(bTaskExecutedSuccessfully);
+}
+
+
+QuantityType CWorkerThreadPool::GetProcessorCount()
+{
+	SYSTEM_INFO						systemInfo;
+
+	::GetSystemInfo(&systemInfo);
+
+	return((systemInfo.dwNumberOfProcessors > 0) ? systemInfo.dwNumberOfProcessors : 1);
+}
+
+
+DWORD WINAPI CWorkerThreadPool::WorkerThreadProc(LPVOID pThreadParameter)
+{
+	CWorkerThreadInfo*				pWorkerThreadInfo = (CWorkerThreadInfo*)pThreadParameter;
+	CWorkerThreadPool*				pThreadPool = pWorkerThreadInfo->mpThreadPool;
+
+	while (::WaitForSingleObject(pWorkerThreadInfo->mTaskReadyEvent, INFINITE) ==
+		WAIT_OBJECT_0)
+	{
+		if (pThreadPool->mbTerminateThreads) {
+			break;
+		}
+
+		pThreadPool->ExecuteTaskBlock(pWorkerThreadInfo->mBlockIndex);
+
+		// The last thread to complete its block signals task completion.
+		if (::InterlockedDecrement(&pThreadPool->mPendingBlockCount) == 0) {
+			::SetEvent(pThreadPool->mTaskCompleteEvent);
+		}
+	}
+
+	return(0);
+}
+
+
+void CWorkerThreadPool::ExecuteTaskBlock(const IndexType blockIndex)
+{
+	if (this->mpCurrentTask && (blockIndex < this->mCurrentBlockCount)) {
+		// Blocks contain an equal number of items (the first blocks contain an
+		// additional item when the items cannot be divided evenly).
+		const QuantityType			baseItemsPerBlock = this->mCurrentItemCount /
+			this->mCurrentBlockCount;
+		const QuantityType			remainingItemCount = this->mCurrentItemCount %
+			this->mCurrentBlockCount;
+
+		const IndexType				firstIndex = (blockIndex * baseItemsPerBlock) +
+			((blockIndex < remainingItemCount) ? blockIndex : remainingItemCount);
+		const IndexType				endIndex = firstIndex + baseItemsPerBlock +
+			((blockIndex < remainingItemCount) ? 1 : 0);
+
+		this->mpCurrentTask->ExecuteRange(firstIndex, endIndex);
+	}
+}
+
+
+bool CWorkerThreadPool::CreateWorkerThreads(const QuantityType workerThreadCount)
+{
+	bool							bThreadsCreatedSuccessfully = false;
+
+	// Auto-reset event, signalled by the last worker thread to complete a block.
+	this->mTaskCompleteEvent = ::CreateEvent(NULL, FALSE, FALSE, NULL);
+
+	if (this->mTaskCompleteEvent) {
+		// Thread information must be allocated before the threads are created (threads
+		// reference their information block).
+		this->mWorkerThreadInfo.resize(workerThreadCount);
+
+		bThreadsCreatedSuccessfully = true;
+
+		for (IndexType threadLoop = 0; threadLoop < workerThreadCount; threadLoop++) {
+			CWorkerThreadInfo&		workerThreadInfo = this->mWorkerThreadInfo[threadLoop];
+
+			workerThreadInfo.mpThreadPool = this;
+			workerThreadInfo.mBlockIndex = threadLoop + 1;
+			workerThreadInfo.mTaskReadyEvent = ::CreateEvent(NULL, FALSE, FALSE, NULL);
+
+			if (workerThreadInfo.mTaskReadyEvent) {
+				DWORD				threadID = 0;
+
+				workerThreadInfo.mThreadHandle = ::CreateThread(NULL, 0, WorkerThreadProc,
+					&workerThreadInfo, 0, &threadID);
+			}
+
+			bThreadsCreatedSuccessfully = (workerThreadInfo.mThreadHandle != NULL) &&
+				bThreadsCreatedSuccessfully;
+		}
+
+		if (!bThreadsCreatedSuccessfully) {
+			this->DestroyWorkerThreads();
+		}
+	}
+
+	return(bThreadsCreatedSuccessfully);
+}
+
+
+void CWorkerThreadPool::DestroyWorkerThreads()
+{
+	// Release the worker threads, indicating that they should terminate.
+	this->mbTerminateThreads = true;
+
+	for (IndexType threadLoop = 0; threadLoop < this->mWorkerThreadInfo.size(); threadLoop++) {
+		CWorkerThreadInfo&			workerThreadInfo = this->mWorkerThreadInfo[threadLoop];
+
+		if (workerThreadInfo.mThreadHandle) {
+			::SetEvent(workerThreadInfo.mTaskReadyEvent);
+			::WaitForSingleObject(workerThreadInfo.mThreadHandle, INFINITE);
+			::CloseHandle(workerThreadInfo.mThreadHandle);
+		}
+
+		if (workerThreadInfo.mTaskReadyEvent) {
+			::CloseHandle(workerThreadInfo.mTaskReadyEvent);
+		}
+	}
+
+	this->mWorkerThreadInfo.clear();
+
+	if (this->mTaskCompleteEvent) {
+		::CloseHandle(this->mTaskCompleteEvent);
+		this->mTaskCompleteEvent = NULL;
+	}
+
+	this->mbTerminateThreads = false;
+}
@@ -0,0 +1,112 @@
+// WorkerThreadPool.h - Contains declarations for a pool of worker threads, used to distribute
+//                      simulation work across multiple processors.
+
+#ifndef _WORKERTHREADPOOL_H
+#define _WORKERTHREADPOOL_H		1
+
+
+#include "PrimaryHeaders.h"
+#include "PrimitiveSupport.h"
+
+
+// Interface for work that can be partitioned into independent index ranges.
+class CParallelTask
+{
+public:
+	virtual ~CParallelTask();
+
+	// Performs the work associated with the index range [firstIndex, endIndex).
+	virtual void					ExecuteRange(const IndexType firstIndex,
+		const IndexType endIndex) = 0;
+};
+
+
+// Executes parallel tasks using a fixed set of worker threads - the calling thread
+// participates in the execution of each task, and execution does not return until all
+// task ranges have been completed.
+class CWorkerThreadPool
+{
+public:
+	CWorkerThreadPool(const QuantityType threadCount);
+	~CWorkerThreadPool();
+
+	// Determines if the worker threads were created successfully.
+	bool							IsValid() const;
+
+	// Returns the number of threads that participate in task execution (including
+	// the calling thread).
+	QuantityType					GetThreadCount() const;
+
+	// Partitions the index range [0, itemCount) into contiguous blocks (at most one
+	// block per thread, with each block containing at least the specified number of
+	// items), and executes the task over each block.
+	bool							ExecuteTask(CParallelTask& parallelTask,
+		const QuantityType itemCount, const QuantityType minimumItemsPerBlock);
+
+	// Returns the number of processors available to the program.
+	static QuantityType				GetProcessorCount();
+
+protected:
+
+	// Per-thread state.
+	class CWorkerThreadInfo
+	{
+	public:
+		CWorkerThreadInfo();
+
+		// Owning thread pool.
+		CWorkerThreadPool*			mpThreadPool;
+
+		// Index of the block processed by the thread.
+		IndexType					mBlockIndex;
+
+		// Thread handle.
+		HANDLE						mThreadHandle;
+
+		// Signalled when a task is available for the thread.
+		HANDLE						mTaskReadyEvent;
+	};
+
+
+	// Worker thread entry point.
+	static DWORD WINAPI				WorkerThreadProc(LPVOID pThreadParameter);
+
+	// Executes the current task over the specified block.
+	void							ExecuteTaskBlock(const IndexType blockIndex);
+
+	// Creates the worker threads.
+	bool							CreateWorkerThreads(const QuantityType workerThreadCount);
+
+	// Terminates and releases all worker threads.
+	void							DestroyWorkerThreads();
+
+
+	// Type definition - collection of worker thread information.
+	typedef std::vector<CWorkerThreadInfo>
+									WorkerThreadInfoList;
+
+	// Worker thread information (the calling thread processes block zero, with each
+	// worker thread processing one of the subsequent blocks).
+	WorkerThreadInfoList			mWorkerThreadInfo;
+
+	// Signalled when all worker threads have completed their blocks.
+	HANDLE							mTaskCompleteEvent;
+
+	// Number of worker thread blocks that have not yet been completed.
+	volatile LONG					mPendingBlockCount;
+
+	// Indicates that the worker threads should terminate.
+	volatile bool					mbTerminateThreads;
+
+	// Task that is currently being executed.
+	CParallelTask*					mpCurrentTask;
+
+	// Number of items in the current task.
+	QuantityType					mCurrentItemCount;
+
+	// Number of blocks into which the current task has been partitioned.
+	QuantityType					mCurrentBlockCount;
+};
+
+
+#endif	// #ifndef _WORKERTHREADPOOL_H